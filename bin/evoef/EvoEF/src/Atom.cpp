@@ -27,6 +27,12 @@ int AtomCreate(Atom* pThis){
   pThis->posInChain = -1;
   pThis->isInHBond = FALSE;
   pThis->isBBAtom = FALSE;
+  pThis->energyType = -1;
+  pThis->nameIndex = -1;
+  pThis->hbDorBNameIndex = -1;
+  pThis->hbB2NameIndex = -1;
+  pThis->hbDorBIndex = -1;
+  pThis->hbB2Index = -1;
 
   pThis->FOLDEF_charge = 0.0;
   pThis->FOLDEF_volume = 0.0;
@@ -550,7 +556,24 @@ int AtomArrayInsert(AtomArray* pThis, int index, Atom* pNewAtom){
   for(int i=newCount-1;i>index;i--){
     AtomCopy(&pThis->atoms[i], &pThis->atoms[i-1]);
   }
-  return AtomCopy(&pThis->atoms[index], pNewAtom);
+  AtomCopy(&pThis->atoms[index], pNewAtom);
+  if(index < newCount-1) return AtomArrayResolveHBondPartners(pThis);
+
+  // an appended atom only links itself and the atoms whose partner it is
+  Atom* pAtom = &pThis->atoms[index];
+  pAtom->hbDorBIndex = pAtom->hbB2Index = -1;
+  for(int i=0;i<index;i++){
+    Atom* pOther = &pThis->atoms[i];
+    if(pAtom->nameIndex >= 0){
+      if(pOther->hbDorBNameIndex == pAtom->nameIndex) pOther->hbDorBIndex = index;
+      if(pOther->hbB2NameIndex == pAtom->nameIndex) pOther->hbB2Index = index;
+    }
+    if(pOther->nameIndex >= 0){
+      if(pAtom->hbDorBNameIndex == pOther->nameIndex) pAtom->hbDorBIndex = i;
+      if(pAtom->hbB2NameIndex == pOther->nameIndex) pAtom->hbB2Index = i;
+    }
+  }
+  return Success;
 }
 
 int AtomArrayRemove(AtomArray* pThis, int index){
@@ -563,7 +586,7 @@ int AtomArrayRemove(AtomArray* pThis, int index){
   }
   AtomDestroy(&pThis->atoms[pThis->atomNum-1]);
   (pThis->atomNum)--;
-  return Success;
+  return AtomArrayResolveHBondPartners(pThis);
 }
 
 int AtomArrayRemoveByName(AtomArray* pThis, char* atomName)
@@ -582,6 +605,39 @@ int AtomArrayAppend(AtomArray* pThis, Atom* pNewAtom){
   return AtomArrayInsert(pThis, AtomArrayGetCount(pThis), pNewAtom);
 }
 
+// cache the positions of the H-bond partners by comparing atom name indexes, no string work
+int AtomArrayResolveHBondPartners(AtomArray* pThis){
+  for(int i=0;i<pThis->atomNum;i++){
+    Atom* pAtom = &pThis->atoms[i];
+    pAtom->hbDorBIndex = pAtom->hbB2Index = -1;
+    for(int j=0;j<pThis->atomNum;j++){
+      int nameIndex = pThis->atoms[j].nameIndex;
+      if(nameIndex < 0) continue;
+      if(pAtom->hbDorBNameIndex == nameIndex) pAtom->hbDorBIndex = j;
+      if(pAtom->hbB2NameIndex == nameIndex) pAtom->hbB2Index = j;
+    }
+  }
+  return Success;
+}
+
+// the cached index is used only if the atom there still carries the partner name,
+// otherwise the partner is looked up by name as before
+Atom* AtomArrayGetHbDorB(AtomArray* pThis, Atom* pAtom){
+  int index = pAtom->hbDorBIndex;
+  if(index >= 0 && index < pThis->atomNum && pAtom->hbDorBNameIndex >= 0 && pThis->atoms[index].nameIndex == pAtom->hbDorBNameIndex){
+    return pThis->atoms + index;
+  }
+  return AtomArrayGetByName(pThis, AtomGetHbDorB(pAtom));
+}
+
+Atom* AtomArrayGetHbB2(AtomArray* pThis, Atom* pAtom){
+  int index = pAtom->hbB2Index;
+  if(index >= 0 && index < pThis->atomNum && pAtom->hbB2NameIndex >= 0 && pThis->atoms[index].nameIndex == pAtom->hbB2NameIndex){
+    return pThis->atoms + index;
+  }
+  return AtomArrayGetByName(pThis, AtomGetHbB2(pAtom));
+}
+
 double AtomArrayCalcTotalCharge(AtomArray* pThis){
   double totalCharge = 0.0;
   for(int i=0;i<AtomArrayGetCount(pThis);i++){
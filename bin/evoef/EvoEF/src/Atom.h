@@ -81,6 +81,15 @@ typedef struct _Atom{
   Type_AtomHybridType hybridType;
   // LK atom type, int, 4 bytes
   int    EEF1_atType;
+  // index into the precompiled energy tables, -1 if not assigned, int, 4 bytes
+  int    energyType;
+  // index of the atom name in the bond separation tables, -1 if not assigned, int, 4 bytes
+  int    nameIndex;
+  // name indexes of the H-bond partners hbDorB and hbB2 and their indexes in the owning atom array, -1 if not resolved, int, 4 bytes
+  int    hbDorBNameIndex;
+  int    hbB2NameIndex;
+  int    hbDorBIndex;
+  int    hbB2Index;
 
   // char, 1 byte
   BOOL isXyzValid;
@@ -133,6 +142,9 @@ int AtomArrayInsert(AtomArray* pThis, int index, Atom* pNewAtom);
 int AtomArrayRemove(AtomArray* pThis, int index);
 int AtomArrayRemoveByName(AtomArray* pThis, char* atomName);
 int AtomArrayAppend(AtomArray* pThis, Atom* pNewAtom);
+int AtomArrayResolveHBondPartners(AtomArray* pThis);
+Atom* AtomArrayGetHbDorB(AtomArray* pThis, Atom* pAtom);
+Atom* AtomArrayGetHbB2(AtomArray* pThis, Atom* pAtom);
 double AtomArrayCalcTotalCharge(AtomArray* pThis);
 double AtomArrayCalcMinDistance(AtomArray* pThis, AtomArray* pOther);
 BOOL AtomArrayAllAtomXYZAreValid(AtomArray* pThis);
@@ -0,0 +1,323 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "BondSeparation.h"
+#include "EnergyFunction.h"
+#include <stdlib.h>
+#include <string.h>
+
+// the tables are compiled once from the topology file and shared by all energy functions
+BondSeparation bondSeparation = {{NULL, 0, 0}, NULL, NULL, NULL, 0, 0};
+
+int BondSeparationDestroy(){
+  StringArrayDestroy(&bondSeparation.names);
+  free(bondSeparation.intraTables);
+  free(bondSeparation.nextTables);
+  free(bondSeparation.signatures);
+  bondSeparation.intraTables = NULL;
+  bondSeparation.nextTables = NULL;
+  bondSeparation.signatures = NULL;
+  bondSeparation.nameNum = 0;
+  bondSeparation.contextNum = 0;
+  return Success;
+}
+
+BondSeparation* BondSeparationGet(){
+  return &bondSeparation;
+}
+
+BOOL BondSeparationIsNeighborName(char* atomName){
+  return atomName[0] == '+' || atomName[0] == '-';
+}
+
+int BondSeparationAddName(char* atomName){
+  int index;
+  if(FAILED(StringArrayFind(&bondSeparation.names, atomName, &index))){
+    StringArrayAppend(&bondSeparation.names, atomName);
+    index = StringArrayGetCount(&bondSeparation.names)-1;
+  }
+  return index;
+}
+
+unsigned long long BondSeparationMix(unsigned long long value){
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+unsigned long long BondSeparationHashName(char* atomName){
+  unsigned long long hash = 0xcbf29ce484222325ULL;
+  for(char* p = atomName; *p != '\0'; p++){
+    hash ^= (unsigned char)*p;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// order-free hash of the bonds within a residue, bonds to the neighboring residues are left out
+// because they never change the separation of two atoms in the same residue
+unsigned long long BondSeparationSignature(BondSet* pBonds){
+  unsigned long long signature = 0;
+  for(int i = 0; i < BondSetGetCount(pBonds); i++){
+    Bond* pBond = BondSetGet(pBonds, i);
+    if(BondSeparationIsNeighborName(BondGetFromName(pBond)) || BondSeparationIsNeighborName(BondGetToName(pBond))) continue;
+    unsigned long long hash1 = BondSeparationHashName(BondGetFromName(pBond));
+    unsigned long long hash2 = BondSeparationHashName(BondGetToName(pBond));
+    if(hash1 > hash2){
+      unsigned long long temp = hash1;
+      hash1 = hash2;
+      hash2 = temp;
+    }
+    signature += BondSeparationMix(hash1 ^ BondSeparationMix(hash2));
+  }
+  return signature;
+}
+
+// apply a patch the way ResiduePatch() does: deleted atoms go first, then the patch atoms
+// and bonds are added and bonds to missing atoms are dropped
+int BondSeparationApplyPatch(StringArray* pAtoms, BondSet* pBonds, ResidueTopology* pPatch){
+  StringArray* pDeletes = ResidueTopologyGetDeletes(pPatch);
+  for(int i = 0; i < StringArrayGetCount(pDeletes); i++){
+    int index;
+    if(!FAILED(StringArrayFind(pAtoms, StringArrayGet(pDeletes, i), &index))) StringArrayRemove(pAtoms, index);
+  }
+  StringArray* pPatchAtoms = ResidueTopologyGetAtoms(pPatch);
+  for(int i = 0; i < StringArrayGetCount(pPatchAtoms); i++){
+    int index;
+    if(FAILED(StringArrayFind(pAtoms, StringArrayGet(pPatchAtoms, i), &index))) StringArrayAppend(pAtoms, StringArrayGet(pPatchAtoms, i));
+  }
+  BondSet* pPatchBonds = ResidueTopologyGetBonds(pPatch);
+  for(int i = 0; i < BondSetGetCount(pPatchBonds); i++){
+    Bond* pBond = BondSetGet(pPatchBonds, i);
+    BondSetAdd(pBonds, BondGetFromName(pBond), BondGetToName(pBond), BondGetType(pBond));
+  }
+  BondSet newBonds;
+  BondSetCreate(&newBonds);
+  for(int i = 0; i < BondSetGetCount(pBonds); i++){
+    Bond* pBond = BondSetGet(pBonds, i);
+    int index;
+    if(!BondSeparationIsNeighborName(BondGetFromName(pBond)) && FAILED(StringArrayFind(pAtoms, BondGetFromName(pBond), &index))) continue;
+    if(!BondSeparationIsNeighborName(BondGetToName(pBond)) && FAILED(StringArrayFind(pAtoms, BondGetToName(pBond), &index))) continue;
+    BondSetAdd(&newBonds, BondGetFromName(pBond), BondGetToName(pBond), BondGetType(pBond));
+  }
+  BondSetCopy(pBonds, &newBonds);
+  BondSetDestroy(&newBonds);
+  return Success;
+}
+
+BOOL BondSeparationPatchFits(StringArray* pAtoms, ResidueTopology* pPatch){
+  StringArray* pDeletes = ResidueTopologyGetDeletes(pPatch);
+  for(int i = 0; i < StringArrayGetCount(pDeletes); i++){
+    int index;
+    if(FAILED(StringArrayFind(pAtoms, StringArrayGet(pDeletes, i), &index))) return FALSE;
+  }
+  return TRUE;
+}
+
+// breadth-first search over the bonds of one context, all names must have been collected before
+int BondSeparationAddContext(BondSet* pBonds){
+  unsigned long long signature = BondSeparationSignature(pBonds);
+  for(int i = 0; i < bondSeparation.contextNum; i++){
+    if(bondSeparation.signatures[i] == signature) return Success;
+  }
+
+  // local nodes of the context and their adjacency
+  int nodes[BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM];
+  static char bonded[BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM][BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM];
+  int nodeNum = 0;
+  memset(bonded, 0, sizeof(bonded));
+  for(int i = 0; i < BondSetGetCount(pBonds); i++){
+    Bond* pBond = BondSetGet(pBonds, i);
+    if(BondSeparationIsNeighborName(BondGetFromName(pBond)) || BondSeparationIsNeighborName(BondGetToName(pBond))) continue;
+    int ends[2], locals[2];
+    StringArrayFind(&bondSeparation.names, BondGetFromName(pBond), &ends[0]);
+    StringArrayFind(&bondSeparation.names, BondGetToName(pBond), &ends[1]);
+    for(int k = 0; k < 2; k++){
+      for(locals[k] = 0; locals[k] < nodeNum; locals[k]++){
+        if(nodes[locals[k]] == ends[k]) break;
+      }
+      if(locals[k] == nodeNum){
+        if(nodeNum == BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM){
+          char usrMsg[MAX_LENGTH_ERR_MSG+1];
+          sprintf(usrMsg, "in file %s function %s() line %d, too many atoms in a residue topology", __FILE__, __FUNCTION__, __LINE__);
+          TraceError(usrMsg, IndexError);
+          return IndexError;
+        }
+        nodes[nodeNum++] = ends[k];
+      }
+    }
+    bonded[locals[0]][locals[1]] = bonded[locals[1]][locals[0]] = 1;
+  }
+
+  int n = bondSeparation.nameNum;
+  int contextNum = bondSeparation.contextNum+1;
+  bondSeparation.signatures = (unsigned long long*)realloc(bondSeparation.signatures, sizeof(unsigned long long)*contextNum);
+  bondSeparation.intraTables = (char*)realloc(bondSeparation.intraTables, sizeof(char)*n*n*contextNum);
+  bondSeparation.signatures[contextNum-1] = signature;
+  bondSeparation.contextNum = contextNum;
+
+  // names without bonds in the context are 15, the diagonal is left to the string check
+  char* table = bondSeparation.intraTables + n*n*(contextNum-1);
+  memset(table, 15, n*n);
+  for(int i = 0; i < n; i++) table[i*n+i] = 0;
+  int queue[BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM];
+  int depth[BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM];
+  for(int i = 0; i < nodeNum; i++){
+    for(int j = 0; j < nodeNum; j++) depth[j] = -1;
+    int head = 0, tail = 0;
+    queue[tail++] = i;
+    depth[i] = 0;
+    while(head < tail){
+      int cur = queue[head++];
+      if(depth[cur] == 3) continue;
+      for(int j = 0; j < nodeNum; j++){
+        if(bonded[cur][j] && depth[j] < 0){
+          depth[j] = depth[cur]+1;
+          queue[tail++] = j;
+        }
+      }
+    }
+    for(int j = 0; j < nodeNum; j++){
+      if(depth[j] > 0) table[nodes[i]*n+nodes[j]] = (char)(11+depth[j]);
+    }
+  }
+  return Success;
+}
+
+// protein residues of the parameter file alone, with one patch, or with two patches such as NTER and CTER
+int BondSeparationBuild(AtomParamsSet* pAtomParams, ResiTopoSet* pTopos){
+  BondSeparationDestroy();
+  StringArrayCreate(&bondSeparation.names);
+  for(int i = 0; i < AtomParamsSetGetResidueCount(pAtomParams); i++){
+    for(int j = 0; j < pAtomParams->atomCount[i]; j++){
+      BondSeparationAddName(AtomGetName(&pAtomParams->atoms[i][j]));
+    }
+  }
+  for(int i = 0; i < pTopos->count; i++){
+    int index;
+    if(FAILED(StringArrayFind(&pAtomParams->residueNames, ResidueTopologyGetName(&pTopos->topos[i]), &index))) continue;
+    BondSet* pBonds = ResidueTopologyGetBonds(&pTopos->topos[i]);
+    for(int j = 0; j < BondSetGetCount(pBonds); j++){
+      Bond* pBond = BondSetGet(pBonds, j);
+      if(!BondSeparationIsNeighborName(BondGetFromName(pBond))) BondSeparationAddName(BondGetFromName(pBond));
+      if(!BondSeparationIsNeighborName(BondGetToName(pBond))) BondSeparationAddName(BondGetToName(pBond));
+    }
+  }
+  bondSeparation.nameNum = StringArrayGetCount(&bondSeparation.names);
+  for(int i = 0; i < AtomParamsSetGetResidueCount(pAtomParams); i++){
+    for(int j = 0; j < pAtomParams->atomCount[i]; j++){
+      Atom* pAtom = &pAtomParams->atoms[i][j];
+      StringArrayFind(&bondSeparation.names, AtomGetName(pAtom), &pAtom->nameIndex);
+      // the H-bond partners are named in the same dictionary, see AtomArrayResolveHBondPartners()
+      StringArrayFind(&bondSeparation.names, AtomGetHbDorB(pAtom), &pAtom->hbDorBNameIndex);
+      StringArrayFind(&bondSeparation.names, AtomGetHbB2(pAtom), &pAtom->hbB2NameIndex);
+    }
+  }
+
+  for(int i = 0; i < pTopos->count; i++){
+    ResidueTopology* pResiTopo = &pTopos->topos[i];
+    int index;
+    if(ResidueTopologyIsPatch(pResiTopo)) continue;
+    if(FAILED(StringArrayFind(&pAtomParams->residueNames, ResidueTopologyGetName(pResiTopo), &index))) continue;
+    BondSeparationAddContext(ResidueTopologyGetBonds(pResiTopo));
+    for(int j = 0; j < pTopos->count; j++){
+      ResidueTopology* pPatch1 = &pTopos->topos[j];
+      if(!ResidueTopologyIsPatch(pPatch1)) continue;
+      if(FAILED(StringArrayFind(&pAtomParams->residueNames, ResidueTopologyGetName(pPatch1), &index))) continue;
+      if(!BondSeparationPatchFits(ResidueTopologyGetAtoms(pResiTopo), pPatch1)) continue;
+      for(int k = j; k < pTopos->count; k++){
+        ResidueTopology* pPatch2 = &pTopos->topos[k];
+        if(k != j){
+          if(!ResidueTopologyIsPatch(pPatch2)) continue;
+          if(FAILED(StringArrayFind(&pAtomParams->residueNames, ResidueTopologyGetName(pPatch2), &index))) continue;
+        }
+        StringArray atoms;
+        BondSet bonds;
+        StringArrayCreate(&atoms);
+        BondSetCreate(&bonds);
+        StringArrayCopy(&atoms, ResidueTopologyGetAtoms(pResiTopo));
+        BondSetCopy(&bonds, ResidueTopologyGetBonds(pResiTopo));
+        BondSeparationApplyPatch(&atoms, &bonds, pPatch1);
+        if(k == j || BondSeparationPatchFits(&atoms, pPatch2)){
+          if(k != j) BondSeparationApplyPatch(&atoms, &bonds, pPatch2);
+          int result = BondSeparationAddContext(&bonds);
+          if(FAILED(result)){
+            StringArrayDestroy(&atoms);
+            BondSetDestroy(&bonds);
+            return result;
+          }
+        }
+        StringArrayDestroy(&atoms);
+        BondSetDestroy(&bonds);
+      }
+    }
+  }
+
+  // the next-residue rules only look at the atom names and whether the next residue is a proline
+  int n = bondSeparation.nameNum;
+  bondSeparation.nextTables = (char*)malloc(sizeof(char)*2*n*n);
+  Residue preResi, nextResi;
+  ResidueCreate(&preResi);
+  ResidueCreate(&nextResi);
+  char nextNames[2][MAX_LENGTH_RESIDUE_NAME+1] = {"ALA", "PRO"};
+  for(int proline = 0; proline < 2; proline++){
+    ResidueSetName(&nextResi, nextNames[proline]);
+    for(int i = 0; i < n; i++){
+      for(int j = 0; j < n; j++){
+        bondSeparation.nextTables[proline*n*n+i*n+j] = (char)ResidueAndNextResidueInterBondConnectionCheck_charmm19(
+          StringArrayGet(&bondSeparation.names, i), StringArrayGet(&bondSeparation.names, j), &preResi, &nextResi);
+      }
+    }
+  }
+  ResidueDestroy(&preResi);
+  ResidueDestroy(&nextResi);
+  return Success;
+}
+
+// -1 if the bonds of the residue match none of the contexts, e.g. a residue rebuilt from a rotamer
+int BondSeparationFindContext(BondSet* pBonds){
+  if(bondSeparation.contextNum == 0) return -1;
+  unsigned long long signature = BondSeparationSignature(pBonds);
+  for(int i = 0; i < bondSeparation.contextNum; i++){
+    if(bondSeparation.signatures[i] == signature) return i;
+  }
+  return -1;
+}
+
+// same result as ResidueIntraBondConnectionCheck(), which is still used when there is no table entry
+int BondSeparationIntraResidue(int context, Atom* pAtom1, Atom* pAtom2, BondSet* pBonds){
+  if(context >= 0 && pAtom1->nameIndex >= 0 && pAtom2->nameIndex >= 0){
+    int n = bondSeparation.nameNum;
+    int separation = bondSeparation.intraTables[context*n*n + pAtom1->nameIndex*n + pAtom2->nameIndex];
+    if(separation != 0) return separation;
+  }
+  return ResidueIntraBondConnectionCheck(AtomGetName(pAtom1), AtomGetName(pAtom2), pBonds);
+}
+
+// same result as ResidueAndNextResidueInterBondConnectionCheck_charmm19()
+int BondSeparationNextResidue(Atom* pAtomOnPreResi, Atom* pAtomOnNextResi, Residue* pPreResi, Residue* pNextResi){
+  if(bondSeparation.nextTables != NULL && pAtomOnPreResi->nameIndex >= 0 && pAtomOnNextResi->nameIndex >= 0){
+    int n = bondSeparation.nameNum;
+    int proline = strcmp(pNextResi->name, "PRO") == 0 ? 1 : 0;
+    return bondSeparation.nextTables[proline*n*n + pAtomOnPreResi->nameIndex*n + pAtomOnNextResi->nameIndex];
+  }
+  return ResidueAndNextResidueInterBondConnectionCheck_charmm19(AtomGetName(pAtomOnPreResi), AtomGetName(pAtomOnNextResi), pPreResi, pNextResi);
+}
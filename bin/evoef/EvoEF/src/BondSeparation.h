@@ -0,0 +1,47 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef BOND_SEPARATION_H
+#define BOND_SEPARATION_H
+
+#include "Residue.h"
+
+// upper bound of the atoms in a residue topology, used by the breadth-first search
+#define BOND_SEPARATION_MAX_TOPOLOGY_ATOM_NUM   128
+
+// 12/13/14/15 separations between atom names, compiled once from the residue topologies.
+// A context is a protein residue topology, alone or with one or two patches applied, and is
+// identified by a hash of its bonds so that residues are matched by what they are bonded like
+typedef struct _BondSeparation{
+  StringArray names;                 // atom names of the parameter and topology files
+  char* intraTables;                 // contextNum*nameNum*nameNum, separation of two atoms in one residue
+  char* nextTables;                  // 2*nameNum*nameNum, atom on a residue and atom on the next one, the second table is for a next proline
+  unsigned long long* signatures;    // per context, hash of the bonds within the residue
+  int nameNum;
+  int contextNum;
+} BondSeparation;
+
+int BondSeparationBuild(AtomParamsSet* pAtomParams, ResiTopoSet* pTopos);
+int BondSeparationDestroy();
+BondSeparation* BondSeparationGet();
+unsigned long long BondSeparationSignature(BondSet* pBonds);
+int BondSeparationFindContext(BondSet* pBonds);
+int BondSeparationIntraResidue(int context, Atom* pAtom1, Atom* pAtom2, BondSet* pBonds);
+int BondSeparationNextResidue(Atom* pAtomOnPreResi, Atom* pAtomOnNextResi, Residue* pPreResi, Residue* pNextResi);
+
+#endif // BOND_SEPARATION_H
@@ -0,0 +1,199 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "CellList.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+int CellListCreate(CellList* pThis){
+  pThis->residues = NULL;
+  pThis->chainIndexes = NULL;
+  pThis->resiIndexes = NULL;
+  pThis->centers = NULL;
+  pThis->radii = NULL;
+  pThis->cellHeads = NULL;
+  pThis->cellNexts = NULL;
+  pThis->origin.X = pThis->origin.Y = pThis->origin.Z = 0.0;
+  pThis->maxRadius = 0.0;
+  pThis->cutoff = 0.0;
+  pThis->cellCounts[0] = pThis->cellCounts[1] = pThis->cellCounts[2] = 0;
+  pThis->residueNum = 0;
+  return Success;
+}
+
+int CellListDestroy(CellList* pThis){
+  free(pThis->residues);
+  free(pThis->chainIndexes);
+  free(pThis->resiIndexes);
+  free(pThis->centers);
+  free(pThis->radii);
+  free(pThis->cellHeads);
+  free(pThis->cellNexts);
+  CellListCreate(pThis);
+  return Success;
+}
+
+int CellListCellIndex(CellList* pThis, int ix, int iy, int iz){
+  return (iz*pThis->cellCounts[1] + iy)*pThis->cellCounts[0] + ix;
+}
+
+int CellListCellCoordinate(CellList* pThis, double value, double origin, int axis){
+  int index = (int)floor((value-origin)/CELL_LIST_CELL_SIZE);
+  if(index < 0) index = 0;
+  if(index >= pThis->cellCounts[axis]) index = pThis->cellCounts[axis]-1;
+  return index;
+}
+
+// chainIndex < 0 puts the residues of all chains into the grid
+int CellListBuild(CellList* pThis, Structure* pStructure, int chainIndex, double cutoff){
+  CellListDestroy(pThis);
+  pThis->cutoff = cutoff;
+
+  int firstChain = chainIndex < 0 ? 0 : chainIndex;
+  int lastChain = chainIndex < 0 ? StructureGetChainCount(pStructure)-1 : chainIndex;
+  int count = 0;
+  for(int i = firstChain; i <= lastChain; i++){
+    count += ChainGetResidueCount(StructureGetChain(pStructure, i));
+  }
+  pThis->residueNum = count;
+  if(count == 0) return Success;
+
+  pThis->residues = (Residue**)malloc(sizeof(Residue*)*count);
+  pThis->chainIndexes = (int*)malloc(sizeof(int)*count);
+  pThis->resiIndexes = (int*)malloc(sizeof(int)*count);
+  pThis->centers = (XYZ*)malloc(sizeof(XYZ)*count);
+  pThis->radii = (double*)malloc(sizeof(double)*count);
+  pThis->cellNexts = (int*)malloc(sizeof(int)*count);
+
+  // bounding sphere of every residue, centered on the atom centroid
+  XYZ minXYZ, maxXYZ;
+  minXYZ.X = minXYZ.Y = minXYZ.Z = DBL_MAX;
+  maxXYZ.X = maxXYZ.Y = maxXYZ.Z = -DBL_MAX;
+  int index = 0;
+  for(int i = firstChain; i <= lastChain; i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      Residue* pResidue = ChainGetResidue(pChain, j);
+      XYZ center;
+      center.X = center.Y = center.Z = 0.0;
+      int atomCount = ResidueGetAtomCount(pResidue);
+      for(int k = 0; k < atomCount; k++){
+        XYZAdd(&center, &ResidueGetAtom(pResidue, k)->xyz);
+      }
+      if(atomCount > 0) XYZScale(&center, 1.0/atomCount);
+      double radius = 0.0;
+      for(int k = 0; k < atomCount; k++){
+        double distance = XYZDistance(&center, &ResidueGetAtom(pResidue, k)->xyz);
+        if(distance > radius) radius = distance;
+      }
+      pThis->residues[index] = pResidue;
+      pThis->chainIndexes[index] = i;
+      pThis->resiIndexes[index] = j;
+      pThis->centers[index] = center;
+      pThis->radii[index] = radius;
+      if(radius > pThis->maxRadius) pThis->maxRadius = radius;
+      if(center.X < minXYZ.X) minXYZ.X = center.X;
+      if(center.Y < minXYZ.Y) minXYZ.Y = center.Y;
+      if(center.Z < minXYZ.Z) minXYZ.Z = center.Z;
+      if(center.X > maxXYZ.X) maxXYZ.X = center.X;
+      if(center.Y > maxXYZ.Y) maxXYZ.Y = center.Y;
+      if(center.Z > maxXYZ.Z) maxXYZ.Z = center.Z;
+      index++;
+    }
+  }
+
+  // bin the sphere centers, each cell keeps a linked list of its residues
+  pThis->origin = minXYZ;
+  pThis->cellCounts[0] = (int)floor((maxXYZ.X-minXYZ.X)/CELL_LIST_CELL_SIZE)+1;
+  pThis->cellCounts[1] = (int)floor((maxXYZ.Y-minXYZ.Y)/CELL_LIST_CELL_SIZE)+1;
+  pThis->cellCounts[2] = (int)floor((maxXYZ.Z-minXYZ.Z)/CELL_LIST_CELL_SIZE)+1;
+  int cellNum = pThis->cellCounts[0]*pThis->cellCounts[1]*pThis->cellCounts[2];
+  pThis->cellHeads = (int*)malloc(sizeof(int)*cellNum);
+  for(int i = 0; i < cellNum; i++) pThis->cellHeads[i] = -1;
+  for(int i = count-1; i >= 0; i--){
+    int ix = CellListCellCoordinate(pThis, pThis->centers[i].X, pThis->origin.X, 0);
+    int iy = CellListCellCoordinate(pThis, pThis->centers[i].Y, pThis->origin.Y, 1);
+    int iz = CellListCellCoordinate(pThis, pThis->centers[i].Z, pThis->origin.Z, 2);
+    int cell = CellListCellIndex(pThis, ix, iy, iz);
+    pThis->cellNexts[i] = pThis->cellHeads[cell];
+    pThis->cellHeads[cell] = i;
+  }
+  return Success;
+}
+
+int CellListGetResidueCount(CellList* pThis){
+  return pThis->residueNum;
+}
+
+Residue* CellListGetResidue(CellList* pThis, int index){
+  if(index < 0 || index >= pThis->residueNum) return NULL;
+  return pThis->residues[index];
+}
+
+int CellListGetChainIndex(CellList* pThis, int index){
+  return pThis->chainIndexes[index];
+}
+
+int CellListGetResidueIndex(CellList* pThis, int index){
+  return pThis->resiIndexes[index];
+}
+
+int CellListCompareIndex(const void* a, const void* b){
+  return *(const int*)a - *(const int*)b;
+}
+
+int CellListCollectNeighbors(CellList* pThis, int index, BOOL behindOnly, IntArray* pNeighbors){
+  pNeighbors->length = 0;
+  if(index < 0 || index >= pThis->residueNum) return IndexError;
+  XYZ* pCenter = &pThis->centers[index];
+  double reach = pThis->radii[index] + pThis->maxRadius + pThis->cutoff;
+  int low[3], high[3];
+  low[0] = CellListCellCoordinate(pThis, pCenter->X-reach, pThis->origin.X, 0);
+  low[1] = CellListCellCoordinate(pThis, pCenter->Y-reach, pThis->origin.Y, 1);
+  low[2] = CellListCellCoordinate(pThis, pCenter->Z-reach, pThis->origin.Z, 2);
+  high[0] = CellListCellCoordinate(pThis, pCenter->X+reach, pThis->origin.X, 0);
+  high[1] = CellListCellCoordinate(pThis, pCenter->Y+reach, pThis->origin.Y, 1);
+  high[2] = CellListCellCoordinate(pThis, pCenter->Z+reach, pThis->origin.Z, 2);
+  for(int iz = low[2]; iz <= high[2]; iz++){
+    for(int iy = low[1]; iy <= high[1]; iy++){
+      for(int ix = low[0]; ix <= high[0]; ix++){
+        for(int j = pThis->cellHeads[CellListCellIndex(pThis, ix, iy, iz)]; j != -1; j = pThis->cellNexts[j]){
+          if(j == index || (behindOnly && j < index)) continue;
+          double limit = pThis->radii[index] + pThis->radii[j] + pThis->cutoff + CELL_LIST_SPHERE_TOLERANCE;
+          if(XYZDistance(pCenter, &pThis->centers[j]) > limit) continue;
+          IntArrayAppend(pNeighbors, j);
+        }
+      }
+    }
+  }
+  qsort(IntArrayGetAll(pNeighbors), IntArrayGetLength(pNeighbors), sizeof(int), CellListCompareIndex);
+  return Success;
+}
+
+// collect the residues behind 'index' whose bounding spheres are within the cutoff,
+// the neighbors are sorted so that callers visit residue pairs in the original loop order
+int CellListGetNeighbors(CellList* pThis, int index, IntArray* pNeighbors){
+  return CellListCollectNeighbors(pThis, index, TRUE, pNeighbors);
+}
+
+// same as CellListGetNeighbors, but the residues in front of 'index' are collected as well
+int CellListGetAllNeighbors(CellList* pThis, int index, IntArray* pNeighbors){
+  return CellListCollectNeighbors(pThis, index, FALSE, pNeighbors);
+}
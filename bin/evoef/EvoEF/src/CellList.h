@@ -0,0 +1,55 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef CELL_LIST_H
+#define CELL_LIST_H
+
+#include "Structure.h"
+
+// edge length of a grid cell, residue pairs farther than this (minus their radii) never interact
+#define CELL_LIST_CELL_SIZE           6.0
+// slack added to the sphere overlap test so that rounding never drops an interacting pair
+#define CELL_LIST_SPHERE_TOLERANCE    1e-6
+
+// uniform grid of residue bounding spheres, residues are indexed in chain order
+typedef struct _CellList{
+  Residue** residues;   // 4/8 bytes
+  int* chainIndexes;    // 4/8 bytes
+  int* resiIndexes;     // 4/8 bytes
+  XYZ* centers;         // 4/8 bytes
+  double* radii;        // 4/8 bytes
+  int* cellHeads;       // 4/8 bytes, first residue in each cell, -1 for an empty cell
+  int* cellNexts;       // 4/8 bytes, next residue in the same cell
+  XYZ origin;           // 24 bytes
+  double maxRadius;     // 8 bytes
+  double cutoff;        // 8 bytes
+  int cellCounts[3];    // 12 bytes
+  int residueNum;       // 4 bytes
+} CellList;
+
+int CellListCreate(CellList* pThis);
+int CellListDestroy(CellList* pThis);
+int CellListBuild(CellList* pThis, Structure* pStructure, int chainIndex, double cutoff);
+int CellListGetResidueCount(CellList* pThis);
+Residue* CellListGetResidue(CellList* pThis, int index);
+int CellListGetChainIndex(CellList* pThis, int index);
+int CellListGetResidueIndex(CellList* pThis, int index);
+int CellListGetNeighbors(CellList* pThis, int index, IntArray* pNeighbors);
+int CellListGetAllNeighbors(CellList* pThis, int index, IntArray* pNeighbors);
+
+#endif // CELL_LIST_H
@@ -0,0 +1,33 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "EmbeddedData.h"
+#include <string.h>
+
+// only the default paths "data/<name>" and "./data/<name>" find an embedded file. any other path that is missing
+// stays an error, so that a mistyped --rotamer-lib or parameter file is never replaced by the compiled copy
+EmbeddedFile* EmbeddedDataFind(char* path){
+  char* name = path;
+  if(name[0] == '.' && (name[1] == '/' || name[1] == '\\')) name += 2;
+  if(strncmp(name, "data", 4) != 0 || (name[4] != '/' && name[4] != '\\')) return NULL;
+  name += 5;
+  for(int i = 0; i < embeddedFileCount; i++){
+    if(strcmp(embeddedFiles[i].name, name) == 0) return &embeddedFiles[i];
+  }
+  return NULL;
+}
@@ -0,0 +1,36 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef EMBEDDED_DATA_H
+#define EMBEDDED_DATA_H
+
+// data files compiled into the binary by embed_data.pl (EmbeddedDataFiles.cpp). the lines are stored as FileReader keeps
+// them, i.e. without comments, trailing spaces and empty lines. they stand in for the default paths data/<name> only,
+// and a file found on disk always overrides its embedded copy
+typedef struct _EmbeddedFile{
+  const char* name;     // file name without the directory
+  const char** lines;
+  int lineCount;
+} EmbeddedFile;
+
+extern EmbeddedFile embeddedFiles[];
+extern int embeddedFileCount;
+
+EmbeddedFile* EmbeddedDataFind(char* path);
+
+#endif // EMBEDDED_DATA_H
@@ -0,0 +1,2484 @@
+// generated by embed_data.pl from the files in ./data, do not edit
+#include "EmbeddedData.h"
+
+// param_charmm19_lk_ref2015.prm
+static const char* embeddedLines0[] = {
+  "ALA       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "ALA       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "ALA       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ALA       CB      CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ALA       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "ALA       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "ARG       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "ARG       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "ARG       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ARG       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ARG       CG      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ARG       CD      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ARG       NE      NC2     N         C        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "ARG       HE      H       N         P        0.0218   0.8773    0.40     H       NE      -       N",
+  "ARG       CZ      C       N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ARG       NH1     NC2     N         C        0.1617   1.7632   -0.80     -       -       -       SP2",
+  "ARG       HH11    HC      N         P        0.0218   0.8773    0.40     H       NH1     -       N",
+  "ARG       HH12    HC      N         P        0.0218   0.8773    0.40     H       NH1     -       N",
+  "ARG       NH2     NC2     N         C        0.1617   1.7632   -0.80     -       -       -       SP2",
+  "ARG       HH21    HC      N         P        0.0218   0.8773    0.40     H       NH2     -       N",
+  "ARG       HH22    HC      N         P        0.0218   0.8773    0.40     H       NH2     -       N",
+  "ARG       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "ARG       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "ASN       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "ASN       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "ASN       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ASN       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ASN       CG      C       N         NP1      0.0626   1.9922    0.55     -       -       -       N",
+  "ASN       OD1     O       N         P        0.1424   1.5760   -0.55     A       CG      CB      SP2",
+  "ASN       ND2     NH2     N         P        0.0688   1.7632   -0.80     -       -       -       SP2",
+  "ASN       HD21    H       N         P        0.0218   0.8773    0.40     H       ND2     -       N",
+  "ASN       HD22    H       N         P        0.0218   0.8773    0.40     H       ND2     -       N",
+  "ASN       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "ASN       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "ASP       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "ASP       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "ASP       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ASP       CB      CHE2    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ASP       CG      C       N         NP1      0.0946   1.9649    1.20     -       -       -       N",
+  "ASP       OD1     OC      N         C        0.1619   1.4492   -0.60     A       CG      CB      SP2",
+  "ASP       OD2     OC      N         C        0.1619   1.4492   -0.60     A       CG      CB      SP2",
+  "ASP       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "ASP       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "CYS       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "CYS       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "CYS       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "CYS       CB      CH2E    N         NP1      0.0626   2.0112    0.19     -       -       -       N",
+  "CYS       SG      SH1E    N         NP1      0.0626   2.0171   -0.19     -       -       -       N",
+  "CYS       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "CYS       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "GLN       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "GLN       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "GLN       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLN       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLN       CG      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLN       CD      C       N         NP1      0.0626   1.9922    0.55     -       -       -       N",
+  "GLN       OE1     O       N         P        0.1424   1.5760   -0.55     A       CD      CG      SP2",
+  "GLN       NE2     NH2     N         P        0.0688   1.7632   -0.80     -       -       -       SP2",
+  "GLN       HE21    H       N         P        0.0218   0.8773    0.40     H       NE2     -       N",
+  "GLN       HE22    H       N         P        0.0218   0.8773    0.40     H       NE2     -       N",
+  "GLN       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "GLN       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "GLU       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "GLU       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "GLU       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLU       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLU       CG      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLU       CD      C       N         NP1      0.0626   1.9649    1.20     -       -       -       N",
+  "GLU       OE1     OC      N         C        0.1619   1.4492   -0.60     A       CD      CG      SP2",
+  "GLU       OE2     OC      N         C        0.1619   1.4492   -0.60     A       CD      CG      SP2",
+  "GLU       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "GLU       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "GLY       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "GLY       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "GLY       CA      CH2E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLY       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "GLY       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "HSD       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "HSD       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "HSD       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "HSD       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "HSD       CG      C       N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSD       ND1     NR      N         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "HSD       HD1     H       N         P        0.0218   0.8773    0.40     H       ND1     -       N",
+  "HSD       CD2     CR1E    N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSD       CE1     CR1E    N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSD       NE2     NR      N         P        0.1617   1.7632    0.00     A       CD2     CG      SP2",
+  "HSD       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "HSD       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "HSE       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "HSE       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "HSE       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "HSE       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "HSE       CG      C       N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSE       ND1     NR      N         P        0.1617   1.7632    0.00     A       CE1     NE2     SP2",
+  "HSE       CE1     CR1E    N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSE       CD2     CR1E    N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSE       NE2     NR      N         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "HSE       HE2     H       N         P        0.0218   0.8773    0.40     H       NE2     -       N",
+  "HSE       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "HSE       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "HSP       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "HSP       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "HSP       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "HSP       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "HSP       CG      C       N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSP       CD2     CR1E    N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSP       ND1     NR      N         C        0.1617   1.7632   -0.60     -       -       -       SP2",
+  "HSP       HD1     H       N         P        0.0218   0.8773    0.60     H       ND1     -       N",
+  "HSP       CE1     CR1E    N         NP1      0.1418   1.9859    0.00     -       -       -       N",
+  "HSP       NE2     NR      N         C        0.1617   1.7632   -0.60     -       -       -       SP2",
+  "HSP       HE2     H       N         P        0.0218   0.8773    0.60     H       NE2     -       N",
+  "HSP       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "HSP       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "ILE       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "ILE       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "ILE       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ILE       CB      CH1E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ILE       CG2     CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ILE       CG1     CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ILE       CD      CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "ILE       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "ILE       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "LEU       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "LEU       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "LEU       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LEU       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LEU       CG      CH1E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LEU       CD1     CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LEU       CD2     CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LEU       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "LEU       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "LYS       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "LYS       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "LYS       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LYS       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LYS       CG      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LYS       CD      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LYS       CE      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "LYS       NZ      NH3     N         C        0.1617   1.7632   -1.35     -       -       -       SP3",
+  "LYS       HZ1     HC      N         P        0.0218   0.8773    0.45     H       NZ      -       N",
+  "LYS       HZ2     HC      N         P        0.0218   0.8773    0.45     H       NZ      -       N",
+  "LYS       HZ3     HC      N         P        0.0218   0.8773    0.45     H       NZ      -       N",
+  "LYS       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "LYS       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "MET       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "MET       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "MET       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "MET       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "MET       CG      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "MET       SD      S       N         NP1      0.1829   2.0171    0.00     -       -       -       N",
+  "MET       CE      CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "MET       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "MET       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "PHE       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "PHE       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "PHE       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PHE       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PHE       CG      CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "PHE       CD1     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "PHE       CD2     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "PHE       CE1     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "PHE       CE2     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "PHE       CZ      CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "PHE       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "PHE       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "PRO       N       N       Y         P        0.1617   1.7632    0.00     -       -       -       N",
+  "PRO       CD      CH2E    N         NP1      0.0616   0.8773    0.00     -       -       -       N",
+  "PRO       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PRO       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PRO       CG      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PRO       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "PRO       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "SER       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "SER       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "SER       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "SER       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "SER       OG      OH1     N         P        0.1617   1.7632   -0.49     A       CB      CA      SP3",
+  "SER       HG      H       N         P        0.0218   0.8773    0.49     H       OG      -       N",
+  "SER       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "SER       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "THR       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "THR       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "THR       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "THR       CB      CH1E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "THR       OG1     OH1     N         P        0.1617   1.7632   -0.49     A       CB      CA      SP3",
+  "THR       HG1     H       N         P        0.0218   0.8773    0.49     H       OG1     -       N",
+  "THR       CG2     CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "THR       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "THR       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "TRP       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "TRP       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "TRP       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "TRP       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "TRP       CG      C       N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       CD2     C       N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       CE2     C       N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       CE3     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       CD1     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       NE1     NH1     N         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "TRP       HE1     H       N         P        0.0218   0.8773    0.40     H       NE1     -       N",
+  "TRP       CZ2     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       CZ3     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       CH2     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TRP       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "TRP       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "TYR       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "TYR       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "TYR       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "TYR       CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "TYR       CG      C       N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TYR       CD1     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TYR       CD2     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TYR       CE1     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TYR       CE2     CR1E    N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TYR       CZ      C       N         NP2      0.1418   1.9859    0.00     -       -       -       N",
+  "TYR       OH      OH1     N         P        0.1617   1.7632   -0.49     A       CZ      CE1     SP2",
+  "TYR       HH      H       N         P        0.0218   0.8773    0.49     H       OH      -       N",
+  "TYR       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "TYR       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "VAL       N       NH1     Y         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "VAL       H       H       Y         P        0.0218   0.8773    0.40     H       N       -       N",
+  "VAL       CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "VAL       CB      CH1E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "VAL       CG1     CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "VAL       CG2     CH3E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "VAL       C       C       Y         NP1      0.1418   1.9649    0.55     -       -       -       N",
+  "VAL       O       O       Y         P        0.1617   1.5268   -0.55     A       C       CA      SP2",
+  "NTER      N       NH3     Y         P        0.1617   1.7632   -1.35     -       -       -       SP3",
+  "NTER      HT1     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "NTER      HT2     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "NTER      HT3     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "NTER      CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "GLYP      N       NH3     Y         P        0.1617   1.7632   -1.35     -       -       -       SP3",
+  "GLYP      HT1     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "GLYP      HT2     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "GLYP      HT3     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "GLYP      CA      CH2E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PROP      N       NH2     Y         P        0.1617   1.7632   -0.90     -       -       -       SP2",
+  "PROP      HT1     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "PROP      HT2     HC      Y         P        0.0218   0.8773    0.45     H       N       -       N",
+  "PROP      CA      CH1E    Y         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PROP      CD      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "CTER      C       C       Y         P        0.0946   1.9649    1.20     -       -       -       N",
+  "CTER      O       OC      Y         P        0.1619   1.4492   -0.60     A       C       CA      SP2",
+  "CTER      OXT     OC      Y         P        0.1619   1.4492   -0.60     A       C       CA      SP2",
+  "PSER      CB      CH2E    N         NP1      0.0626   2.0112    0.00     -       -       -       N",
+  "PSER      OG      O*      N         P        0.1617   1.7632    0.00     A       CB      CA      SP3",
+  "PLYS      NZ      NH1     N         P        0.1617   1.7632   -0.40     -       -       -       SP2",
+  "PLYS      HZ1     H       N         P        0.0218   0.8773    0.40     H       NZ      -       N",
+};
+
+// top_polh19_prot.inp
+static const char* embeddedLines1[] = {
+  "* TOPOLOGY FILE FOR PROTEINS USING EXPLICIT HYDROGEN ATOMS: VERSION 19",
+  "*",
+  "   20    1",
+  "MASS  -1  H          1.00800",
+  "MASS  -1  HC         1.00800",
+  "MASS  -1  HA         1.00800",
+  "MASS  -1  HT         1.00800",
+  "MASS  -1  LP         0.00000",
+  "MASS  -1  CT        12.01100",
+  "MASS  -1  C         12.01100",
+  "MASS  -1  CH1E      13.01900",
+  "MASS  -1  CH2E      14.02700",
+  "MASS  -1  CH3E      15.03500",
+  "MASS  -1  CR1E      13.01900",
+  "MASS  -1  CM        12.01100",
+  "MASS  -1  N         14.00670",
+  "MASS  -1  NR        14.00670",
+  "MASS  -1  NP        14.00670",
+  "MASS  -1  NH1       14.00670",
+  "MASS  -1  NH2       14.00670",
+  "MASS  -1  NH3       14.00670",
+  "MASS  -1  NC2       14.00670",
+  "MASS  -1  O         15.99940",
+  "MASS  -1  OC        15.99940",
+  "MASS  -1  OH1       15.99940",
+  "MASS  -1  OH2       15.99940",
+  "MASS  -1  OM        15.99940",
+  "MASS  -1  OT        15.99940",
+  "MASS  -1  OS        15.99940",
+  "MASS  -1  S         32.06000",
+  "MASS  -1  SH1E      33.06800",
+  "MASS  -1  FE        55.84700",
+  "DECL -C",
+  "DECL -O",
+  "DECL +N",
+  "DECL +H",
+  "DECL +CA",
+  "AUTOGENERATE ANGLES",
+  "DEFA FIRS NTER LAST CTER",
+  "RESI ALA     0.00000",
+  "GROUP",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROUP",
+  "ATOM CB   CH3E    0.00",
+  "GROUP",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "IMPR N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "DONO  H  N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3551 126.4900  180.0000 115.4200  0.9996",
+  "IC -C   N    CA   C     1.3551 126.4900  180.0000 114.4400  1.5390",
+  "IC N    CA   C    +N    1.4592 114.4400  180.0000 116.8400  1.3558",
+  "IC +N   CA   *C   O     1.3558 116.8400  180.0000 122.5200  1.2297",
+  "IC CA   C    +N   +CA   1.5390 116.8400  180.0000 126.7700  1.4613",
+  "IC N    C    *CA  CB    1.4592 114.4400  123.2300 111.0900  1.5461",
+  "RESI ARG     1.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   CH2E    0.00",
+  "GROU",
+  "ATOM CD   CH2E    0.10",
+  "ATOM NE   NH1    -0.40",
+  "ATOM HE   H       0.30",
+  "ATOM CZ   C       0.50",
+  "GROU",
+  "ATOM NH1  NC2    -0.45",
+  "ATOM HH11 HC      0.35",
+  "ATOM HH12 HC      0.35",
+  "GROU",
+  "ATOM NH2  NC2    -0.45",
+  "ATOM HH21 HC      0.35",
+  "ATOM HH22 HC      0.35",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD        CD   NE        NE   HE",
+  "BOND NE   CZ        CZ   NH1       CZ   NH2       NH1  HH11      NH1  HH12",
+  "BOND NH2  HH21      NH2  HH22",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD        CB   CG   CD   NE",
+  "DIHE CG   CD   NE   CZ        CD   NE   CZ   NH1       NE   CZ   NH1  HH11",
+  "DIHE NE   CZ   NH2  HH21      NE   CZ   NH1  HH12      NE   CZ   NH2  HH22",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH NE   CD   CZ   HE        CZ   NH1  NH2  NE",
+  "DONO  H N",
+  "DONO  HE NE",
+  "DONO  HH11 NH1",
+  "DONO  HH12 NH1",
+  "DONO  HH21 NH2",
+  "DONO  HH22 NH2",
+  "ACCE O C",
+  "IC -C   CA   *N   H     1.3496 122.4500  180.0000 116.6700  0.9973",
+  "IC -C   N    CA   C     1.3496 122.4500  180.0000 109.8600  1.5227",
+  "IC N    CA   C    +N    1.4544 109.8600  180.0000 117.1200  1.3511",
+  "IC +N   CA   *C   O     1.3511 117.1200  180.0000 121.4000  1.2271",
+  "IC CA   C    +N   +CA   1.5227 117.1200  180.0000 124.6700  1.4565",
+  "IC N    C    *CA  CB    1.4544 109.8600  123.6400 112.2600  1.5552",
+  "IC N    CA   CB   CG    1.4544 110.7000  180.0000 115.9500  1.5475",
+  "IC CA   CB   CG   CD    1.5552 115.9500  180.0000 114.0100  1.5384",
+  "IC CB   CG   CD   NE    1.5475 114.0100  180.0000 107.0900  1.5034",
+  "IC CG   CD   NE   CZ    1.5384 107.0900  180.0000 123.0500  1.3401",
+  "IC CZ   CD   *NE  HE    1.3401 123.0500  180.0000 113.1400  1.0065",
+  "IC CD   NE   CZ   NH1   1.5034 123.0500  180.0000 118.0600  1.3311",
+  "IC NE   CZ   NH1  HH11  1.3401 118.0600 -178.2800 120.6100  0.9903",
+  "IC HH11 CZ   *NH1 HH12  0.9903 120.6100  171.1900 116.2900  1.0023",
+  "IC NH1  NE   *CZ  NH2   1.3311 118.0600  178.6400 122.1400  1.3292",
+  "IC NE   CZ   NH2  HH21  1.3401 122.1400 -174.1400 119.9100  0.9899",
+  "IC HH21 CZ   *NH2 HH22  0.9899 119.9100  166.1600 116.8800  0.9914",
+  "RESI ASN     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "GROU",
+  "ATOM CG   C       0.55",
+  "ATOM OD1  O      -0.55",
+  "GROU",
+  "ATOM ND2  NH2    -0.60",
+  "ATOM HD21 H       0.30",
+  "ATOM HD22 H       0.30",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   OD1       CG   ND2       ND2  HD21",
+  "BOND ND2  HD22",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   OD1       CB   CG   ND2  HD21",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   OD1  ND2  CB        ND2  HD21 HD22 CG",
+  "DONO  H N",
+  "DONO  HD21 ND2",
+  "DONO  HD22 ND2",
+  "ACCE OD1 CG",
+  "ACCE O C",
+  "IC -C   CA   *N   H     1.3480 124.0500  180.0000 114.4900  0.9992",
+  "IC -C   N    CA   C     1.3480 124.0500  180.0000 105.2300  1.5245",
+  "IC N    CA   C    +N    1.4510 105.2300  180.0000 117.3800  1.3467",
+  "IC +N   CA   *C   O     1.3467 117.3800  180.0000 120.3200  1.2282",
+  "IC CA   C    +N   +CA   1.5245 117.3800  180.0000 124.8800  1.4528",
+  "IC N    C    *CA  CB    1.4510 105.2300  121.1800 113.0400  1.5627",
+  "IC N    CA   CB   CG    1.4510 110.9100  180.0000 114.3000  1.5319",
+  "IC CA   CB   CG   OD1   1.5627 114.3000  180.0000 122.5600  1.2323",
+  "IC OD1  CB   *CG  ND2   1.2323 122.5600 -179.1900 116.1500  1.3521",
+  "IC CB   CG   ND2  HD21  1.5319 116.1500 -179.2600 117.3500  0.9963",
+  "IC HD21 CG   *ND2 HD22  0.9963 117.3500  178.0200 120.0500  0.9951",
+  "RESI ASP    -1.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E   -0.16",
+  "ATOM CG   C       0.36",
+  "ATOM OD1  OC     -0.60",
+  "ATOM OD2  OC     -0.60",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   OD1       CG   OD2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   OD1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   OD1  OD2  CB",
+  "DONO  H     N",
+  "ACCE OD1  CG",
+  "ACCE OD2  CG",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3465 125.3100  180.0000 112.9400  0.9966",
+  "IC -C   N    CA   C     1.3465 125.3100  180.0000 105.6300  1.5315",
+  "IC N    CA   C    +N    1.4490 105.6300  180.0000 117.0600  1.3478",
+  "IC +N   CA   *C   O     1.3478 117.0600  180.0000 120.7100  1.2330",
+  "IC CA   C    +N   +CA   1.5315 117.0600  180.0000 125.3900  1.4484",
+  "IC N    C    *CA  CB    1.4490 105.6300  122.3300 114.1000  1.5619",
+  "IC N    CA   CB   CG    1.4490 111.1000  180.0000 112.6000  1.5218",
+  "IC CA   CB   CG   OD1   1.5619 112.6000  180.0000 117.9900  1.2565",
+  "IC OD1  CB   *CG  OD2   1.2565 117.9900 -170.2300 117.7000  1.2541",
+  "RESI CYS     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.19",
+  "ATOM SG   SH1E   -0.19",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   SG",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   SG",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "DONO  H     N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3479 123.9300  180.0000 114.7700  0.9982",
+  "IC -C   N    CA   C     1.3479 123.9300  180.0000 105.8900  1.5202",
+  "IC N    CA   C    +N    1.4533 105.8900  180.0000 118.3000  1.3498",
+  "IC +N   CA   *C   O     1.3498 118.3000  180.0000 120.5900  1.2306",
+  "IC CA   C    +N   +CA   1.5202 118.3000  180.0000 124.5000  1.4548",
+  "IC N    C    *CA  CB    1.4533 105.8900  121.7900 111.9800  1.5584",
+  "IC N    CA   CB   SG    1.4533 111.5600  180.0000 113.8700  1.8359",
+  "RESI GLN     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   CH2E    0.00",
+  "GROU",
+  "ATOM CD   C       0.55",
+  "ATOM OE1  O      -0.55",
+  "GROU",
+  "ATOM NE2  NH2    -0.60",
+  "ATOM HE21 H       0.30",
+  "ATOM HE22 H       0.30",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD        CD   OE1       CD   NE2",
+  "BOND NE2  HE21      NE2  HE22",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD        CB   CG   CD   OE1",
+  "DIHE CG   CD   NE2  HE21",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CD   OE1  NE2  CG        NE2  HE21 HE22 CD",
+  "DONO  H     N",
+  "DONO  HE21  NE2",
+  "DONO  HE22  NE2",
+  "ACCE OE1  CD",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3477 123.9300  180.0000 114.4500  0.9984",
+  "IC -C   N    CA   C     1.3477 123.9300  180.0000 106.5700  1.5180",
+  "IC N    CA   C    +N    1.4506 106.5700  180.0000 117.7200  1.3463",
+  "IC +N   CA   *C   O     1.3463 117.7200  180.0000 120.5900  1.2291",
+  "IC CA   C    +N   +CA   1.5180 117.7200  180.0000 124.3500  1.4461",
+  "IC N    C    *CA  CB    1.4506 106.5700  121.9100 111.6800  1.5538",
+  "IC N    CA   CB   CG    1.4506 111.4400  180.0000 115.5200  1.5534",
+  "IC CA   CB   CG   CD    1.5538 115.5200  180.0000 112.5000  1.5320",
+  "IC CB   CG   CD   OE1   1.5534 112.5000  180.0000 121.5200  1.2294",
+  "IC OE1  CG   *CD  NE2   1.2294 121.5200  179.5700 116.8400  1.3530",
+  "IC CG   CD   NE2  HE21  1.5320 116.8400 -179.7200 116.8600  0.9959",
+  "IC HE21 CD   *NE2 HE22  0.9959 116.8600 -178.9100 119.8300  0.9943",
+  "RESI GLU    -1.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "GROU",
+  "ATOM CG   CH2E   -0.16",
+  "ATOM CD   C       0.36",
+  "ATOM OE1  OC     -0.60",
+  "ATOM OE2  OC     -0.60",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD        CD   OE1       CD   OE2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD        CB   CG   CD   OE1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CD   OE1  OE2  CG",
+  "DONO  H     N",
+  "ACCE OE1  CD",
+  "ACCE OE2  CD",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3471 124.4500  180.0000 113.9900  0.9961",
+  "IC -C   N    CA   C     1.3471 124.4500  180.0000 107.2700  1.5216",
+  "IC N    CA   C    +N    1.4512 107.2700  180.0000 117.2500  1.3501",
+  "IC +N   CA   *C   O     1.3501 117.2500  180.0000 121.0700  1.2306",
+  "IC CA   C    +N   +CA   1.5216 117.2500  180.0000 124.3000  1.4530",
+  "IC N    C    *CA  CB    1.4512 107.2700  121.9000 111.7100  1.5516",
+  "IC N    CA   CB   CG    1.4512 111.0400  180.0000 115.6900  1.5557",
+  "IC CA   CB   CG   CD    1.5516 115.6900  180.0000 115.7300  1.5307",
+  "IC CB   CG   CD   OE1   1.5557 115.7300  180.0000 114.9900  1.2590",
+  "IC OE1  CG   *CD  OE2   1.2590 114.9900 -179.1000 120.0800  1.2532",
+  "RESI GLY     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH2E    0.10",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "IMPH N    -C   CA   H         C    CA   +N   O",
+  "DONO  H     N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3475 122.8200  180.0000 115.6200  0.9992",
+  "IC -C   N    CA   C     1.3475 122.8200  180.0000 108.9400  1.4971",
+  "IC N    CA   C    +N    1.4553 108.9400  180.0000 117.6000  1.3479",
+  "IC +N   CA   *C   O     1.3479 117.6000  180.0000 120.8500  1.2289",
+  "IC CA   C    +N   +CA   1.4971 117.6000  180.0000 124.0800  1.4560",
+  "PATC FIRS GLYP",
+  "RESI HSD     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "GROUP",
+  "ATOM CG   C       0.10",
+  "ATOM ND1  NH1    -0.40",
+  "ATOM HD1  H       0.30",
+  "GROU",
+  "ATOM CD2  CR1E    0.10",
+  "ATOM NE2  NR     -0.40",
+  "ATOM CE1  CR1E    0.30",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   ND1       CG   CD2       ND1  HD1",
+  "BOND ND1  CE1       CD2  NE2       CE1  NE2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   ND1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   ND1  CD2  CB        ND1  CG   CE1  HD1       CG   ND1  CE1  NE2",
+  "IMPH ND1  CE1  NE2  CD2       CE1  NE2  CD2  CG        NE2  CD2  CG   ND1",
+  "IMPH CD2  CG   ND1  CE1",
+  "DONO  H     N",
+  "DONO  HD1   ND1",
+  "ACCE NE2",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3475 123.2700  180.0000 115.2100  0.9988",
+  "IC -C   N    CA   C     1.3475 123.2700  180.0000 107.7000  1.5166",
+  "IC N    CA   C    +N    1.4521 107.7000  180.0000 117.5700  1.3509",
+  "IC +N   CA   *C   O     1.3509 117.5700  180.0000 120.2400  1.2273",
+  "IC CA   C    +N   +CA   1.5166 117.5700  180.0000 123.7200  1.4545",
+  "IC N    C    *CA  CB    1.4521 107.7000  122.4600 109.9900  1.5519",
+  "IC N    CA   CB   CG    1.4521 112.1200  180.0000 114.0500  1.5041",
+  "IC CA   CB   CG   ND1   1.5519 114.0500   90.0000 124.1000  1.3783",
+  "IC ND1  CB   *CG  CD2   1.3783 124.1000 -178.2600 129.6000  1.3597",
+  "IC CB   CG   ND1  CE1   1.5041 124.1000 -179.2000 107.0300  1.3549",
+  "IC CB   CG   CD2  NE2   1.5041 129.6000  178.6600 110.0300  1.3817",
+  "IC CE1  CG   *ND1 HD1   1.3549 107.0300  180.0000 126.2600  1.0005",
+  "RESI HSE     0.00000",
+  "GROUP",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "GROUP",
+  "ATOM CG   C       0.10",
+  "ATOM ND1  NR     -0.40",
+  "ATOM CE1  CR1E    0.30",
+  "GROU",
+  "ATOM CD2  CR1E    0.10",
+  "ATOM NE2  NH1    -0.40",
+  "ATOM HE2  H       0.30",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   ND1       CG   CD2       ND1  CE1",
+  "BOND CD2  NE2       CE1  NE2       NE2  HE2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   ND1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   ND1  CD2  CB        NE2  CE1  CD2  HE2       CG   ND1  CE1  NE2",
+  "IMPH ND1  CE1  NE2  CD2       CE1  NE2  CD2  CG        NE2  CD2  CG   ND1",
+  "IMPH CD2  CG   ND1  CE1",
+  "DONO  H     N",
+  "DONO  HE2   NE2",
+  "ACCE ND1",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3472 124.1600  180.0000 114.3600  0.9991",
+  "IC -C   N    CA   C     1.3472 124.1600  180.0000 106.4300  1.5166",
+  "IC N    CA   C    +N    1.4532 106.4300  180.0000 116.9700  1.3446",
+  "IC +N   CA   *C   O     1.3446 116.9700  180.0000 120.6800  1.2290",
+  "IC CA   C    +N   +CA   1.5166 116.9700  180.0000 124.9500  1.4505",
+  "IC N    C    *CA  CB    1.4532 106.4300  123.5200 111.6700  1.5578",
+  "IC N    CA   CB   CG    1.4532 112.8200  180.0000 116.9400  1.5109",
+  "IC CA   CB   CG   ND1   1.5578 116.9400   90.0000 120.1700  1.3859",
+  "IC ND1  CB   *CG  CD2   1.3859 120.1700 -178.2600 129.7100  1.3596",
+  "IC CB   CG   ND1  CE1   1.5109 120.1700 -179.2000 105.2000  1.3170",
+  "IC CB   CG   CD2  NE2   1.5109 129.7100  178.6600 105.8000  1.3782",
+  "IC CE1  CD2  *NE2 HE2   1.3539 107.1500 -178.6900 125.8600  0.9996",
+  "RESI HSP     1.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.10",
+  "ATOM CG   C       0.15",
+  "ATOM CD2  CR1E    0.20",
+  "GROU",
+  "ATOM ND1  NH1    -0.30",
+  "ATOM HD1  H       0.35",
+  "GROU",
+  "ATOM CE1  CR1E    0.45",
+  "GROU",
+  "ATOM NE2  NH1    -0.30",
+  "ATOM HE2  H       0.35",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   ND1       CG   CD2       ND1  HD1",
+  "BOND ND1  CE1       CD2  NE2       CE1  NE2	  NE2	HE2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   ND1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   ND1  CD2  CB        ND1  CG   CE1  HD1       CG   ND1  CE1  NE2",
+  "IMPH ND1  CE1  NE2  CD2       CE1  NE2  CD2  CG        NE2  CD2  CG   ND1",
+  "IMPH CD2  CG   ND1  CE1       NE2  CD2  CE1  HE2",
+  "DONO  H     N",
+  "DONO  HD1   ND1",
+  "DONO  HE2   NE2",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3489 123.9300  180.0000 118.8000  1.0041",
+  "IC -C   N    CA   C     1.3489 123.9300  180.0000 112.0300  1.5225",
+  "IC N    CA   C    +N    1.4548 112.0300  180.0000 116.4900  1.3464",
+  "IC +N   CA   *C   O     1.3464 116.4900  180.0000 121.2000  1.2284",
+  "IC CA   C    +N   +CA   1.5225 116.4900  180.0000 124.2400  1.4521",
+  "IC N    C    *CA  CB    1.4548 112.0300  125.1300 109.3800  1.5533",
+  "IC N    CA   CB   CG    1.4548 112.2500  180.0000 114.1800  1.5168",
+  "IC CA   CB   CG   ND1   1.5533 114.1800   90.0000 122.9400  1.3718",
+  "IC ND1  CB   *CG  CD2   1.3718 122.9400 -178.2600 128.9300  1.3549",
+  "IC CB   CG   ND1  CE1   1.5168 122.9400 -179.2000 108.9000  1.3262",
+  "IC CB   CG   CD2  NE2   1.5168 128.9300  178.6600 106.9300  1.3727",
+  "IC CE1  CD2  *NE2 HE2   1.3256 108.8200 -178.6900 125.5200  1.0020",
+  "IC CE1  CG   *ND1 HD1   1.3262 108.9000  180.0000 126.0900  1.0018",
+  "RESI ILE     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH1E    0.00",
+  "ATOM CG2  CH3E    0.00",
+  "GROU",
+  "ATOM CG1  CH2E    0.00",
+  "ATOM CD   CH3E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG1       CB   CG2       CG1  CD",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG1       CA   CB   CG1  CD",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CB   CG1  CG2  CA",
+  "DONO  H     N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3470 124.1600  180.0000 114.1900  0.9978",
+  "IC -C   N    CA   C     1.3470 124.1600  180.0000 106.3500  1.5190",
+  "IC N    CA   C    +N    1.4542 106.3500  180.0000 117.9700  1.3465",
+  "IC +N   CA   *C   O     1.3465 117.9700  180.0000 120.5900  1.2300",
+  "IC CA   C    +N   +CA   1.5190 117.9700  180.0000 124.2100  1.4467",
+  "IC N    C    *CA  CB    1.4542 106.3500  124.2200 112.9300  1.5681",
+  "IC N    C    *CA  HA    1.4542 106.3500 -115.6300 106.8100  1.0826",
+  "IC N    CA   CB   CG1   1.4542 112.7900  180.0000 113.6300  1.5498",
+  "IC CG1  CA   *CB  CG2   1.5498 113.6300 -130.0400 113.9300  1.5452",
+  "IC CA   CB   CG1  CD    1.5681 113.6300  180.0000 114.0900  1.5381",
+  "RESI LEU     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   CH1E    0.00",
+  "ATOM CD1  CH3E    0.00",
+  "ATOM CD2  CH3E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD1       CG   CD2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD2",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   CD2  CD1  CB",
+  "DONO  H     N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3474 124.3100  180.0000 114.2600  0.9979",
+  "IC -C   N    CA   C     1.3474 124.3100  180.0000 106.0500  1.5184",
+  "IC N    CA   C    +N    1.4508 106.0500  180.0000 117.9300  1.3463",
+  "IC +N   CA   *C   O     1.3463 117.9300  180.0000 120.5600  1.2299",
+  "IC CA   C    +N   +CA   1.5184 117.9300  180.0000 124.2600  1.4467",
+  "IC N    C    *CA  CB    1.4508 106.0500  121.5200 112.1200  1.5543",
+  "IC N    CA   CB   CG    1.4508 111.1900  180.0000 117.4600  1.5472",
+  "IC CA   CB   CG   CD1   1.5543 117.4600  180.0000 110.4800  1.5361",
+  "IC CD1  CB   *CG  CD2   1.5361 110.4800  120.0000 112.5700  1.5360",
+  "RESI LYS     1.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   CH2E    0.00",
+  "ATOM CD   CH2E    0.00",
+  "GROU",
+  "ATOM CE   CH2E    0.25",
+  "ATOM NZ   NH3    -0.30",
+  "ATOM HZ1  HC      0.35",
+  "ATOM HZ2  HC      0.35",
+  "ATOM HZ3  HC      0.35",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD        CD   CE        CE   NZ",
+  "BOND NZ   HZ1       NZ   HZ2       NZ   HZ3",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD        CB   CG   CD   CE",
+  "DIHE CG   CD   CE   NZ        CD   CE   NZ   HZ1       CD   CE   NZ   HZ2",
+  "DIHE CD   CE   NZ   HZ3",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "DONO  H     N",
+  "DONO  HZ1   NZ",
+  "DONO  HZ2   NZ",
+  "DONO  HZ3   NZ",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3482 123.5700  180.0000 115.1100  0.9988",
+  "IC -C   N    CA   C     1.3482 123.5700  180.0000 107.2900  1.5187",
+  "IC N    CA   C    +N    1.4504 107.2900  180.0000 117.2700  1.3478",
+  "IC +N   CA   *C   O     1.3478 117.2700  180.0000 120.7900  1.2277",
+  "IC CA   C    +N   +CA   1.5187 117.2700  180.0000 124.9100  1.4487",
+  "IC N    C    *CA  CB    1.4504 107.2900  122.2300 111.3600  1.5568",
+  "IC N    CA   CB   CG    1.4504 111.4700  180.0000 115.7600  1.5435",
+  "IC CA   CB   CG   CD    1.5568 115.7600  180.0000 113.2800  1.5397",
+  "IC CB   CG   CD   CE    1.5435 113.2800  180.0000 112.3300  1.5350",
+  "IC CG   CD   CE   NZ    1.5397 112.3300  180.0000 110.4600  1.4604",
+  "IC CD   CE   NZ   HZ1   1.5350 110.4600  179.9200 110.0200  1.0404",
+  "IC HZ1  CE   *NZ  HZ2   1.0404 110.0200  120.2700 109.5000  1.0402",
+  "IC HZ1  CE   *NZ  HZ3   1.0404 110.0200 -120.1300 109.4000  1.0401",
+  "RESI MET     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "GROU",
+  "ATOM CG   CH2E    0.06",
+  "ATOM SD   S      -0.12",
+  "ATOM CE   CH3E    0.06",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   SD        SD   CE",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   SD        CB   CG   SD   CE",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "DONO  H     N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3478 124.2100  180.0000 114.3900  0.9978",
+  "IC -C   N    CA   C     1.3478 124.2100  180.0000 106.3100  1.5195",
+  "IC N    CA   C    +N    1.4510 106.3100  180.0000 117.7400  1.3471",
+  "IC +N   CA   *C   O     1.3471 117.7400  180.0000 120.6400  1.2288",
+  "IC CA   C    +N   +CA   1.5195 117.7400  180.0000 124.5200  1.4471",
+  "IC N    C    *CA  CB    1.4510 106.3100  121.6200 111.8800  1.5546",
+  "IC N    CA   CB   CG    1.4510 111.2500  180.0000 115.9200  1.5460",
+  "IC CA   CB   CG   SD    1.5546 115.9200  180.0000 110.2800  1.8219",
+  "IC CB   CG   SD   CE    1.5460 110.2800  180.0000  98.9400  1.8206",
+  "RESI PHE     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   C       0.00    CZ",
+  "ATOM CD1  CR1E    0.00    CE2",
+  "ATOM CD2  CR1E    0.00    CE1",
+  "GROU",
+  "ATOM CE1  CR1E    0.00",
+  "ATOM CE2  CR1E    0.00",
+  "ATOM CZ   CR1E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD1       CG   CD2       CD1  CE1",
+  "BOND CD2  CE2       CE1  CZ        CE2  CZ",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   CD1  CE1  CZ        CD1  CE1  CZ   CE2       CE1  CZ   CE2  CD2",
+  "IMPH CZ   CE2  CD2  CG        CE2  CD2  CG   CD1       CD2  CG   CD1  CE1",
+  "IMPH CG   CD1  CD2  CB",
+  "DONO  H     N",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3476 123.8900  180.0000 114.4700  0.9987",
+  "IC -C   N    CA   C     1.3476 123.8900  180.0000 106.3800  1.5229",
+  "IC N    CA   C    +N    1.4504 106.3800  180.0000 117.6500  1.3483",
+  "IC +N   CA   *C   O     1.3483 117.6500  180.0000 120.4900  1.2287",
+  "IC CA   C    +N   +CA   1.5229 117.6500  180.0000 124.1000  1.4523",
+  "IC N    C    *CA  CB    1.4504 106.3800  122.4900 112.4500  1.5594",
+  "IC N    CA   CB   CG    1.4504 111.6300  180.0000 112.7600  1.5109",
+  "IC CA   CB   CG   CD1   1.5594 112.7600   90.0000 120.3200  1.4059",
+  "IC CD1  CB   *CG  CD2   1.4059 120.3200 -177.9600 120.7600  1.4062",
+  "IC CB   CG   CD1  CE1   1.5109 120.3200 -177.3700 120.6300  1.4006",
+  "IC CB   CG   CD2  CE2   1.5109 120.7600  177.2000 120.6200  1.4002",
+  "IC CG   CD1  CE1  CZ    1.4059 120.6300   -0.1200 119.9300  1.4004",
+  "RESI PRO     0.00000",
+  "GROU",
+  "ATOM N    N      -0.20",
+  "ATOM CD   CH2E    0.10",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   CH2E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    CD",
+  "BOND CA   CB        CB   CG        CG   CD",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD        CB   CG   CD   N",
+  "DIHE CG   CD   N    CA",
+  "IMPH N    CA   CD   -C        C    CA   +N   O         CA   N    C    CB",
+  "ACCE O  C",
+  "IC -C   CA   *N   CD    1.3366 122.9400  178.5100 112.7500  1.4624",
+  "IC -C   N    CA   C     1.3366 122.9400  -76.1200 110.8600  1.5399",
+  "IC N    CA   C    +N    1.4585 110.8600  180.0000 114.7500  1.3569",
+  "IC +N   CA   *C   O     1.3569 114.7500  177.1500 120.4600  1.2316",
+  "IC CA   C    +N   +CA   1.5399 116.1200  180.0000 124.8900  1.4517",
+  "IC N    C    *CA  CB    1.4585 110.8600  113.7400 111.7400  1.5399",
+  "IC N    CA   CB   CG    1.4585 102.5600   31.6100 104.3900  1.5322",
+  "IC CA   CB   CG   CD    1.5399 104.3900  -34.5900 103.2100  1.5317",
+  "PATCHING FIRS PROP",
+  "RESI SER     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.25",
+  "ATOM OG   OH1    -0.65",
+  "ATOM HG   H       0.40",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   OG        OG   HG",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   OG        CA   CB   OG   HG",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "DONO  H     N",
+  "DONO  HG    OG",
+  "ACCE OG",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3474 124.3700  180.0000 114.1800  0.9999",
+  "IC -C   N    CA   C     1.3474 124.3700  180.0000 105.8100  1.5166",
+  "IC N    CA   C    +N    1.4579 105.8100  180.0000 117.7200  1.3448",
+  "IC +N   CA   *C   O     1.3448 117.7200  180.0000 120.2500  1.2290",
+  "IC CA   C    +N   +CA   1.5166 117.7200  180.0000 124.6300  1.4529",
+  "IC N    C    *CA  CB    1.4579 105.8100  124.7500 111.4000  1.5585",
+  "IC N    CA   CB   OG    1.4579 114.2800  180.0000 112.4500  1.4341",
+  "IC CA   CB   OG   HG    1.5585 112.4500  165.9600 107.0800  0.9655",
+  "RESI THR     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH1E    0.25",
+  "ATOM OG1  OH1    -0.65",
+  "ATOM HG1  H       0.40",
+  "GROU",
+  "ATOM CG2  CH3E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   OG1       CB   CG2       OG1  HG1",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   OG1       CA   CB   OG1  HG1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CB   OG1  CG2  CA",
+  "DONO  H     N",
+  "DONO  HG1  OG1",
+  "ACCE OG1",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3471 124.1200  180.0000 114.2600  0.9995",
+  "IC -C   N    CA   C     1.3471 124.1200  180.0000 106.0900  1.5162",
+  "IC N    CA   C    +N    1.4607 106.0900  180.0000 117.6900  1.3449",
+  "IC +N   CA   *C   O     1.3449 117.6900  180.0000 120.3000  1.2294",
+  "IC CA   C    +N   +CA   1.5162 117.6900  180.0000 124.6600  1.4525",
+  "IC N    C    *CA  CB    1.4607 106.0900  126.4600 112.7400  1.5693",
+  "IC N    CA   CB   OG1   1.4607 114.8100  180.0000 112.1600  1.4252",
+  "IC OG1  CA   *CB  CG2   1.4252 112.1600 -124.1300 115.9100  1.5324",
+  "IC CA   CB   OG1  HG1   1.5693 112.1600 -179.2800 105.4500  0.9633",
+  "RESI TRP     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "GROU",
+  "ATOM CG   C      -0.03     CD1  CD2  NE1  CE2  CE3  CZ2  CZ3  CH2",
+  "ATOM CD2  C       0.10     NE1  CE2  CE3  CZ2  CZ3  CH2",
+  "ATOM CE2  C      -0.04     CE3  CZ2  CZ3  CH2",
+  "ATOM CE3  CR1E   -0.03     CZ2  CZ3  CH2",
+  "GROU",
+  "ATOM CD1  CR1E    0.06     CD2  NE1  CE2  CE3  CZ2  CZ3  CH2",
+  "ATOM NE1  NH1    -0.36     CE2  CE3  CZ2  CZ3  CH2",
+  "ATOM HE1  H       0.30",
+  "GROU",
+  "ATOM CZ2  CR1E    0.00     CZ3  CH2",
+  "ATOM CZ3  CR1E    0.00     CH2",
+  "ATOM CH2  CR1E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD1       CG   CD2       CD1  NE1",
+  "BOND CD2  CE2       NE1  HE1       NE1  CE2       CD2  CE3       CE2  CZ2",
+  "BOND CE3  CZ3       CZ2  CH2       CZ3  CH2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD1",
+  "DIHE CD1  CE2  CD2  CZ3       CD1  CD2  CE2  CH2",
+  "DIHE CZ2  CE2  CD2  CG        CE3  CD2  CE2  NE1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   CD1  CD2  CB        NE1  CD1  CE2  HE1       CD2  CE2  CZ2  CH2",
+  "IMPH CE2  CZ2  CH2  CZ3       CZ2  CH2  CZ3  CE3       CH2  CZ3  CE3  CD2",
+  "IMPH CZ3  CE3  CD2  CE2       CE3  CD2  CE2  CZ2       CG   CD1  NE1  CE2",
+  "IMPH CD1  NE1  CE2  CD2       NE1  CE2  CD2  CG        CE2  CD2  CG   CD1",
+  "IMPH CD2  CG   CD1  NE1",
+  "DONO  H     N",
+  "DONO  HE1   NE1",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3482 123.5100  180.0000 115.0200  0.9972",
+  "IC -C   N    CA   C     1.3482 123.5100  180.0000 107.6900  1.5202",
+  "IC N    CA   C    +N    1.4507 107.6900  180.0000 117.5700  1.3505",
+  "IC +N   CA   *C   O     1.3505 117.5700  180.0000 121.0800  1.2304",
+  "IC CA   C    +N   +CA   1.5202 117.5700  180.0000 124.8800  1.4526",
+  "IC N    C    *CA  CB    1.4507 107.6900  122.6800 111.2300  1.5560",
+  "IC N    CA   CB   CG    1.4507 111.6800  180.0000 115.1400  1.5233",
+  "IC CA   CB   CG   CD2   1.5560 115.1400   90.0000 123.9500  1.4407",
+  "IC CD2  CB   *CG  CD1   1.4407 123.9500 -172.8100 129.1800  1.3679",
+  "IC CD1  CG   CD2  CE2   1.3679 106.5700   -0.0800 106.6500  1.4126",
+  "IC CG   CD2  CE2  NE1   1.4407 106.6500    0.1400 107.8700  1.3746",
+  "IC CE2  CG   *CD2 CE3   1.4126 106.6500  179.2100 132.5400  1.4011",
+  "IC CE2  CD2  CE3  CZ3   1.4126 120.8000   -0.2000 118.1600  1.4017",
+  "IC CD2  CE3  CZ3  CH2   1.4011 118.1600    0.1000 120.9700  1.4019",
+  "IC CE3  CZ3  CH2  CZ2   1.4017 120.9700    0.0100 120.8700  1.4030",
+  "IC CD1  CE2  *NE1 HE1   1.3752 108.8100  177.7800 124.6800  0.9767",
+  "RESI TYR     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH2E    0.00",
+  "ATOM CG   C       0.00    CZ",
+  "GROU",
+  "ATOM CD1  CR1E    0.00    CE2",
+  "ATOM CE1  CR1E    0.00    CD2",
+  "GROU",
+  "ATOM CD2  CR1E    0.00",
+  "ATOM CE2  CR1E    0.00",
+  "GROU",
+  "ATOM CZ   C       0.25",
+  "ATOM OH   OH1    -0.65",
+  "ATOM HH   H       0.40",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG        CG   CD1       CG   CD2       CD1  CE1",
+  "BOND CD2  CE2       CE1  CZ        CE2  CZ        CZ   OH        OH   HH",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG        CA   CB   CG   CD1       CE2  CZ   OH   HH",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CG   CD1  CD2  CB        CZ   CE1  CE2  OH        CG   CD1  CE1  CZ",
+  "IMPH CD1  CE1  CZ   CE2       CE1  CZ   CE2  CD2       CZ   CE2  CD2  CG",
+  "IMPH CE2  CD2  CG   CD1       CD2  CG   CD1  CE1",
+  "DONO  H     N",
+  "DONO  HH    OH",
+  "ACCE OH",
+  "ACCE O  C",
+  "IC -C   CA   *N   H     1.3476 123.8100  180.0000 114.5400  0.9986",
+  "IC -C   N    CA   C     1.3476 123.8100  180.0000 106.5200  1.5232",
+  "IC N    CA   C    +N    1.4501 106.5200  180.0000 117.3300  1.3484",
+  "IC +N   CA   *C   O     1.3484 117.3300  180.0000 120.6700  1.2287",
+  "IC CA   C    +N   +CA   1.5232 117.3300  180.0000 124.3100  1.4513",
+  "IC N    C    *CA  CB    1.4501 106.5200  122.2700 112.3400  1.5606",
+  "IC N    CA   CB   CG    1.4501 111.4300  180.0000 112.9400  1.5113",
+  "IC CA   CB   CG   CD1   1.5606 112.9400   90.0000 120.4900  1.4064",
+  "IC CD1  CB   *CG  CD2   1.4064 120.4900 -176.4600 120.4600  1.4068",
+  "IC CB   CG   CD1  CE1   1.5113 120.4900 -175.4900 120.4000  1.4026",
+  "IC CB   CG   CD2  CE2   1.5113 120.4600  175.3200 120.5600  1.4022",
+  "IC CG   CD1  CE1  CZ    1.4064 120.4000   -0.1900 120.0900  1.3978",
+  "IC CE1  CE2  *CZ  OH    1.3978 120.0500 -178.9800 120.2500  1.4063",
+  "IC CE1  CZ   OH   HH    1.3978 119.6800  175.4500 107.4700  0.9594",
+  "IC CD1  CE1  CZ   OH    1.4026 120.0900  180.0000 119.6800  1.4063",
+  "RESI VAL     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH1E    0.10",
+  "GROU",
+  "ATOM CB   CH1E    0.00",
+  "ATOM CG1  CH3E    0.00",
+  "ATOM CG2  CH3E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND N    CA        CA   C         C    +N        C    O         N    H",
+  "BOND CA   CB        CB   CG1       CB   CG2",
+  "DIHE -C   N    CA   C         N    CA   C    +N        CA   C    +N   +CA",
+  "DIHE N    CA   CB   CG1",
+  "IMPH N    -C   CA   H         C    CA   +N   O         CA   N    C    CB",
+  "IMPH CB   CG2  CG1  CA",
+  "DONO  H     N",
+  "ACCE O C",
+  "IC -C   CA   *N   H     1.3482 124.5700  180.0000 114.4100  0.9966",
+  "IC -C   N    CA   C     1.3482 124.5700  180.0000 105.5400  1.5180",
+  "IC N    CA   C    +N    1.4570 105.5400  180.0000 117.8300  1.3471",
+  "IC +N   CA   *C   O     1.3471 117.8300  180.0000 120.7000  1.2297",
+  "IC CA   C    +N   +CA   1.5180 117.8300  180.0000 124.0800  1.4471",
+  "IC N    C    *CA  CB    1.4570 105.5400  122.9500 111.2300  1.5660",
+  "IC N    CA   CB   CG1   1.4570 113.0500  180.0000 113.9700  1.5441",
+  "IC CG1  CA   *CB  CG2   1.5441 113.9700  123.9900 112.1700  1.5414",
+  "RESI HEME   -2.00000",
+  "GROU",
+  "ATOM FE   FE      0.24",
+  "ATOM NA   NP     -0.18",
+  "ATOM NB   NP     -0.18",
+  "ATOM NC   NP     -0.18",
+  "ATOM ND   NP     -0.18",
+  "GROU",
+  "ATOM C1A  C       0.03",
+  "ATOM CHA  CR1E    0.04",
+  "ATOM C4D  C       0.02",
+  "GROU",
+  "ATOM C1B  C       0.03",
+  "ATOM CHB  CR1E    0.04",
+  "ATOM C4A  C       0.02",
+  "GROU",
+  "ATOM C1C  C       0.03",
+  "ATOM CHC  CR1E    0.04",
+  "ATOM C4B  C       0.02",
+  "GROU",
+  "ATOM C1D  C       0.03",
+  "ATOM CHD  CR1E    0.04",
+  "ATOM C4C  C       0.02",
+  "GROU",
+  "ATOM C2A  C      -0.02",
+  "ATOM CAA  CH2E    0.04",
+  "GROU",
+  "ATOM C3A  C       0.02",
+  "ATOM CMA  CH3E   -0.04",
+  "GROU",
+  "ATOM CBA  CH2E   -0.10",
+  "ATOM CGA  C       0.30",
+  "ATOM O1A  OC     -0.50",
+  "ATOM O2A  OC     -0.50",
+  "GROU",
+  "ATOM C2B  C       0.02",
+  "ATOM CMB  CH3E   -0.04",
+  "GROU",
+  "ATOM C3B  C      -0.05",
+  "ATOM CAB  CR1E    0.03",
+  "ATOM CBB  CH2E   -0.10",
+  "GROU",
+  "ATOM C2C  C       0.02",
+  "ATOM CMC  CH3E   -0.04",
+  "GROU",
+  "ATOM C3C  C      -0.05",
+  "ATOM CAC  CR1E    0.03",
+  "ATOM CBC  CH2E   -0.10",
+  "GROU",
+  "ATOM C2D  C       0.02",
+  "ATOM CMD  CH3E   -0.04",
+  "GROU",
+  "ATOM C3D  C      -0.02",
+  "ATOM CAD  CH2E    0.04",
+  "GROU",
+  "ATOM CBD  CH2E   -0.10",
+  "ATOM CGD  C       0.30",
+  "ATOM O1D  OC     -0.50",
+  "ATOM O2D  OC     -0.50",
+  "BOND FE   NA        FE   NB        FE   NC        FE   ND        NA   C1A",
+  "BOND C1A  C2A       C2A  C3A       C3A  C4A       NA   C4A       C2A  CAA",
+  "BOND CAA  CBA       CBA  CGA       CGA  O1A       CGA  O2A       C3A  CMA",
+  "BOND CHB  C4A       CHB  C1B       NB   C1B       C1B  C2B       C2B  C3B",
+  "BOND C3B  C4B       NB   C4B       C2B  CMB       C3B  CAB       CAB  CBB",
+  "BOND CHC  C4B       CHC  C1C       NC   C1C       C1C  C2C       C2C  C3C",
+  "BOND C3C  C4C       NC   C4C       C2C  CMC       C3C  CAC       CAC  CBC",
+  "BOND CHD  C4C       CHD  C1D       ND   C1D       C1D  C2D       C2D  C3D",
+  "BOND C3D  C4D       ND   C4D       C2D  CMD       C3D  CAD       CAD  CBD",
+  "BOND CBD  CGD       CGD  O1D       CGD  O2D       CHA  C4D       CHA  C1A",
+  "DIHE NA   C4A  CHB  C1B       C4A  CHB  C1B  NB        NB   C4B  CHC  C1C",
+  "DIHE C4B  CHC  C1C  NC        NC   C4C  CHD  C1D       C4C  CHD  C1D  ND",
+  "DIHE ND   C4D  CHA  C1A       C4D  CHA  C1A  NA        C1A  C2A  CAA  CBA",
+  "DIHE C2A  CAA  CBA  CGA       CAA  CBA  CGA  O1A       C2B  C3B  CAB  CBB",
+  "DIHE C2C  C3C  CAC  CBC       C2D  C3D  CAD  CBD       C3D  CAD  CBD  CGD",
+  "DIHE CAD  CBD  CGD  O1D",
+  "IMPH FE   C1A  C4A  NA        FE   C1B  C4B  NB        FE   C1C  C4C  NC",
+  "IMPH FE   C1D  C4D  ND        CHA  NA   C2A  C1A       CHB  NA   C3A  C4A",
+  "IMPH CHB  NB   C2B  C1B       CHC  NB   C3B  C4B       CHC  NC   C2C  C1C",
+  "IMPH CHD  NC   C3C  C4C       CHD  ND   C2D  C1D       CHA  ND   C3D  C4D",
+  "IMPH C2A  C1A  C3A  CAA       C3A  C2A  C4A  CMA       C2B  C1B  C3B  CMB",
+  "IMPH C3B  C2B  C4B  CAB       C2C  C1C  C3C  CMC       C3C  C2C  C4C  CAC",
+  "IMPH C2D  C1D  C3D  CMD       C3D  C2D  C4D  CAD       CBA  O1A  O2A  CGA",
+  "IMPH CBD  O1D  O2D  CGD",
+  "ACCE NA",
+  "ACCE O1A CGA",
+  "ACCE O2A CGA",
+  "ACCE NB",
+  "ACCE NC",
+  "ACCE ND",
+  "ACCE O1D CGD",
+  "ACCE O2D CGD",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI ACE     0.00000",
+  "GROU",
+  "ATOM CH3  CH3E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND CH3  C         C    +N        C    O",
+  "DIHE CH3  C    +N   +CA",
+  "IMPH C    CH3  +N   O",
+  "ACCE O C",
+  "IC   +N   CH3  *C   O      0.0000    0.00  180.00    0.00   0.0000",
+  "IC   CH3  C    +N   +CA    0.0000    0.00  180.00    0.00   0.0000",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI FORM    0.00000",
+  "GROU",
+  "ATOM HA   HA      0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "GROU",
+  "ATOM N    NH2    -0.60",
+  "ATOM H1   H       0.30",
+  "ATOM H2   H       0.30",
+  "BOND HA   C         C     N        C    O",
+  "BOND N    H2        N    H1",
+  "DIHE HA   C     N    H2",
+  "IMPH C    HA    N   O",
+  "IMPH N     C   H2   H1",
+  "ACCE O  C",
+  "DONO  H1   N",
+  "IC    N   HA   *C   O      0.0000    0.00  180.00    0.00   0.0000",
+  "IC   HA   C     N    H2    0.0000    0.00  180.00    0.00   0.0000",
+  "IC    C   H2   *N   H1     0.0000    0.00  180.00    0.00   0.0000",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI AMN     0.00000",
+  "GROU",
+  "ATOM CL   CH3E    0.00",
+  "GROU",
+  "ATOM C    C       0.55",
+  "ATOM O    O      -0.55",
+  "BOND CL   C         C    +N        C    O",
+  "DIHE CL   C    +N   +CA",
+  "IMPH C    CL   +N   O",
+  "ACCE O C",
+  "IC   +N   CL   *C   O      0.0000    0.00  180.00    0.00   0.0000",
+  "IC   CL   C    +N   +CA    0.0000    0.00  180.00    0.00   0.0000",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI CBX     0.00000",
+  "GROU",
+  "ATOM N    NH1    -0.35",
+  "ATOM H    H       0.25",
+  "ATOM CA   CH3E    0.10",
+  "BOND N    CA        N    H",
+  "IMPH N    -C   CA   H",
+  "DONO  H    N",
+  "IC   -C   CA   *N   H      0.0000    0.00  180.00    0.00   0.0000",
+  "PATC  FIRS NONE LAST NONE",
+  "PRES NTER    1.00000",
+  "GROU",
+  "ATOM HT1  HC      0.35",
+  "ATOM HT2  HC      0.35",
+  "ATOM N    NH3    -0.30",
+  "ATOM HT3  HC      0.35",
+  "DELETE ATOM H",
+  "ATOM CA   CH1E    0.25",
+  "BOND HT1  N         HT2  N    HT3  N",
+  "DIHE HT2  N    CA   C         HT1  N    CA   C         HT3  N    CA   C",
+  "DONO  HT1   N",
+  "DONO  HT2   N",
+  "DONO  HT3   N",
+  "IC C    CA    N  HT1   1.5350 110.4600 179.9200 110.0200   1.0404",
+  "IC HT1  CA   *N  HT2   1.0404 110.0200  120.2700 109.5000  1.0402",
+  "IC HT1  CA   *N  HT3   1.0404 110.0200 -120.1300 109.4000  1.0401",
+  "PRES GLYP    1.00000",
+  "GROUP",
+  "ATOM HT1  HC      0.35",
+  "ATOM HT2  HC      0.35",
+  "ATOM N    NH3    -0.30",
+  "ATOM HT3  HC      0.35",
+  "DELETE ATOM H",
+  "ATOM CA   CH2E    0.25",
+  "BOND HT1  N         HT2  N    HT3  N",
+  "DIHE HT2  N    CA   C         HT1  N    CA   C         HT3  N    CA   C",
+  "DONO  HT1   N",
+  "DONO  HT2   N",
+  "DONO  HT3   N",
+  "IC C    CA    N  HT1   1.5350 110.4600  179.9200 110.0200  1.0404",
+  "IC HT1  CA   *N  HT2   1.0404 110.0200  120.2700 109.5000  1.0402",
+  "IC HT1  CA   *N  HT3   1.0404 110.0200 -120.1300 109.4000  1.0401",
+  "PRES PROP    1.00000",
+  "GROUP",
+  "ATOM HT1  HC      0.35",
+  "ATOM HT2  HC      0.35",
+  "ATOM N    NH3    -0.20",
+  "ATOM CD   CH2E    0.25",
+  "ATOM CA   CH1E    0.25",
+  "BOND HT1  N         HT2  N",
+  "DIHE HT2  N    CA   C         HT1  N    CA   C",
+  "DONO  HT1   N",
+  "DONO  HT2   N",
+  "IC  CA  CD  *N  HT1  0.0000  0.0000  120.0000  109.5000  1.0400",
+  "IC  CA  CD  *N  HT2  0.0000  0.0000 -120.0000  109.5000  1.0400",
+  "PRES CTER   -1.00000",
+  "GROU",
+  "ATOM C    C       0.14",
+  "ATOM OXT  OC     -0.57",
+  "ATOM O    OC     -0.57",
+  "DELETE ATOM O",
+  "BOND C    OXT       C    O",
+  "DIHE N    CA    C    O",
+  "IMPH C    CA    OT2  OXT",
+  "ACCE OXT C",
+  "ACCE O   C",
+  "IC N    CA   C    O     0.0000  0.0000  180.0000  114.9900  1.2590",
+  "IC O    CA   *C   OXT   0.0000  0.0000  180.0000  120.0800  1.2532",
+  "PRES PSER",
+  "ATOM   OG",
+  "ATOM   CB",
+  "DELETE ATOM HG1",
+  "PRES PLYS",
+  "ATOM   NZ",
+  "ATOM   HZ1",
+  "DELETE ATOM HZ2",
+  "DELETE ATOM HZ3",
+  "PRES LINK  0.0",
+  "BOND 1C   2N",
+  "THET 1C   2N   2CA            1CA  1C   2N",
+  "THET 1O   1C   2N             1C   2N   2H",
+  "DIHE 1C   2N   2CA  2C        1N   1CA  1C   2N        1CA  1C   2N   2CA",
+  "IMPH 2N   1C   2CA  2H        1C   1CA  2N   1O",
+  "IC   1N   1CA  1C   2N     0.0000    0.00  180.00    0.00   0.0000",
+  "IC   2N   1CA  *1C  1O     0.0000    0.00  180.00    0.00   0.0000",
+  "IC   1CA  1C   2N   2CA    0.0000    0.00  180.00    0.00   0.0000",
+  "IC   1C   2N   2CA  2C     0.0000    0.00  180.00    0.00   0.0000",
+  "IC   1C   2CA  *2N  2H     0.0000    0.00  180.00    0.00   0.0000",
+  "RESI O2      0.00000",
+  "GROUP",
+  "ATOM O1    OM      0.021",
+  "ATOM O2    OM     -0.021",
+  "BOND O1    O2",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI CO2P    0.00000",
+  "GROUP",
+  "ATOM C    CM      0.021",
+  "ATOM O    OM     -0.021",
+  "BOND C    O",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI CO      0.00000",
+  "GROUP",
+  "ATOM C    CM      0.021",
+  "ATOM O    OM     -0.021",
+  "BOND C    O",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI ETH     0.00000",
+  "GROU",
+  "ATOM C2   CH3E    0.00",
+  "GROU",
+  "ATOM C1   CH2E    0.25",
+  "ATOM O    OH1    -0.65",
+  "ATOM H    H       0.40",
+  "BOND C2   C1        C1   O         O    H",
+  "DIHE C2   C1   O    H",
+  "DONO  H     O",
+  "ACCE O",
+  "IC   C2   C1   O    H      0.0000    0.00  180.00    0.00   0.0000",
+  "IC   C1   O    H    BLNK   0.0000    0.00    0.00    0.00   0.0000",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI ST2     .000",
+  "GROUP",
+  "ATOM OX2  OH2     .00",
+  "ATOM HX1  H       .24",
+  "ATOM HX2  H       .24",
+  "ATOM LX1  LP     -.24",
+  "ATOM LX2  LP     -.24",
+  "BOND OX2  HX1       OX2  HX2",
+  "BOND OX2  LX1       OX2  LX2",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI TIP3    .000",
+  "GROUP",
+  "ATOM OH2  OT     -0.834",
+  "ATOM H1   HT      0.417",
+  "ATOM H2   HT      0.417",
+  "BOND OH2  H1        OH2  H2        H1   H2",
+  "ANGLE  H1 OH2 H2",
+  "ACCE OH2",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI OH2    .000",
+  "GROUP",
+  "ATOM OH2  OT     -0.834",
+  "ATOM H1   HT      0.417",
+  "ATOM H2   HT      0.417",
+  "BOND OH2  H1        OH2  H2        H1   H2",
+  "ANGLE  H1 OH2 H2",
+  "ACCE OH2",
+  "PATC  FIRS NONE LAST NONE",
+  "RESI SO4  -2.0",
+  "GROUP",
+  "ATOM S    S     0.0",
+  "ATOM O1   OC   -0.5",
+  "ATOM O2   OC   -0.5",
+  "ATOM O3   OC   -0.5",
+  "ATOM O4   OC   -0.5",
+  "BOND S O1    S O2    S O3    S O4",
+  "ACCE O1  S",
+  "ACCE O2  S",
+  "ACCE O3  S",
+  "ACCE O4  S",
+  "PATC FIRS NONE LAST NONE",
+  "RESI COH     0.00000",
+  "GROU",
+  "ATOM C    CH3E    0.25",
+  "ATOM O    OH1    -0.65",
+  "ATOM H    H       0.40",
+  "BOND  C    O         O    H",
+  "DONO  H    O",
+  "ACCE O",
+  "IC   C    O    H    BLNK   0.0000    0.00    0.00    0.00   0.0000",
+  "PATC  FIRS NONE LAST NONE",
+  "PRES DISU 0.000",
+  "GROUP",
+  "ATOM 1CB  CH2E  0.19",
+  "ATOM 1SG  S    -0.19",
+  "GROUP",
+  "ATOM 2SG  S    -0.19",
+  "ATOM 2CB  CH2E  0.19",
+  "BOND 1SG 2SG",
+  "ANGLE  1CB 1SG 2SG      1SG 2SG 2CB",
+  "DIHE   1CA 1CB 1SG 2SG      1CB 1SG 2SG 2CB    1SG 2SG 2CB 2CA",
+  "IC     1CA 1CB 1SG 2SG    0.0  0.0  180.0  0.0  0.0",
+  "IC     1CB 1SG 2SG 2CB    0.0  0.0  180.0  0.0  0.0",
+  "IC     1SG 2SG 2CB 2CA    0.0  0.0  180.0  0.0  0.0",
+  "PRES FHEM 0.0",
+  "DELETE ANGLE 2NA 2FE 2NC  2NB 2FE 2ND",
+  "PRES PHEM  0.0",
+  "BOND 1NE2 2FE",
+  "ANGL 1CD2  1NE2  2FE    1CE1  1NE2  2FE    1NE2  2FE  2NA    1NE2  2FE  2NB",
+  "ANGL 1NE2  2FE   2NC    1NE2  2FE   2ND",
+  "DELETE ANGLE 2NA 2FE 2NC  2NB 2FE 2ND",
+  "DIHE 1CD2  1NE2  2FE  2NA",
+  "PRES PLO2 0.0",
+  "BOND 1O1  2FE",
+  "ANGL 1O2  1O1  2FE    1O1  2FE  2NA    1O1  2FE  2NB",
+  "ANGL 1O1  2FE  2NC     1O1  2FE 2ND",
+  "DIHE 1O2  1O1  2FE  2NA",
+  "PRES PLIG 0.0",
+  "BOND 1C  2FE",
+  "ANGL 1O  1C  2FE    1C  2FE  2NA    1C  2FE  2NB",
+  "ANGL 1C  2FE  2NC     1C  2FE 2ND",
+  "DIHE 1O  1C  2FE  2NA",
+  "PRES LTOD 0.0",
+  "DELE IMPR 1CA 1N 1C 1CB",
+  "IMPR 1CA 1C 1N 1CB",
+  "PRES HS2          0.00",
+  "GROUP",
+  "ATOM CG   C       0.10",
+  "ATOM ND1  NR     -0.40",
+  "ATOM CE1  CR1E    0.30",
+  "GROU",
+  "ATOM CD2  CR1E    0.10",
+  "ATOM NE2  NH1    -0.40",
+  "ATOM HE2  H       0.30",
+  "DELETE ATOM HD1",
+  "DELETE ACCE NE2",
+  "BOND NE2 HE2",
+  "ANGLE  CE1 NE2 HE2 CD2 NE2 HE2",
+  "IMPR NE2 CE1 CD2 HE2",
+  "DONOR HE2 NE2",
+  "ACCEPTOR ND1",
+  "IC CE1  CD2  *NE2 HE2   0.0000  0.0000  180.0000  0.0000  0.0000",
+  "END",
+};
+
+// rotlib984.txt
+static const char* embeddedLines2[] = {
+  "ALA",
+  "CYS     -69.4",
+  "CYS     179.3",
+  "CYS      72.7",
+  "CYS    -126.3",
+  "ASP     -68.2  -20.4",
+  "ASP    -176.9   34.5",
+  "ASP    -173.1  -18.1",
+  "ASP      64.9   -4.9",
+  "ASP     -53.9  -86.5",
+  "ASP      58.0   48.2",
+  "ASP     -80.5   15.9",
+  "ASP     175.4  -73.3",
+  "ASP      65.5   -0.7",
+  "ASP      74.3  -63.2",
+  "ASP    -115.0  -73.4",
+  "ASP    -124.5   21.0",
+  "ASP      25.8  -76.0",
+  "ASP     -38.1   32.4",
+  "ASP    -117.2  -22.0",
+  "ASP     141.7   43.0",
+  "ASP     -25.2  -39.9",
+  "ASP     133.5  -70.6",
+  "ASP     143.7  -11.2",
+  "GLU     -65.0  175.5  -16.5",
+  "GLU     -56.8  -56.8  -58.4",
+  "GLU     -78.3  170.4   15.6",
+  "GLU     -82.2 -158.7   83.4",
+  "GLU     164.2  175.7    1.6",
+  "GLU    -179.1  177.4   -6.9",
+  "GLU     174.4   64.8   24.8",
+  "GLU     177.4  150.8   67.4",
+  "GLU     -76.2   85.3    2.7",
+  "GLU      57.8  169.1   58.2",
+  "GLU    -178.7 -175.3  -48.6",
+  "GLU    -173.9  132.3  -69.7",
+  "GLU     -60.3   92.0  -16.8",
+  "GLU     -61.0  -65.6   -7.7",
+  "GLU      52.6  -94.1   16.7",
+  "GLU     -69.5  -72.7   12.2",
+  "GLU      67.8 -178.9   -8.7",
+  "GLU    -172.1 -163.7   71.8",
+  "GLU     -65.2   61.4   49.9",
+  "GLU    -162.2  -86.8  -26.6",
+  "GLU     173.0   70.6   74.3",
+  "GLU    -103.2  132.2   73.7",
+  "GLU      54.7  151.3  -71.7",
+  "GLU     -64.4  160.3  -57.8",
+  "GLU      72.5  -73.9   -5.1",
+  "GLU      71.1 -165.2    7.1",
+  "GLU     -82.8  -45.3   71.8",
+  "GLU     180.0   77.9   -2.6",
+  "GLU      26.7 -143.0    0.5",
+  "GLU     -62.3   70.7  -71.6",
+  "GLU    -150.9 -176.8   22.1",
+  "GLU      68.0 -158.0  -77.4",
+  "GLU    -108.3   60.1   71.5",
+  "GLU       8.0  -95.4  -20.1",
+  "GLU     173.2  109.2   32.5",
+  "GLU     -14.1  144.6   87.8",
+  "GLU      64.9   94.8   54.9",
+  "GLU    -116.0  114.0  -53.4",
+  "GLU    -113.6 -162.4  -54.8",
+  "GLU    -139.7   88.1   10.3",
+  "GLU     -71.9  -93.9   80.8",
+  "GLU     166.7 -137.7   28.5",
+  "GLU     -74.8 -117.5  -39.7",
+  "GLU      -5.7 -154.4  -62.2",
+  "GLU     -35.0  126.7   24.4",
+  "GLU    -151.1  -71.8  -75.4",
+  "GLU      27.2 -137.5   65.3",
+  "GLU     -83.9 -147.1   21.0",
+  "GLU    -148.7   -4.4   85.9",
+  "GLU    -126.0  -31.9  -16.1",
+  "GLU      74.2  -56.3  -61.9",
+  "GLU     -54.1  159.7   83.4",
+  "GLU     166.1  -83.6  -71.4",
+  "GLU      24.9  -63.8  -68.6",
+  "GLU     -16.6 -143.3    0.5",
+  "GLU     178.7 -123.5  -77.1",
+  "GLU      65.0   80.5   12.2",
+  "GLU     -36.1  171.6   36.3",
+  "GLU    -174.9   42.7  -66.1",
+  "GLU    -101.5  -71.3  -40.3",
+  "GLU     -71.1    4.0   66.4",
+  "GLU      -2.6   47.6   80.3",
+  "GLU     -41.0  -38.7   81.3",
+  "GLU     -30.9  -97.1   68.7",
+  "GLU     139.8 -168.6  -65.9",
+  "GLU     128.0 -124.5  -76.5",
+  "GLU     102.3  150.6   65.9",
+  "GLU     121.3 -160.7  -22.4",
+  "GLU       6.1   66.3  -39.9",
+  "GLU    -141.2  -77.1   64.8",
+  "GLU     126.0   68.1   15.4",
+  "GLU      67.4   48.5  -85.3",
+  "GLU    -118.7 -112.5  -51.8",
+  "GLU      56.5  -91.0   64.2",
+  "GLU      57.3  101.8  -12.6",
+  "GLU    -138.2   85.9  -13.2",
+  "GLU     -56.6   -4.8  -56.9",
+  "GLU     -34.0 -108.4  -23.9",
+  "GLU     -27.7   71.0    1.6",
+  "GLU     168.7  126.9  -16.7",
+  "GLU    -159.5  -84.3    3.8",
+  "GLU       6.3 -169.2   -9.2",
+  "PHE     -62.9   87.6",
+  "PHE     177.6   80.2",
+  "PHE      59.5   78.6",
+  "PHE     -60.3  -11.4",
+  "PHE     -80.5   29.1",
+  "PHE    -176.9   37.5",
+  "PHE    -164.6  -51.5",
+  "PHE     -29.6  -51.2",
+  "PHE     -83.4  -51.0",
+  "PHE      89.4  -35.6",
+  "PHE    -104.4   69.0",
+  "PHE    -169.8   -1.8",
+  "GLY",
+  "HSE     -58.9  -69.3",
+  "HSE     -63.3   83.3",
+  "HSE     168.8   75.3",
+  "HSE    -155.5  -95.9",
+  "HSE      52.2  -76.8",
+  "HSE      66.3   62.6",
+  "HSE     -72.1  125.7",
+  "HSE     -73.8 -124.3",
+  "HSE     -67.8 -168.2",
+  "HSE    -155.5 -177.0",
+  "HSE    -113.8  157.6",
+  "HSE    -179.2   15.6",
+  "HSE      66.8  108.6",
+  "HSE     -58.5   -8.5",
+  "HSE    -147.0   77.3",
+  "HSE     169.7  127.1",
+  "HSE    -167.5  -49.3",
+  "HSE      51.0 -142.4",
+  "HSE     159.4 -126.2",
+  "HSE     164.8 -172.1",
+  "HSE     -12.7   82.4",
+  "HSE      98.9  -21.2",
+  "HSE     -99.0  -47.6",
+  "HSD     -58.9  -69.3",
+  "HSD     -63.3   83.3",
+  "HSD     168.8   75.3",
+  "HSD    -155.5  -95.9",
+  "HSD      52.2  -76.8",
+  "HSD      66.3   62.6",
+  "HSD     -72.1  125.7",
+  "HSD     -73.8 -124.3",
+  "HSD     -67.8 -168.2",
+  "HSD    -155.5 -177.0",
+  "HSD    -113.8  157.6",
+  "HSD    -179.2   15.6",
+  "HSD      66.8  108.6",
+  "HSD     -58.5   -8.5",
+  "HSD    -147.0   77.3",
+  "HSD     169.7  127.1",
+  "HSD    -167.5  -49.3",
+  "HSD      51.0 -142.4",
+  "HSD     159.4 -126.2",
+  "HSD     164.8 -172.1",
+  "HSD     -12.7   82.4",
+  "HSD      98.9  -21.2",
+  "HSD     -99.0  -47.6",
+  "ILE     -71.2  167.7",
+  "ILE     -60.7  -71.0",
+  "ILE      64.3  155.4",
+  "ILE    -173.3  175.6",
+  "ILE    -168.7   76.0",
+  "ILE     -57.5   97.4",
+  "ILE      50.2   59.0",
+  "ILE     -67.6 -150.0",
+  "ILE     107.9   83.2",
+  "ILE     -85.2   51.4",
+  "ILE      46.8 -148.3",
+  "ILE     -67.6  -25.0",
+  "ILE      85.2  -75.6",
+  "ILE    -169.2  133.6",
+  "ILE     122.3 -173.3",
+  "ILE    -122.5  -69.3",
+  "ILE    -175.1 -110.2",
+  "ILE    -176.0   28.3",
+  "ILE     143.6 -118.4",
+  "ILE     -12.4  109.9",
+  "ILE      24.7  161.8",
+  "ILE    -126.5   89.4",
+  "ILE      57.7  100.0",
+  "LYS     -61.6  176.3 -178.2 -166.2",
+  "LYS    -168.3  174.0 -165.7  141.5",
+  "LYS     -56.5  -51.6 -177.0 -179.9",
+  "LYS     -55.7  177.5 -175.7  -51.9",
+  "LYS    -153.8 -150.8 -177.6 -148.2",
+  "LYS     -60.8 -150.3 -171.0  131.0",
+  "LYS     -80.5 -178.8   81.6  165.7",
+  "LYS    -175.8  165.7 -154.4  -63.3",
+  "LYS     -60.1 -177.2  -53.1  170.4",
+  "LYS     170.7 -170.3  153.7   57.7",
+  "LYS    -177.5  156.9   70.5  168.6",
+  "LYS     -70.3 -149.0 -160.2   77.7",
+  "LYS    -156.0 -172.7  -71.3  169.1",
+  "LYS      60.1 -172.1  165.4  162.5",
+  "LYS     -53.8  -69.3  176.8  -83.2",
+  "LYS    -173.1   39.9  170.4  152.0",
+  "LYS     -59.0 -178.0  -67.4  -55.4",
+  "LYS     -96.3  170.6  171.6   16.4",
+  "LYS     -83.5  -59.0  175.6   68.7",
+  "LYS     -53.1  -75.4  -88.5  175.7",
+  "LYS    -160.4  152.1  178.4 -163.1",
+  "LYS     179.4  161.9  124.0  169.0",
+  "LYS     -81.5 -166.3  158.5   88.7",
+  "LYS     -62.0 -172.1   76.1   64.9",
+  "LYS     -69.1  -44.7  175.6 -124.6",
+  "LYS     -73.6  179.3 -124.3 -160.8",
+  "LYS      75.5 -176.4 -178.9   62.9",
+  "LYS    -168.0   81.7  178.5 -175.6",
+  "LYS      72.9  179.0   68.1 -172.4",
+  "LYS    -166.7   75.8  156.6  -59.0",
+  "LYS     169.3   86.1  140.6   73.7",
+  "LYS      68.2 -160.7  175.7  -73.2",
+  "LYS     -78.7   63.2 -179.4 -179.7",
+  "LYS    -175.7  174.4  -64.2  -53.3",
+  "LYS     -63.1 -163.1 -154.3  -94.1",
+  "LYS     -50.5  136.8 -168.8 -175.3",
+  "LYS    -165.5  -90.1 -159.0 -173.4",
+  "LYS     162.8 -170.5   77.6   89.3",
+  "LYS     176.6   60.0   63.8 -178.2",
+  "LYS     179.2  145.1  150.9  -65.7",
+  "LYS     161.7 -162.2   75.6 -122.1",
+  "LYS    -159.5  153.6   83.4  -70.7",
+  "LYS     -88.8  133.8   68.0   70.8",
+  "LYS    -177.3  128.8  102.5  101.6",
+  "LYS     -69.6  -65.8 -179.9  -16.6",
+  "LYS     163.0 -168.8   27.0   78.3",
+  "LYS     -41.3 -122.0  168.7  177.4",
+  "LYS     -94.6  124.3 -152.8  150.9",
+  "LYS     -57.6 -159.4  -95.9  116.0",
+  "LYS     -44.5  -74.1  119.5   75.6",
+  "LYS     -54.4  -64.1  101.9  154.4",
+  "LYS     -57.3 -165.2   50.6 -143.4",
+  "LYS     -95.7 -111.6   93.3  177.6",
+  "LYS     -56.8  144.9  -77.0  107.0",
+  "LYS      79.4 -173.8 -172.1 -158.9",
+  "LYS    -177.5  165.8  -56.3   98.3",
+  "LYS     -70.5  -66.8  -79.5  -88.5",
+  "LYS    -166.8   29.9  152.3   35.3",
+  "LYS     -83.5  -93.1 -150.0  156.6",
+  "LYS     -78.9  124.6   75.3  154.5",
+  "LYS     -65.7 -155.0  144.3  -66.6",
+  "LYS    -167.3  110.5 -159.1   32.8",
+  "LYS     -81.4  143.2 -158.1   57.6",
+  "LYS      81.9  156.3   63.1   66.7",
+  "LYS     -66.1  143.5   90.8  -83.9",
+  "LYS    -173.0 -164.2   70.3  178.2",
+  "LYS     -90.2  178.4 -115.4  157.5",
+  "LYS      57.7 -171.8  -78.0 -159.2",
+  "LYS      54.2  160.0 -175.0  -68.1",
+  "LYS     178.5 -174.4 -165.2   13.4",
+  "LYS      75.8  162.4  120.1   94.7",
+  "LYS    -169.1 -177.6 -161.5   88.5",
+  "LYS     -46.9  -56.5  -62.2  101.5",
+  "LYS     -55.0 -154.6 -105.6   30.5",
+  "LYS     173.2  162.2 -116.8 -141.9",
+  "LYS     -68.7  161.2  163.8  -92.1",
+  "LYS    -135.0  100.3  135.2  144.2",
+  "LYS     -46.1  -26.7  143.4  168.1",
+  "LYS     152.6 -139.0 -133.1 -143.5",
+  "LYS     -77.3  165.4  136.4  146.7",
+  "LYS     166.6 -164.7 -176.8 -165.8",
+  "LYS    -110.7   85.1  131.4  -39.6",
+  "LYS    -132.6 -146.3  155.5  -56.8",
+  "LYS     -75.3 -166.1   25.5  152.7",
+  "LYS     -48.9  160.8 -177.7  133.1",
+  "LYS    -114.9   74.4 -167.9   67.1",
+  "LYS     -50.3 -138.2 -106.1 -121.3",
+  "LYS     176.0   64.3   58.5   61.3",
+  "LYS    -146.6  147.6  -55.2   10.7",
+  "LYS    -100.8  159.2  -76.9 -153.6",
+  "LYS     -97.9 -177.8   79.0 -145.7",
+  "LYS     -64.9 -151.8   85.9  -46.2",
+  "LYS     -93.7   82.2  118.3   73.2",
+  "LYS     -59.2  -60.3 -131.6 -149.4",
+  "LYS     -64.8 -169.0  -68.6   70.8",
+  "LYS    -168.9   57.9 -140.7  176.8",
+  "LYS     -58.4  -74.3 -132.2  -70.7",
+  "LYS     -52.8 -108.0 -177.5   98.3",
+  "LYS    -174.1  146.2 -115.2  102.7",
+  "LYS    -178.7  166.3  174.7 -113.5",
+  "LYS      65.8 -124.4  -52.9  146.2",
+  "LYS     171.0 -180.0  -98.0   53.1",
+  "LYS    -171.8 -120.7   90.7  170.5",
+  "LYS    -100.9   69.3 -161.5 -138.9",
+  "LYS    -178.4   66.4 -169.2   80.3",
+  "LYS    -163.7  -82.4  177.8   73.1",
+  "LYS     -51.1 -102.7 -178.5 -128.2",
+  "LYS     -81.6   66.3 -170.5  -56.0",
+  "LYS     174.5  102.3   82.3  -78.2",
+  "LYS    -169.7  147.0  -49.4  171.8",
+  "LYS    -138.8  -61.7  162.2 -171.9",
+  "LYS     -88.6 -174.1  -24.1 -133.0",
+  "LYS    -146.4  117.6   56.5 -150.7",
+  "LYS      -3.1   80.3  173.3  148.8",
+  "LYS     -66.5   10.5 -109.8  178.5",
+  "LYS     116.3  127.0 -170.9 -164.8",
+  "LYS      56.0  138.1   81.4 -179.7",
+  "LYS     -53.2  -85.3   73.5 -165.2",
+  "LYS     -72.9  136.2   47.4  -87.2",
+  "LYS     -25.1  123.5  106.4  159.4",
+  "LYS     177.4   62.0  136.5 -100.5",
+  "LYS     100.6  157.8  -61.2 -161.2",
+  "LYS     176.0  -57.8  -96.0  142.5",
+  "LYS     -52.4 -146.5  122.5 -156.2",
+  "LYS      57.3  154.2  -71.0 -103.8",
+  "LYS     -61.2  175.0  122.8 -124.3",
+  "LYS      72.8   80.7  175.6  -73.7",
+  "LYS    -128.1   76.9 -102.7   76.8",
+  "LYS     -58.3  -60.2  -72.5 -145.2",
+  "LYS    -170.1  -88.1 -178.6  -67.3",
+  "LYS    -101.6   26.8   95.2 -159.2",
+  "LYS     140.0  167.7   18.8  164.0",
+  "LYS    -172.8  -98.6  -61.3  173.9",
+  "LYS     -31.9  -63.6  167.3   77.5",
+  "LYS     178.3 -171.6  -97.5  -93.8",
+  "LYS     173.0   87.3  154.7  121.4",
+  "LYS     -67.8  174.6 -108.2  -14.0",
+  "LYS      60.3 -129.1  -52.4 -135.6",
+  "LYS     171.3   60.9 -161.0  -50.5",
+  "LYS     -45.7   85.5 -168.9   64.1",
+  "LYS     -97.2   73.3 -101.8  -50.9",
+  "LYS     167.4  -83.5  153.3 -167.1",
+  "LYS    -173.2   52.2  131.6 -151.4",
+  "LYS    -174.2   59.1   54.2 -119.5",
+  "LYS     -18.8 -114.0  -60.4  -89.4",
+  "LYS    -159.1  132.8  175.8  116.9",
+  "LYS     -57.5  -70.2  129.9 -110.6",
+  "LYS      73.0  105.3  178.8  172.0",
+  "LYS    -166.8   84.8  -60.8  178.9",
+  "LYS    -139.5  -75.6  113.0 -120.4",
+  "LYS     178.8 -140.8 -154.6  -57.6",
+  "LYS     176.3  -85.3  -66.8  -59.0",
+  "LYS    -172.9 -161.2  150.4  -12.9",
+  "LYS      54.7 -176.7 -108.5  -24.6",
+  "LYS    -174.1 -162.7   88.4  -72.7",
+  "LYS     166.0  129.0  -99.1  152.6",
+  "LYS     -41.1  -51.8 -136.9  163.5",
+  "LYS     -49.7 -122.1  -76.8 -177.5",
+  "LYS     168.9 -174.2  136.4  -64.2",
+  "LYS     -23.3   61.7 -159.4  -63.0",
+  "LYS      87.4  153.3  -79.7   51.1",
+  "LYS      62.0 -155.6  -70.7  -78.9",
+  "LYS      64.1  -60.0  156.8  -61.6",
+  "LYS     -73.0 -125.8   92.1   86.0",
+  "LYS     -65.2  -60.6  -64.9   52.1",
+  "LYS    -161.9  100.3  135.4 -150.0",
+  "LYS      75.7   50.1  100.5 -171.1",
+  "LYS     174.2  -84.0   96.2   92.4",
+  "LYS     -56.4 -110.8  178.8  -61.9",
+  "LYS     124.9  171.3  120.0  154.1",
+  "LYS    -176.4  176.6  -57.3  -93.3",
+  "LYS      60.3 -166.8  141.3   42.3",
+  "LYS     176.2   81.3  -99.3 -102.8",
+  "LYS      51.2  130.4  173.5   30.7",
+  "LYS     -70.5  -42.6  135.7  -59.8",
+  "LYS     -32.8  -74.1  -28.9 -140.6",
+  "LYS    -149.7  175.7   70.0   77.6",
+  "LYS    -114.1 -150.5 -163.3  -60.7",
+  "LYS      55.0  140.8  130.0 -171.2",
+  "LYS     -61.6 -179.6  126.1  -12.6",
+  "LYS     -49.6 -165.5  -65.9 -136.0",
+  "LYS       8.0 -170.5 -109.3 -155.7",
+  "LYS    -115.6 -132.1  -45.7 -106.3",
+  "LYS    -151.3   15.1 -143.4  -22.6",
+  "LYS     -92.9  138.0   23.1 -153.4",
+  "LYS     -71.6  -14.3  129.9   80.3",
+  "LYS    -118.4  121.0  173.2  -72.2",
+  "LYS     -69.9 -165.2  -28.7  102.2",
+  "LYS    -138.8 -125.2 -140.5   73.5",
+  "LYS       8.1  -85.6 -151.4 -159.7",
+  "LYS     -73.5   10.1  177.5  -18.9",
+  "LYS     -77.9  165.3  130.2   47.3",
+  "LYS     -36.7   60.5   41.2 -178.4",
+  "LYS     -66.5  100.7  -70.3  134.2",
+  "LYS    -161.1  117.9 -142.5  170.9",
+  "LYS     -65.9  115.0 -136.8  105.0",
+  "LYS    -138.1  -42.8 -171.4   58.8",
+  "LYS    -114.7  154.1  132.6 -150.3",
+  "LYS    -106.6  -74.2  -66.2 -172.9",
+  "LYS     -48.7  -75.1   31.2 -118.1",
+  "LYS    -163.0  106.4 -158.0 -104.0",
+  "LYS     100.9 -140.1  143.5  171.1",
+  "LYS    -157.1   57.1   93.8  138.3",
+  "LYS      -4.9  169.8  161.2   45.7",
+  "LYS     135.0 -121.1  -27.7  158.1",
+  "LYS    -108.8  -66.5 -129.7   13.4",
+  "LYS    -104.1 -144.4 -168.5  171.9",
+  "LYS    -140.5  174.0   10.7   54.5",
+  "LYS     -51.1  -70.8  -64.3  -36.4",
+  "LYS     137.9  -66.9 -124.4 -177.9",
+  "LYS    -161.4  128.3    7.0  111.3",
+  "LYS    -167.2 -172.9   27.8  145.9",
+  "LYS      84.9   82.6  143.9   54.4",
+  "LYS    -108.4   90.9  -65.4 -176.1",
+  "LYS      12.7 -153.3  140.3 -169.8",
+  "LYS    -151.0  105.5  -68.9  123.1",
+  "LYS     -84.0  -40.4   79.7  110.5",
+  "LYS    -143.1  -70.8  108.6   62.5",
+  "LYS     171.9  130.8  173.5  -14.1",
+  "LYS     172.7 -179.9  119.2 -137.9",
+  "LYS     145.7 -157.3 -129.3  173.6",
+  "LYS    -109.7 -151.1 -126.2  -20.8",
+  "LYS      69.0 -175.1 -104.6  139.5",
+  "LYS     -79.2   68.1   63.4  -71.1",
+  "LYS    -106.4  -97.5 -118.0 -154.5",
+  "LYS    -162.0   40.4 -151.7 -104.4",
+  "LYS    -157.1 -130.8  -55.4  -75.7",
+  "LYS     -73.0  111.1   65.5 -156.1",
+  "LYS    -122.4  -52.4 -160.1  -71.2",
+  "LYS     -81.9   42.9 -107.1 -133.7",
+  "LYS    -166.2   34.3  -89.1  102.2",
+  "LYS    -128.7   63.6   45.4   68.5",
+  "LYS     104.3  -90.2  162.5   63.1",
+  "LYS     163.7 -152.0  -36.2 -144.9",
+  "LYS      99.6 -159.7   86.4  -83.7",
+  "LYS     -92.2  -20.9   83.1   34.1",
+  "LYS    -113.6 -157.6  -57.5 -178.6",
+  "LYS      11.1 -140.6  -78.2  141.0",
+  "LYS      61.0  142.8 -161.8 -131.7",
+  "LYS     -43.0  -32.2  -80.6  149.1",
+  "LYS     -22.2  127.7  160.1   92.5",
+  "LYS     -76.7  132.8  104.6  -25.5",
+  "LYS     -60.9 -175.5   52.9  109.5",
+  "LYS     -54.4 -118.1  -97.4  119.2",
+  "LYS    -158.3  151.4   -9.7 -152.8",
+  "LYS     131.6  131.3   35.2 -138.2",
+  "LYS     -48.4 -121.0  121.4  156.3",
+  "LYS     -90.5  165.1 -145.2  100.8",
+  "LYS      57.7  175.3  173.4  112.8",
+  "LYS      64.7 -179.2 -135.2  -65.2",
+  "LYS     -53.7   92.9  -84.1 -146.4",
+  "LYS     121.1 -161.7   67.4   60.2",
+  "LYS     -60.8 -134.8  -53.6  -74.1",
+  "LYS     165.9  178.9  104.2   48.9",
+  "LYS      48.7  156.1   14.8  177.2",
+  "LYS     146.6  103.8  -84.7 -164.0",
+  "LYS      33.8 -129.8   72.3 -156.3",
+  "LYS    -166.6 -156.2  154.4  134.8",
+  "LYS     -90.6  125.1  123.4   84.6",
+  "LYS      52.9  161.1  -64.2  152.9",
+  "LYS    -166.6  -81.1  -81.3 -134.5",
+  "LYS    -158.1  -94.6 -135.8   -7.9",
+  "LYS      71.2  162.5   82.1   13.0",
+  "LYS     -41.8  -47.3 -106.1   14.8",
+  "LYS      96.3  114.1  -97.4  167.7",
+  "LYS     -64.1 -107.8  -35.4  179.2",
+  "LYS    -164.4 -126.0   27.6 -130.4",
+  "LYS    -125.3 -173.8   69.2  169.7",
+  "LYS     -71.6 -156.0  -62.0   21.9",
+  "LYS    -160.6 -153.4  -57.6   89.6",
+  "LYS     -90.8  -10.6  160.9  159.8",
+  "LYS     -54.3 -155.2 -179.5   33.9",
+  "LYS      59.3  -84.3  -71.7 -179.9",
+  "LYS    -131.9 -163.2   72.5  122.3",
+  "LYS     -78.7  113.0 -179.4  -71.2",
+  "LYS    -177.3   70.5  -78.6  -55.7",
+  "LYS    -105.3 -169.0   80.9   67.5",
+  "LYS     129.6   72.1  178.0 -170.5",
+  "LYS      30.1  -84.5 -170.1 -108.8",
+  "LYS     170.6  164.4  -67.6 -137.3",
+  "LYS      -2.2  -88.0  -73.4  170.7",
+  "LYS    -128.7  152.7  -64.3  -60.1",
+  "LYS      59.8 -166.8   -1.8   21.3",
+  "LYS    -143.9   63.4   53.5  168.6",
+  "LYS      16.4 -109.8 -162.1  -65.5",
+  "LYS     136.2  -88.7  171.0  -58.4",
+  "LYS    -133.1 -148.3 -113.3 -169.7",
+  "LYS     179.0  -92.5 -164.7 -127.2",
+  "LYS    -141.1  -47.2  121.0 -161.2",
+  "LYS     -33.8 -177.8  -98.8  175.3",
+  "LYS    -101.4   45.8  134.2  -15.9",
+  "LYS      75.2 -179.4  122.7 -137.4",
+  "LYS     -78.4 -175.7   78.1   21.8",
+  "LYS    -156.8  175.0   -5.6  -31.1",
+  "LYS     168.4  -88.7 -110.5   86.7",
+  "LYS      -7.5 -144.9 -149.2   96.4",
+  "LYS    -116.1  104.6  -73.4   29.1",
+  "LYS     -63.8  -86.4   42.0  115.9",
+  "LYS    -147.2 -127.9  138.2   47.6",
+  "LYS     165.9   56.6   82.2  -45.1",
+  "LYS     112.0  -93.4  143.6 -172.0",
+  "LYS     -77.3  141.6   66.9   28.5",
+  "LYS     -74.6  142.9  -75.1  160.8",
+  "LYS     -74.3 -110.1  135.8  -42.2",
+  "LYS      72.2  -37.3  164.0  102.6",
+  "LYS     171.6  100.7   61.3  166.0",
+  "LYS     113.4 -150.5  -72.1  -29.7",
+  "LYS     -62.6 -114.7 -129.2   24.3",
+  "LYS      58.3  163.9 -120.1 -157.4",
+  "LYS     -94.1  -63.6  -37.4  -54.3",
+  "LYS     152.1  -42.0 -145.8  -11.5",
+  "LYS      14.8   50.1   95.9  -75.3",
+  "LEU     -67.0  178.7",
+  "LEU    -178.1   54.1",
+  "LEU     -69.3   39.6",
+  "LEU    -178.3  152.6",
+  "LEU     -84.4   81.8",
+  "LEU    -162.4 -170.3",
+  "LEU      60.2   81.6",
+  "LEU    -127.3 -112.0",
+  "LEU    -114.1  -54.9",
+  "LEU      71.2  151.8",
+  "LEU    -116.6 -160.4",
+  "LEU     -70.3  -55.3",
+  "LEU    -167.7  -82.2",
+  "LEU    -114.9  175.1",
+  "LEU     116.0    6.1",
+  "LEU     -20.8 -177.4",
+  "LEU      68.2 -156.4",
+  "LEU      23.3  172.4",
+  "LEU     -24.8  136.1",
+  "MET     -63.8  173.7   76.2",
+  "MET     -67.0  -86.5  -67.0",
+  "MET     -73.5 -165.6  -77.8",
+  "MET     -60.4  176.6 -176.4",
+  "MET     174.4  172.6  -68.7",
+  "MET    -157.8  173.7   51.0",
+  "MET    -167.1   64.1   93.2",
+  "MET     -56.6  -65.6  113.6",
+  "MET      69.1 -163.5   88.4",
+  "MET     -69.3  -64.8  179.8",
+  "MET      50.9  177.6  -65.3",
+  "MET     167.0  156.9  155.6",
+  "MET    -176.8  -93.5  -72.3",
+  "MET      62.0  178.7  179.5",
+  "MET    -155.2   77.4 -168.6",
+  "MET     -76.7  161.0 -121.4",
+  "MET     153.8 -160.6   68.4",
+  "MET     -57.8 -179.6   26.2",
+  "MET     -54.7  -46.3  -63.8",
+  "MET    -160.3  179.3 -165.7",
+  "MET    -162.1 -137.5   84.6",
+  "MET    -170.1   66.5   49.8",
+  "MET     -76.6  -50.8 -118.1",
+  "MET    -163.3  109.1  -98.6",
+  "MET     -75.2  163.4  137.6",
+  "MET      60.6 -164.4 -106.8",
+  "MET     -60.4 -147.2   83.4",
+  "MET     -77.7   63.1 -104.0",
+  "MET     -79.1  -82.8  -22.7",
+  "MET    -121.8  154.7  153.3",
+  "MET     174.1   65.4 -111.7",
+  "MET     -40.2 -169.4  -31.5",
+  "MET    -170.7 -175.9 -113.7",
+  "MET     143.2 -166.1 -151.4",
+  "MET      35.9   58.2   69.3",
+  "MET      67.0  106.3  166.5",
+  "MET     -76.9   68.9  112.5",
+  "MET     169.1  163.9  -24.0",
+  "MET    -174.3   72.0  151.6",
+  "MET      78.6  121.2 -140.6",
+  "MET      66.0  156.2   77.1",
+  "MET     -85.8   87.5    5.8",
+  "MET    -114.5 -170.2   68.9",
+  "MET    -102.5   55.4 -165.2",
+  "MET      84.9  -91.9  -78.7",
+  "MET    -147.3  160.7   -6.4",
+  "MET      60.8   79.6 -116.4",
+  "MET    -116.3   60.2   67.5",
+  "MET     175.9  -88.8  178.9",
+  "MET      77.2   75.4   66.9",
+  "MET      47.4  -99.9 -166.7",
+  "MET    -109.3 -114.1 -116.6",
+  "MET    -126.2 -129.2  -64.4",
+  "MET     -50.5   71.5 -178.8",
+  "MET      -2.8  -66.4  -28.9",
+  "MET      59.2 -173.5   -2.8",
+  "MET     -80.4 -179.2  -27.4",
+  "MET    -128.3   25.3 -102.2",
+  "MET       4.9 -180.0  128.9",
+  "MET     149.4  160.5   54.1",
+  "MET     119.8  169.8  -69.0",
+  "MET    -109.3 -105.1   71.7",
+  "MET    -161.2  135.7 -150.1",
+  "MET     178.4 -154.1    5.3",
+  "MET      25.4 -160.5   41.8",
+  "MET    -118.6  168.6 -124.9",
+  "MET     -54.5 -121.1   30.9",
+  "MET     -98.0  155.5   18.3",
+  "MET     -60.4 -138.6 -168.8",
+  "MET     -29.3  -63.3 -164.2",
+  "MET     -69.0  138.7  -69.7",
+  "ASN     -69.1  -49.2",
+  "ASN    -174.5  -18.5",
+  "ASN    -164.8   34.9",
+  "ASN     -52.8  102.6",
+  "ASN      69.3  -37.2",
+  "ASN     -67.1  161.1",
+  "ASN     -85.5   16.7",
+  "ASN      70.5   16.8",
+  "ASN    -172.1 -140.7",
+  "ASN      74.0   74.2",
+  "ASN    -175.3  -81.5",
+  "ASN    -178.3   96.3",
+  "ASN     -62.6  -93.4",
+  "ASN    -118.1  -58.3",
+  "ASN      56.4 -115.8",
+  "ASN     -72.4 -157.7",
+  "ASN     -99.9   59.4",
+  "ASN      62.5  128.6",
+  "ASN      71.7 -170.5",
+  "ASN    -172.4  152.8",
+  "ASN    -127.4  125.4",
+  "ASN     101.1 -115.2",
+  "ASN    -113.3 -115.8",
+  "ASN     156.5   47.7",
+  "ASN     110.4  125.6",
+  "ASN     109.1  -43.2",
+  "ASN     -16.8   13.3",
+  "ASN     -41.2   62.7",
+  "ASN      32.8   63.2",
+  "ASN     -16.3  -94.3",
+  "ASN    -129.3   -8.1",
+  "PRO      31.3  -36.7",
+  "PRO     -28.6   40.8",
+  "GLN     -58.9 -179.1  -31.4",
+  "GLN     -57.8  -59.0  -64.3",
+  "GLN     -67.7 -165.6   38.7",
+  "GLN    -169.9   69.5   49.0",
+  "GLN    -177.3  176.1  -13.5",
+  "GLN     -64.7 -168.7 -134.2",
+  "GLN     -71.1 -172.2   92.9",
+  "GLN    -174.8  171.1  -75.9",
+  "GLN     -63.5  -71.5    4.4",
+  "GLN     -70.9  173.2  143.1",
+  "GLN    -162.2  176.8   54.1",
+  "GLN     -69.4  168.9  -72.7",
+  "GLN     -62.0  -77.5  155.3",
+  "GLN    -146.7 -141.4   49.6",
+  "GLN    -177.4 -168.9  174.3",
+  "GLN      68.0  177.0   33.8",
+  "GLN     -56.1   83.4  -14.2",
+  "GLN      65.0 -178.6   93.1",
+  "GLN     -63.0  -71.2  104.5",
+  "GLN     -69.1   68.2   37.5",
+  "GLN      66.1 -175.7  -27.8",
+  "GLN    -149.2 -175.0  103.7",
+  "GLN     176.2   80.5  -15.3",
+  "GLN    -166.4 -177.5 -146.9",
+  "GLN    -102.7  138.6 -146.6",
+  "GLN    -172.2   66.0 -172.7",
+  "GLN    -167.2   98.8  140.4",
+  "GLN     -58.5  154.6   37.8",
+  "GLN     164.2  -88.3  -42.4",
+  "GLN      71.8  -71.8  -48.7",
+  "GLN    -174.9 -134.9  -31.1",
+  "GLN      35.0 -111.4   77.9",
+  "GLN      49.5 -162.2  -68.8",
+  "GLN    -138.1   82.4  -82.6",
+  "GLN      58.2 -167.9 -149.1",
+  "GLN     -70.8   96.9 -147.4",
+  "GLN      71.3  -91.5   35.9",
+  "GLN     -61.0  -65.3   54.3",
+  "GLN     -38.2 -108.9 -146.5",
+  "GLN      94.5   68.4  178.8",
+  "GLN    -134.2  125.7  100.7",
+  "GLN     -72.6 -172.9 -174.5",
+  "GLN     -64.6  -61.7 -160.3",
+  "GLN    -115.9  -94.5 -103.7",
+  "GLN     -95.7   83.7  115.9",
+  "GLN    -131.4  -54.0    4.2",
+  "GLN     172.0 -136.4  -86.0",
+  "GLN       3.3 -135.2  -62.1",
+  "GLN     146.7  120.0  -22.8",
+  "GLN    -146.8  -82.0   52.3",
+  "GLN    -105.4  -37.2   99.6",
+  "GLN      88.1   81.8   39.3",
+  "GLN      64.0  176.6  153.2",
+  "GLN      74.6  -92.1  160.0",
+  "GLN    -110.4   61.5 -135.0",
+  "GLN      76.5  -69.7   -7.0",
+  "GLN      29.4  176.2 -108.2",
+  "GLN      53.7  142.2  -32.9",
+  "GLN     -67.7  -75.6 -106.2",
+  "GLN    -165.7  111.8 -162.4",
+  "GLN    -134.4 -113.3  159.4",
+  "GLN     173.2   63.4  -61.1",
+  "GLN    -128.6  179.2  -26.9",
+  "GLN     -73.8  -13.9  -66.5",
+  "GLN     -29.9  168.0  108.4",
+  "GLN     147.6  155.5   87.2",
+  "GLN      96.3  110.6  108.2",
+  "GLN      35.1   69.5   -2.4",
+  "GLN    -120.1  177.3 -100.8",
+  "GLN     -71.6 -116.6  -83.3",
+  "GLN     -93.6   40.4  -81.5",
+  "GLN     -93.5 -114.1   98.3",
+  "GLN     142.6 -120.2   91.4",
+  "GLN     -72.5 -112.0  -17.1",
+  "GLN     178.8   71.0 -122.2",
+  "GLN      11.6  137.0 -172.5",
+  "GLN    -132.7   11.9 -122.1",
+  "GLN     176.4   62.3   98.1",
+  "GLN      14.2 -150.1    6.4",
+  "GLN     146.2  -80.2  139.6",
+  "GLN    -121.0    3.7   60.7",
+  "GLN    -138.0  133.4    4.4",
+  "GLN    -139.2 -143.5 -103.5",
+  "GLN     -35.7   43.2  -12.8",
+  "GLN    -108.9  135.8   47.4",
+  "GLN     -55.8   83.4  165.8",
+  "GLN     114.9  154.0  175.0",
+  "GLN     125.7  176.0  -95.5",
+  "GLN    -140.0   92.4    8.8",
+  "GLN      41.3  -62.7  -89.8",
+  "GLN     -29.6 -150.3  161.4",
+  "GLN    -159.8  -96.0  -88.0",
+  "GLN     -59.8  146.7 -137.6",
+  "GLN      61.8   76.5 -120.3",
+  "GLN      13.2  -98.2  157.1",
+  "GLN    -103.4  -72.5  -45.7",
+  "GLN      91.0   85.5  -71.8",
+  "GLN    -127.9   48.9   41.1",
+  "GLN      54.4   82.7   79.4",
+  "GLN      -5.3   74.8  -70.4",
+  "GLN     -21.8 -107.6   40.3",
+  "GLN    -126.6  -61.9  176.8",
+  "GLN    -121.3   22.9  -10.6",
+  "GLN     171.9 -156.3  133.2",
+  "GLN      55.2 -141.5   31.9",
+  "GLN      33.5  -62.7  104.3",
+  "GLN     149.1 -163.8   93.5",
+  "ARG     -54.4  175.1 -179.8 -179.7  0.0",
+  "ARG     -58.0  178.6  174.5 -109.5  0.0",
+  "ARG     -64.6 -164.5  -61.5  -98.8  0.0",
+  "ARG     -41.6 -162.4  -56.0 -178.9  0.0",
+  "ARG     -81.0 -164.2  168.8   93.9  0.0",
+  "ARG    -168.1  172.2   61.6 -167.8  0.0",
+  "ARG    -170.1 -170.9  -75.2  149.0  0.0",
+  "ARG     174.0  178.7  166.1  -88.1  0.0",
+  "ARG     -56.9  -77.8 -171.9  -87.3  0.0",
+  "ARG     163.9  171.6   54.7   95.4  0.0",
+  "ARG     -71.5 -178.9  -82.5  115.0  0.0",
+  "ARG    -171.8  177.4 -154.4  159.4  0.0",
+  "ARG     -57.9 -169.4   67.9 -130.2  0.0",
+  "ARG     -63.6  -75.7 -162.0  171.6  0.0",
+  "ARG     -55.0  -63.2  -64.8  -83.9  0.0",
+  "ARG    -157.4 -166.6 -178.0   87.9  0.0",
+  "ARG     -78.1 -175.9  104.1   88.8  0.0",
+  "ARG      55.2 -170.2  171.9   74.3  0.0",
+  "ARG     -81.9 -179.2   64.1  139.6  0.0",
+  "ARG    -156.8  167.1   71.6 -105.4  0.0",
+  "ARG    -138.1 -174.5  -52.9  -85.0  0.0",
+  "ARG      64.3 -163.8 -177.0  -89.8  0.0",
+  "ARG     162.3 -177.3  -76.2 -127.1  0.0",
+  "ARG     170.8   65.3 -177.0   85.0  0.0",
+  "ARG     176.8  163.7  165.7  178.9  0.0",
+  "ARG     -69.6 -174.9   20.5  172.4  0.0",
+  "ARG     -47.2  -90.2  -91.1  171.0  0.0",
+  "ARG     -50.1 -168.9   76.3 -173.0  0.0",
+  "ARG      64.7  167.1  146.2  161.0  0.0",
+  "ARG     -69.9 -174.4   55.9   85.1  0.0",
+  "ARG    -163.7   72.3   66.7 -167.1  0.0",
+  "ARG     167.6   67.3 -168.2 -155.0  0.0",
+  "ARG      64.5  179.4  -62.2  172.3  0.0",
+  "ARG     -77.2 -166.4 -128.7  -81.6  0.0",
+  "ARG    -171.7  167.6  -79.2  106.8  0.0",
+  "ARG     -75.8   69.0  155.3  176.7  0.0",
+  "ARG      66.3  178.9   65.8 -159.4  0.0",
+  "ARG     -81.8 -179.6  163.7  135.0  0.0",
+  "ARG    -170.0   69.0 -160.8  -59.8  0.0",
+  "ARG     -58.6  133.2   83.4 -165.5  0.0",
+  "ARG     -48.7  -61.3 -152.6   84.3  0.0",
+  "ARG     -71.9  154.5 -169.9   83.8  0.0",
+  "ARG      80.9 -174.1  -81.7  -97.3  0.0",
+  "ARG     178.5   55.2 -173.7  153.3  0.0",
+  "ARG    -179.0   70.7   37.0  106.6  0.0",
+  "ARG     -70.1  -63.6   84.1   84.7  0.0",
+  "ARG     -75.5  172.1 -138.9  133.0  0.0",
+  "ARG    -160.4 -108.2  -53.4  166.5  0.0",
+  "ARG     179.5 -147.9  -75.5  -87.9  0.0",
+  "ARG     -85.6  173.7  -92.5 -170.2  0.0",
+  "ARG      58.7 -176.7 -170.1 -136.0  0.0",
+  "ARG     168.8 -175.7 -157.2 -136.8  0.0",
+  "ARG     -50.9  -85.7  176.7 -142.5  0.0",
+  "ARG      49.8  145.7   42.4   89.5  0.0",
+  "ARG      62.8  178.3 -173.5  133.5  0.0",
+  "ARG     -77.7 -127.2   28.3  113.9  0.0",
+  "ARG    -170.7  170.1   76.6  143.6  0.0",
+  "ARG     -61.3  102.0 -176.4 -115.8  0.0",
+  "ARG     -68.5 -136.5 -104.1 -169.9  0.0",
+  "ARG     177.0   70.0  -92.6 -112.4  0.0",
+  "ARG     -65.8 -167.8    0.4 -119.7  0.0",
+  "ARG     -37.6  -71.7  -72.0 -136.0  0.0",
+  "ARG     173.9  167.6  -76.6 -169.4  0.0",
+  "ARG     -77.1   74.1  175.4  -73.6  0.0",
+  "ARG    -146.5  169.4 -179.4  -83.4  0.0",
+  "ARG     165.6 -145.6   87.9 -131.1  0.0",
+  "ARG     -47.0 -101.7  -51.9  159.3  0.0",
+  "ARG     -76.1 -172.2  -23.4  118.5  0.0",
+  "ARG    -107.7  107.9   52.3 -178.0  0.0",
+  "ARG     165.2  179.0  -36.7  106.7  0.0",
+  "ARG      49.9  174.3  107.0  179.9  0.0",
+  "ARG    -127.7  158.8   88.9 -179.1  0.0",
+  "ARG     -50.4  -66.5  160.5   88.0  0.0",
+  "ARG     174.0  164.6  -75.9  -75.6  0.0",
+  "ARG     -77.8  176.3 -165.8  -37.4  0.0",
+  "ARG    -150.8  -64.6 -169.8 -154.6  0.0",
+  "ARG     -81.4  149.8  -62.5  -84.6  0.0",
+  "ARG     -40.9  -42.8  -90.2  156.2  0.0",
+  "ARG     -82.0 -176.6  131.2 -150.4  0.0",
+  "ARG     -65.2  -75.1   95.6  124.7  0.0",
+  "ARG     -85.3   93.3  142.8   58.9  0.0",
+  "ARG      60.1  179.9  -71.0  120.7  0.0",
+  "ARG      49.1 -139.9   59.7   80.1  0.0",
+  "ARG    -130.5 -169.9  -84.3  107.2  0.0",
+  "ARG    -172.4 -121.9  -59.1  120.4  0.0",
+  "ARG    -143.7  140.3  176.6 -160.6  0.0",
+  "ARG     -71.3  -79.0   66.3 -164.9  0.0",
+  "ARG     -62.9  106.7   55.9  106.6  0.0",
+  "ARG     162.0   67.4  126.3  139.5  0.0",
+  "ARG     -65.4 -105.8  -53.5  -84.5  0.0",
+  "ARG    -161.6   79.3 -115.1  173.9  0.0",
+  "ARG     -80.5  -50.7 -101.2  134.2  0.0",
+  "ARG      63.8 -168.8   69.1 -109.0  0.0",
+  "ARG     -98.6  -99.0  156.6  150.1  0.0",
+  "ARG     -86.9  129.8 -162.5 -174.8  0.0",
+  "ARG    -111.2   81.1 -107.8 -140.0  0.0",
+  "ARG    -140.2 -119.2   46.4 -127.9  0.0",
+  "ARG      62.8 -148.8  169.2 -176.1  0.0",
+  "ARG     -86.0  148.0 -133.6 -110.2  0.0",
+  "ARG     177.5  140.1  101.8   96.9  0.0",
+  "ARG    -159.0  -86.9  178.0  115.7  0.0",
+  "ARG     -57.9 -137.5 -155.1 -126.5  0.0",
+  "ARG     160.0  112.2  177.4   66.0  0.0",
+  "ARG     168.7  169.9  105.8  -46.7  0.0",
+  "ARG    -154.3  -72.2  -56.5 -146.9  0.0",
+  "ARG     168.4 -165.1   29.3  140.4  0.0",
+  "ARG     -50.6  135.7  125.6  -65.1  0.0",
+  "ARG      88.9 -123.2  -66.4 -154.2  0.0",
+  "ARG    -146.7 -145.6   88.6  162.6  0.0",
+  "ARG    -128.5 -119.6  -97.4 -173.2  0.0",
+  "ARG     -82.5   77.5   69.5 -113.0  0.0",
+  "ARG     -67.0  -91.7   74.0 -116.2  0.0",
+  "ARG    -167.5  -74.7  -60.1  -88.0  0.0",
+  "ARG     178.8  157.0   57.7   29.4  0.0",
+  "ARG     127.1  171.8  144.3  104.9  0.0",
+  "ARG     -65.6  -98.7  -97.4  108.9  0.0",
+  "ARG      -3.8 -171.7  -81.3 -108.3  0.0",
+  "ARG     -58.9 -132.4  177.8 -176.0  0.0",
+  "ARG     109.5  154.2 -132.8  103.9  0.0",
+  "ARG     -58.9  -57.2  -49.5  153.4  0.0",
+  "ARG      73.8 -176.7  -39.1 -102.0  0.0",
+  "ARG    -156.9  -70.8  177.0  -66.1  0.0",
+  "ARG    -178.3 -137.0  175.4  -59.1  0.0",
+  "ARG      58.9 -119.9  -42.2  144.5  0.0",
+  "ARG    -145.3   68.9  153.7   25.7  0.0",
+  "ARG      61.6  177.9   87.9  135.6  0.0",
+  "ARG    -144.6   88.2   59.7   64.0  0.0",
+  "ARG      44.3  163.2  -93.3   70.4  0.0",
+  "ARG    -171.4 -108.1  177.7  179.2  0.0",
+  "ARG    -108.8 -161.9  -21.1 -157.4  0.0",
+  "ARG     -91.9  137.5   99.5  105.1  0.0",
+  "ARG      85.1 -118.5 -168.3   63.0  0.0",
+  "ARG     166.6  -83.7  129.3 -169.1  0.0",
+  "ARG    -164.6 -162.8   25.0  -87.1  0.0",
+  "ARG     -65.5 -164.0 -126.6   36.4  0.0",
+  "ARG      69.9  -35.3 -160.2  -51.4  0.0",
+  "ARG    -122.9 -156.2  155.3 -131.7  0.0",
+  "ARG     -61.3  -88.2   22.9 -112.2  0.0",
+  "ARG      66.5  104.4 -129.2  130.9  0.0",
+  "ARG     -13.4  119.9  115.4  175.8  0.0",
+  "ARG    -165.8 -143.8 -122.0  -69.5  0.0",
+  "ARG    -168.1 -124.2  117.8   43.9  0.0",
+  "ARG      51.4   76.0 -177.1 -169.6  0.0",
+  "ARG      52.7  -94.0  -56.2  -70.2  0.0",
+  "ARG    -106.5  136.4 -128.6  -71.0  0.0",
+  "ARG     134.7 -179.7  118.4  163.2  0.0",
+  "ARG    -157.2  169.3 -137.1  -94.8  0.0",
+  "ARG    -158.1   86.0   65.5  -91.8  0.0",
+  "ARG    -166.5  153.3  117.2  139.1  0.0",
+  "ARG     -61.3  -80.9 -119.9   34.5  0.0",
+  "ARG     179.2   59.2 -151.8 -104.1  0.0",
+  "ARG      68.9  133.6   94.1   39.4  0.0",
+  "ARG    -125.0  132.0   27.6   94.9  0.0",
+  "ARG     -14.3 -119.1  -90.9   87.1  0.0",
+  "ARG     -58.2 -118.8   57.3 -165.6  0.0",
+  "ARG      56.8  -40.4  179.7 -125.2  0.0",
+  "ARG      48.2  -75.4  -80.5  -17.8  0.0",
+  "ARG    -168.6  117.6   62.0 -149.0  0.0",
+  "ARG    -177.6 -175.9  133.8   77.9  0.0",
+  "ARG    -105.1   58.1   54.4 -166.9  0.0",
+  "ARG      27.9  112.2   94.7  147.2  0.0",
+  "ARG    -166.2   84.9  -45.3  -70.3  0.0",
+  "ARG      62.1 -150.7    8.6  110.4  0.0",
+  "ARG    -109.2   54.0  -72.2  174.8  0.0",
+  "ARG    -115.2   62.6   50.0  133.2  0.0",
+  "ARG      43.5  178.7 -118.7  149.1  0.0",
+  "ARG     -54.4  -25.1  -67.1 -163.1  0.0",
+  "ARG      43.2  -79.4  165.7  -72.5  0.0",
+  "ARG     -41.2   72.2   55.4 -123.6  0.0",
+  "ARG     -43.8  -58.5 -127.6 -130.2  0.0",
+  "ARG      43.7 -102.3  144.5 -143.7  0.0",
+  "ARG      -4.6  156.3  164.2  164.2  0.0",
+  "ARG      74.3   95.9  179.8  -86.8  0.0",
+  "ARG     -60.4 -141.9 -171.3  -34.2  0.0",
+  "ARG    -129.0 -171.0 -107.6 -144.4  0.0",
+  "ARG     -69.3   78.8  153.4    7.4  0.0",
+  "ARG    -172.0  179.3  -20.2  166.5  0.0",
+  "ARG     -50.7  -62.7  132.2 -142.6  0.0",
+  "ARG     -58.7   68.2 -152.6  134.0  0.0",
+  "ARG      20.8  176.6  -68.0  -53.0  0.0",
+  "ARG     -27.3 -158.7  -56.2   32.7  0.0",
+  "ARG     149.9  166.2   63.9  -70.3  0.0",
+  "ARG     -67.7 -176.3  -32.2  -31.0  0.0",
+  "ARG    -171.1 -160.5  148.4 -128.8  0.0",
+  "ARG     -99.4 -160.6  107.3    4.4  0.0",
+  "ARG     -98.6 -144.1   68.4 -150.3  0.0",
+  "ARG      82.4  167.6 -113.4 -160.5  0.0",
+  "ARG    -129.5 -105.1  136.6 -131.9  0.0",
+  "ARG      46.2   91.7 -170.9   88.0  0.0",
+  "ARG    -156.4   22.0  174.7   85.8  0.0",
+  "ARG     167.0   67.5   78.6   82.3  0.0",
+  "ARG    -144.1 -150.4  147.7  178.2  0.0",
+  "ARG     -47.9 -157.9  -14.4   67.6  0.0",
+  "ARG    -118.7  165.5 -130.2  117.0  0.0",
+  "ARG    -174.9 -175.4 -122.7   81.5  0.0",
+  "ARG     -98.5   53.4  172.6   93.2  0.0",
+  "ARG    -156.6  -28.7 -156.1  -44.1  0.0",
+  "ARG    -179.0  179.8 -175.1    6.4  0.0",
+  "ARG    -145.7  135.9  -72.5 -145.0  0.0",
+  "ARG     -47.4  -67.2 -127.0  -25.0  0.0",
+  "ARG    -120.9   26.4 -129.2  134.4  0.0",
+  "ARG     -11.3  178.5  -95.3   98.9  0.0",
+  "ARG     -76.6   63.8 -121.3  -63.4  0.0",
+  "ARG      17.2 -159.1  -13.8 -118.9  0.0",
+  "ARG      66.6  162.9   40.8  152.7  0.0",
+  "ARG    -178.7   78.0 -135.8   31.1  0.0",
+  "ARG      37.6 -178.4   21.9 -162.7  0.0",
+  "ARG      -4.3   90.6 -149.9  -14.6  0.0",
+  "ARG     167.8   85.9   71.4   33.0  0.0",
+  "ARG      14.7  169.9   72.4 -122.7  0.0",
+  "ARG     -61.9 -171.3  -79.4   73.9  0.0",
+  "ARG     120.8  177.1  -43.0  -75.7  0.0",
+  "ARG    -151.2   96.9 -105.9  107.4  0.0",
+  "ARG    -102.7  136.6  101.4 -107.8  0.0",
+  "ARG    -145.8 -168.7   11.0  100.2  0.0",
+  "ARG    -113.8  -80.3  175.0   61.6  0.0",
+  "ARG    -175.6  117.9 -121.9 -143.5  0.0",
+  "ARG      64.0  -97.6 -167.7 -169.8  0.0",
+  "ARG    -159.0   97.7  -99.9  -70.6  0.0",
+  "ARG      44.4  138.1  -22.7  129.7  0.0",
+  "ARG    -122.3   68.5  101.6   71.6  0.0",
+  "ARG     147.4   99.4   52.8  150.0  0.0",
+  "ARG    -161.9  155.5   -4.9 -142.5  0.0",
+  "ARG      81.4 -115.0  116.8  104.5  0.0",
+  "ARG      14.2 -115.0 -163.0  171.3  0.0",
+  "ARG     -72.5  -91.9  162.4  -27.9  0.0",
+  "SER      65.3",
+  "SER     -71.8",
+  "SER     173.4",
+  "SER       9.7",
+  "SER    -140.6",
+  "SER     132.9",
+  "SER     -31.2",
+  "THR      58.6",
+  "THR     -55.3",
+  "THR    -171.0",
+  "THR    -120.5",
+  "THR     124.3",
+  "THR       3.4",
+  "VAL     166.6",
+  "VAL    -178.4",
+  "VAL      79.4",
+  "VAL     -61.6",
+  "TRP     -72.9   93.2",
+  "TRP     166.7 -126.3",
+  "TRP     177.6   83.7",
+  "TRP     173.9   40.2",
+  "TRP      47.3 -103.9",
+  "TRP     -67.6   22.3",
+  "TRP      59.4   83.4",
+  "TRP     -73.6  -98.5",
+  "TRP     -85.0  -22.2",
+  "TRP    -173.5  -82.5",
+  "TRP    -171.7  -27.1",
+  "TRP      73.5  -51.4",
+  "TRP    -146.3 -124.7",
+  "TRP     -53.4  137.4",
+  "TRP     -83.5 -153.9",
+  "TRP      63.4   16.3",
+  "TRP    -119.1   57.4",
+  "TRP     103.4  109.0",
+  "TYR     -63.2  -83.8",
+  "TYR    -171.3  -78.4",
+  "TYR      39.6   77.3",
+  "TYR    -169.5   44.9",
+  "TYR     -73.4  -32.0",
+  "TYR     -87.4   52.7",
+  "TYR      86.1  -88.1",
+  "TYR     -81.1   10.2",
+  "TYR    -166.8  -29.1",
+  "TYR      19.1  -62.1",
+  "TYR     149.7   57.3",
+  "TYR    -169.5    4.4",
+  "TYR     -21.5   64.2",
+  "TYR     133.0  -66.9",
+  "TYR      78.7  -11.8",
+  "TYR    -119.1  -50.8",
+};
+
+EmbeddedFile embeddedFiles[] = {
+  {"param_charmm19_lk_ref2015.prm", embeddedLines0, 250},
+  {"top_polh19_prot.inp", embeddedLines1, 1205},
+  {"rotlib984.txt", embeddedLines2, 1007},
+};
+
+int embeddedFileCount = 3;
@@ -17,6 +17,7 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 ********************************************************************************************************************************/
 
 #include "EnergyComputation.h"
+#include "Profiler.h"
 
 ////////////////////////////////////////////////////////////////////////////////////
 // compute energy with foldx packing and solvation method
@@ -45,6 +46,7 @@ int FOLDEF_StructureCalculateAtomOccupancy14(Structure* pStructure){
     for(ir = 0; ir < resiNumOfChainI; ir++){
       Residue *pResIR = pChainI->residues + ir;
       int atomNumOfResIR = pResIR->atoms.atomNum;
+      int context = BondSeparationFindContext(ResidueGetBonds(pResIR));
       for(atom1 = 0; atom1 < atomNumOfResIR; atom1++){
         Atom *pAtom1 = pResIR->atoms.atoms + atom1;
         if(AtomIsHydrogen(pAtom1))continue;
@@ -57,7 +59,7 @@ int FOLDEF_StructureCalculateAtomOccupancy14(Structure* pStructure){
             double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
             if(distance < VDW_DISTANCE_CUTOFF){
               //int bondConnection = ResidueIntraBondConnectionCheck(pAtom1->name, pAtom2->name, pResIR);
-              int bondConnection = ResidueIntraBondConnectionCheck(pAtom1->name, pAtom2->name, ResidueGetBonds(pResIR));
+              int bondConnection = BondSeparationIntraResidue(context, pAtom1, pAtom2, ResidueGetBonds(pResIR));
               if(bondConnection == 12 || bondConnection == 13){
                 ;
               }
@@ -78,7 +80,7 @@ int FOLDEF_StructureCalculateAtomOccupancy14(Structure* pStructure){
             double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
             if(is == ir+1){
               if(distance < VDW_DISTANCE_CUTOFF){
-                int bondConnection = ResidueAndNextResidueInterBondConnectionCheck_charmm19(pAtom1->name, pAtom2->name, pResIR, pResIS);
+                int bondConnection = BondSeparationNextResidue(pAtom1, pAtom2, pResIR, pResIS);
                 if(bondConnection == 12 || bondConnection == 13){
                   ;
                 }
@@ -240,6 +242,7 @@ int FOLDEF_ChainCalculateAtomOccupancy14(Structure* pStructure, int chainIndex){
   for(ir = 0; ir < resiNumOfChainI; ir++){
     Residue *pResIR = pChainI->residues+ir;
     int atomNumOfResIR = pResIR->atoms.atomNum;
+    int context = BondSeparationFindContext(ResidueGetBonds(pResIR));
     for(atom1 = 0; atom1 < atomNumOfResIR; atom1++){
       Atom *pAtom1 = pResIR->atoms.atoms+atom1;
       if(AtomIsHydrogen(pAtom1))continue;
@@ -251,7 +254,7 @@ int FOLDEF_ChainCalculateAtomOccupancy14(Structure* pStructure, int chainIndex){
           double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
           if(distance < VDW_DISTANCE_CUTOFF){
             //int bondConnection = ResidueIntraBondConnectionCheck(pAtom1->name, pAtom2->name, pResIR);
-            int bondConnection = ResidueIntraBondConnectionCheck(pAtom1->name, pAtom2->name, ResidueGetBonds(pResIR));
+            int bondConnection = BondSeparationIntraResidue(context, pAtom1, pAtom2, ResidueGetBonds(pResIR));
             if(bondConnection == 12 || bondConnection == 13){
               ;
             }
@@ -272,7 +275,7 @@ int FOLDEF_ChainCalculateAtomOccupancy14(Structure* pStructure, int chainIndex){
           double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
           if(is == ir+1){
             if(distance < VDW_DISTANCE_CUTOFF){
-              int bondConnection = ResidueAndNextResidueInterBondConnectionCheck_charmm19(pAtom1->name, pAtom2->name, pResIR, pResIS);
+              int bondConnection = BondSeparationNextResidue(pAtom1, pAtom2, pResIR, pResIS);
               if(bondConnection == 12 || bondConnection == 13){
                 ;
               }
@@ -371,6 +374,7 @@ int FOLDEF_ComputeChainFoldingFreeEnergy(Structure *pStructure, int chainIndex,
   for(int ir = 0; ir < ChainGetResidueCount(pChainI); ir++){
     Residue *pResIR = ChainGetResidue(pChainI,ir);
     ResidueReferenceEnergy(pResIR, energyTerms);
+    int context = BondSeparationFindContext(ResidueGetBonds(pResIR));
     for(int atom1 = 0; atom1 < ResidueGetAtomCount(pResIR); atom1++){
       Atom *pAtom1 = ResidueGetAtom(pResIR, atom1);
       // atoms in the same residue
@@ -379,7 +383,7 @@ int FOLDEF_ComputeChainFoldingFreeEnergy(Structure *pStructure, int chainIndex,
         if((pAtom1->isBBAtom == TRUE && pAtom2->isBBAtom == FALSE) || (pAtom1->isBBAtom == FALSE && pAtom2->isBBAtom == TRUE)){
           double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
           if(distance < VDW_DISTANCE_CUTOFF){
-            int bondConnection = ResidueIntraBondConnectionCheck(pAtom1->name, pAtom2->name, ResidueGetBonds(pResIR));
+            int bondConnection = BondSeparationIntraResidue(context, pAtom1, pAtom2, ResidueGetBonds(pResIR));
             if(bondConnection == 12 || bondConnection == 13){
               ;
             }
@@ -401,7 +405,7 @@ int FOLDEF_ComputeChainFoldingFreeEnergy(Structure *pStructure, int chainIndex,
           double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
           if(distance < VDW_DISTANCE_CUTOFF){
             if(is == ir+1){
-              int bondConnection = ResidueAndNextResidueInterBondConnectionCheck_charmm19(pAtom1->name, pAtom2->name, pResIR, pResIS);
+              int bondConnection = BondSeparationNextResidue(pAtom1, pAtom2, pResIR, pResIS);
               if(bondConnection == 12 || bondConnection == 13){
                 ;
               }
@@ -482,6 +486,7 @@ int FOLDEF_ComputeStructureFoldingFreeEnergy(Structure *pStructure, double *ener
     for(int ir = 0; ir < ChainGetResidueCount(pChainI); ir++){
       Residue *pResIR = ChainGetResidue(pChainI,ir);
       ResidueReferenceEnergy(pResIR, energyTerms);
+      int context = BondSeparationFindContext(ResidueGetBonds(pResIR));
       for(int atom1 = 0; atom1 < ResidueGetAtomCount(pResIR); atom1++){
         Atom *pAtom1 = pResIR->atoms.atoms + atom1;
         // atoms in the same residue
@@ -490,7 +495,7 @@ int FOLDEF_ComputeStructureFoldingFreeEnergy(Structure *pStructure, double *ener
           if((pAtom1->isBBAtom == TRUE && pAtom2->isBBAtom == FALSE) || (pAtom1->isBBAtom == FALSE && pAtom2->isBBAtom == TRUE)){
             double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
             if(distance < VDW_DISTANCE_CUTOFF){
-              int bondConnection = ResidueIntraBondConnectionCheck(pAtom1->name, pAtom2->name, ResidueGetBonds(pResIR));
+              int bondConnection = BondSeparationIntraResidue(context, pAtom1, pAtom2, ResidueGetBonds(pResIR));
               if(bondConnection == 12 || bondConnection == 13){
                 ;
               }
@@ -512,7 +517,7 @@ int FOLDEF_ComputeStructureFoldingFreeEnergy(Structure *pStructure, double *ener
             double distance = XYZDistance(&pAtom1->xyz, &pAtom2->xyz);
             if(distance < VDW_DISTANCE_CUTOFF){
               if(is == ir+1){
-                int bondConnection = ResidueAndNextResidueInterBondConnectionCheck_charmm19(pAtom1->name, pAtom2->name, pResIR, pResIS);
+                int bondConnection = BondSeparationNextResidue(pAtom1, pAtom2, pResIR, pResIS);
                 if(bondConnection == 12 || bondConnection == 13){
                   ;
                 }
@@ -637,32 +642,168 @@ int FOLDEF_ComputeStructureBindingEnergy(Structure *pStructure, double *energyTe
 // use residue-to-residue energy function
 //////////////////////////////////////////////////////////////////////////////////////
 
-int EvoEF_ComputeChainStability(Structure *pStructure, int chainIndex, double *energyTerms){
+// every energy task works on one row of the cell list, i.e. one residue and its pairs with the residues behind it,
+// and writes to its own row of terms. the rows are summed in index order afterwards, so the result does not depend on
+// the number of threads or on the order in which the rows are processed
+typedef struct _EnergyRowTask{
+  CellList* pCellList;      // 4/8 bytes
+  ResiduePack* packs;       // 4/8 bytes, one per residue
+  IntArray* neighbors;      // 4/8 bytes, one per thread
+  double* ratiosComplex;    // 4/8 bytes, binding only
+  double* ratiosChain;      // 4/8 bytes, binding only
+  double* rowTerms;         // 4/8 bytes, MAX_EVOEF_ENERGY_TERM_NUM per residue
+  double* rowTermsChain;    // 4/8 bytes, MAX_EVOEF_ENERGY_TERM_NUM per residue, binding only
+  int residueNum;           // 4 bytes
+} EnergyRowTask;
+
+int EnergyRowTaskCreate(EnergyRowTask* pThis, CellList* pCellList, BOOL binding){
+  int residueCount = CellListGetResidueCount(pCellList);
+  int threadCount = ThreadPoolGetThreadCount();
+  pThis->pCellList = pCellList;
+  pThis->residueNum = residueCount;
+  pThis->packs = (ResiduePack*)malloc(sizeof(ResiduePack)*(residueCount+1));
+  pThis->neighbors = (IntArray*)malloc(sizeof(IntArray)*threadCount);
+  for(int t = 0; t < threadCount; t++) IntArrayCreate(&pThis->neighbors[t], 0);
+  pThis->rowTerms = (double*)calloc(MAX_EVOEF_ENERGY_TERM_NUM*(residueCount+1), sizeof(double));
+  pThis->ratiosComplex = pThis->ratiosChain = pThis->rowTermsChain = NULL;
+  if(binding){
+    pThis->ratiosComplex = (double*)malloc(sizeof(double)*(residueCount+1));
+    pThis->ratiosChain = (double*)malloc(sizeof(double)*(residueCount+1));
+    pThis->rowTermsChain = (double*)calloc(MAX_EVOEF_ENERGY_TERM_NUM*(residueCount+1), sizeof(double));
+  }
+  return Success;
+}
+
+int EnergyRowTaskDestroy(EnergyRowTask* pThis){
+  for(int index = 0; index < pThis->residueNum; index++) ResiduePackDestroy(&pThis->packs[index]);
+  for(int t = 0; t < ThreadPoolGetThreadCount(); t++) IntArrayDestroy(&pThis->neighbors[t]);
+  free(pThis->packs);
+  free(pThis->neighbors);
+  free(pThis->rowTerms);
+  free(pThis->ratiosComplex);
+  free(pThis->ratiosChain);
+  free(pThis->rowTermsChain);
+  return Success;
+}
+
+int EnergyRowTaskReduce(double* rowTerms, int residueNum, double *energyTerms){
+  for(int index = 0; index < residueNum; index++){
+    double* terms = rowTerms+MAX_EVOEF_ENERGY_TERM_NUM*index;
+    for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] += terms[i];
+  }
+  return Success;
+}
+
+int EnergyRowTaskBuildPack(void* pArgs, int index, int /*threadIndex*/){
+  EnergyRowTask* pTask = (EnergyRowTask*)pArgs;
+  ResiduePackCreate(&pTask->packs[index]);
+  ResiduePackBuild(&pTask->packs[index], CellListGetResidue(pTask->pCellList, index));
+  return Success;
+}
+
+int EnergyRowTaskStability(void* pArgs, int index, int threadIndex){
+  EnergyRowTask* pTask = (EnergyRowTask*)pArgs;
+  CellList* pCellList = pTask->pCellList;
+  IntArray* pNeighbors = &pTask->neighbors[threadIndex];
+  double* energyTerms = pTask->rowTerms+MAX_EVOEF_ENERGY_TERM_NUM*index;
+  Residue *pResIR = CellListGetResidue(pCellList, index);
+  int i = CellListGetChainIndex(pCellList, index);
+  int ir = CellListGetResidueIndex(pCellList, index);
+  double ratio1 = CalcResidueBuriedRatio(pResIR);
+  ResidueReferenceEnergy(pResIR, energyTerms);
+  EVOEF_EnergyResidueSelfEnergy(pResIR,ratio1,energyTerms);
+  CellListGetNeighbors(pCellList, index, pNeighbors);
+  for(int n = 0; n < IntArrayGetLength(pNeighbors); n++){
+    int neighbor = IntArrayGet(pNeighbors, n);
+    Residue *pResIS = CellListGetResidue(pCellList, neighbor);
+    double ratio2 = CalcResidueBuriedRatio(pResIS);
+    double ratio12 = CalcAverageBuriedRatio(ratio1, ratio2);
+    if(CellListGetChainIndex(pCellList, neighbor) == i){
+      if(CellListGetResidueIndex(pCellList, neighbor)==ir+1) EVOEF_EnergyResidueAndNextResidue(pResIR,pResIS,ratio12,energyTerms);
+#if ENERGY_USE_PACKED_KERNEL
+      else EVOEF_EnergyPackedResidueAndOtherResidue(&pTask->packs[index],&pTask->packs[neighbor],ratio12,TRUE,energyTerms);
+#else
+      else EVOEF_EnergyResidueAndOtherResidueSameChain(pResIR,pResIS,ratio12,energyTerms);
+#endif
+    }
+    else{
+#if ENERGY_USE_PACKED_KERNEL
+      EVOEF_EnergyPackedResidueAndOtherResidue(&pTask->packs[index],&pTask->packs[neighbor],ratio12,FALSE,energyTerms);
+#else
+      EVOEF_EnergyResidueAndOtherResidueDifferentChain(pResIR,pResIS,ratio12,energyTerms);
+#endif
+    }
+  }
+  return Success;
+}
+
+int EnergyRowTaskBinding(void* pArgs, int index, int threadIndex){
+  EnergyRowTask* pTask = (EnergyRowTask*)pArgs;
+  CellList* pCellList = pTask->pCellList;
+  IntArray* pNeighbors = &pTask->neighbors[threadIndex];
+  double* ratiosComplex = pTask->ratiosComplex;
+  double* ratiosChain = pTask->ratiosChain;
+  double* energyTerms = pTask->rowTerms+MAX_EVOEF_ENERGY_TERM_NUM*index;
+  double* energyTermsChain = pTask->rowTermsChain+MAX_EVOEF_ENERGY_TERM_NUM*index;
+  Residue *pResIR = CellListGetResidue(pCellList, index);
+  int i = CellListGetChainIndex(pCellList, index);
+  int ir = CellListGetResidueIndex(pCellList, index);
+  BOOL changed = ratiosComplex[index] != ratiosChain[index];
+  if(changed){
+    EVOEF_EnergyResidueSelfEnergy(pResIR,ratiosComplex[index],energyTerms);
+    EVOEF_EnergyResidueSelfEnergy(pResIR,ratiosChain[index],energyTermsChain);
+  }
+  CellListGetNeighbors(pCellList, index, pNeighbors);
+  for(int n = 0; n < IntArrayGetLength(pNeighbors); n++){
+    int neighbor = IntArrayGet(pNeighbors, n);
+    BOOL sameChain = CellListGetChainIndex(pCellList, neighbor) == i;
+    if(sameChain && !changed && ratiosComplex[neighbor] == ratiosChain[neighbor]) continue;
+    BOOL nextResidue = sameChain && CellListGetResidueIndex(pCellList, neighbor) == ir+1;
+    double ratio12 = CalcAverageBuriedRatio(ratiosComplex[index], ratiosComplex[neighbor]);
+    double ratio12Chain = CalcAverageBuriedRatio(ratiosChain[index], ratiosChain[neighbor]);
+    EvoEF_ComputeResiduePairBinding(&pTask->packs[index],&pTask->packs[neighbor],sameChain,nextResidue,ratio12,ratio12Chain,energyTerms,energyTermsChain);
+  }
+  return Success;
+}
+
+// unweighted stability terms of one chain, or of all chains if chainIndex < 0, the burial counts must be up to date
+int EvoEF_ComputeStabilityTerms(Structure *pStructure, int chainIndex, double *energyTerms){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_EnergyEvaluation);
   for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
     energyTerms[i] = 0.0;
   }
+  // only residue pairs with overlapping bounding spheres are visited, the others have no atom pair within the cutoff
+  CellList cellList;
+  CellListCreate(&cellList);
+  CellListBuild(&cellList, pStructure, chainIndex, VDW_DISTANCE_CUTOFF);
+  EnergyRowTask task;
+  EnergyRowTaskCreate(&task, &cellList, FALSE);
+  ThreadPoolRun(task.residueNum, EnergyRowTaskBuildPack, &task);
+  ThreadPoolRun(task.residueNum, EnergyRowTaskStability, &task);
+  EnergyRowTaskReduce(task.rowTerms, task.residueNum, energyTerms);
+  EnergyRowTaskDestroy(&task);
+  CellListDestroy(&cellList);
+  ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
+  return Success;
+}
+
+int EvoEF_ComputeChainStability(Structure *pStructure, int chainIndex, double *energyTerms){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_EnergyEvaluation);
   ChainComputeResiduePosition(pStructure, chainIndex);
   Chain *pChainI = StructureGetChain(pStructure, chainIndex);
-  // interaction between residues within one chain
-  for(int ir = 0; ir < ChainGetResidueCount(pChainI); ir++){
-    Residue *pResIR = ChainGetResidue(pChainI,ir);
-    double ratio1 = CalcResidueBuriedRatio(pResIR);
-    ResidueReferenceEnergy(pResIR, energyTerms);
-    EVOEF_EnergyResidueSelfEnergy(pResIR,ratio1,energyTerms);
-    for(int is = ir+1; is < ChainGetResidueCount(pChainI); is++){
-      Residue *pResIS = ChainGetResidue(pChainI,is);
-      double ratio2 = CalcResidueBuriedRatio(pResIS);
-      double ratio12 = CalcAverageBuriedRatio(ratio1, ratio2);
-      if(is==ir+1) EVOEF_EnergyResidueAndNextResidue(pResIR,pResIS,ratio12,energyTerms);
-      else EVOEF_EnergyResidueAndOtherResidueSameChain(pResIR,pResIS,ratio12,energyTerms);
-    }
-  }
-  
+  EvoEF_ComputeStabilityTerms(pStructure, chainIndex, energyTerms);
+
   //total energy: weighted
   EnergyTermWeighting(energyTerms);
   for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
     energyTerms[0] += energyTerms[i];
   }
+  if(!EnergyOutputIsText()){
+    char evaluation[MAX_LENGTH_CHAIN_NAME+7];
+    sprintf(evaluation, "chain %s", ChainGetName(pChainI));
+    ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
+    return EnergyOutputWrite(evaluation, energyTerms);
+  }
 
   //energy details: not weighted
   printf("Chain %s energy details:\n", ChainGetName(pChainI));
@@ -717,7 +858,87 @@ int EvoEF_ComputeChainStability(Structure *pStructure, int chainIndex, double *e
   printf("----------------------------------------------------\n");
   printf("Total                 =            %8.2f\n\n", energyTerms[0]);
 
+  ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
   return Success;
 }
 
 
+
+// burial ratio of every cell list residue in the separated chains and in the complex,
+// the residues are left with the nCbIn8A counts of the complex
+int EvoEF_ComputeBurialRatios(Structure *pStructure, CellList* pCellList, double* ratiosComplex, double* ratiosChain){
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    ChainComputeResiduePosition(pStructure, i);
+  }
+  for(int index = 0; index < CellListGetResidueCount(pCellList); index++){
+    ratiosChain[index] = CalcResidueBuriedRatio(CellListGetResidue(pCellList, index));
+  }
+  StructureComputeResiduePosition(pStructure);
+  for(int index = 0; index < CellListGetResidueCount(pCellList); index++){
+    ratiosComplex[index] = CalcResidueBuriedRatio(CellListGetResidue(pCellList, index));
+  }
+  return Success;
+}
+
+// binding contribution of one residue pair, an inter-chain pair goes into energyTerms only, while a same-chain pair
+// is evaluated with the ratio of the complex into energyTerms and with the ratio of the separated chain into energyTermsChain
+int EvoEF_ComputeResiduePairBinding(ResiduePack* pPack1, ResiduePack* pPack2, BOOL sameChain, BOOL nextResidue, double ratio12, double ratio12Chain, double *energyTerms, double *energyTermsChain){
+  Residue* pResIR = ResiduePackGetResidue(pPack1);
+  Residue* pResIS = ResiduePackGetResidue(pPack2);
+  if(!sameChain){
+#if ENERGY_USE_PACKED_KERNEL
+    EVOEF_EnergyPackedResidueAndOtherResidue(pPack1,pPack2,ratio12,FALSE,energyTerms);
+#else
+    EVOEF_EnergyResidueAndOtherResidueDifferentChain(pResIR,pResIS,ratio12,energyTerms);
+#endif
+  }
+  else if(nextResidue){
+    EVOEF_EnergyResidueAndNextResidue(pResIR,pResIS,ratio12,energyTerms);
+    EVOEF_EnergyResidueAndNextResidue(pResIR,pResIS,ratio12Chain,energyTermsChain);
+  }
+  else{
+#if ENERGY_USE_PACKED_KERNEL
+    EVOEF_EnergyPackedResidueAndOtherResidue(pPack1,pPack2,ratio12,TRUE,energyTerms);
+    EVOEF_EnergyPackedResidueAndOtherResidue(pPack1,pPack2,ratio12Chain,TRUE,energyTermsChain);
+#else
+    EVOEF_EnergyResidueAndOtherResidueSameChain(pResIR,pResIS,ratio12,energyTerms);
+    EVOEF_EnergyResidueAndOtherResidueSameChain(pResIR,pResIS,ratio12Chain,energyTermsChain);
+#endif
+  }
+  return Success;
+}
+
+// binding energy from the inter-chain pairs only, intra-chain pairs cancel between the complex and the separated chains
+// except through the burial ratio, so self and same-chain pair energies are re-evaluated only for residues whose
+// nCbIn8A-based ratio changes on separation. the terms equal those of EvoEF_Stability minus the sum of EvoEF_ComputeChainStability
+int EvoEF_ComputeBinding(Structure *pStructure, double *energyTerms){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_EnergyEvaluation);
+  double energyTermsChain[MAX_EVOEF_ENERGY_TERM_NUM];
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    energyTerms[i] = 0.0;
+    energyTermsChain[i] = 0.0;
+  }
+  CellList cellList;
+  CellListCreate(&cellList);
+  CellListBuild(&cellList, pStructure, -1, VDW_DISTANCE_CUTOFF);
+  EnergyRowTask task;
+  EnergyRowTaskCreate(&task, &cellList, TRUE);
+  EvoEF_ComputeBurialRatios(pStructure, &cellList, task.ratiosComplex, task.ratiosChain);
+  ThreadPoolRun(task.residueNum, EnergyRowTaskBuildPack, &task);
+  ThreadPoolRun(task.residueNum, EnergyRowTaskBinding, &task);
+  EnergyRowTaskReduce(task.rowTerms, task.residueNum, energyTerms);
+  EnergyRowTaskReduce(task.rowTermsChain, task.residueNum, energyTermsChain);
+  EnergyRowTaskDestroy(&task);
+  CellListDestroy(&cellList);
+
+  // the weighting is linear, so weighting the difference equals the difference of the weighted terms
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    energyTerms[i] -= energyTermsChain[i];
+  }
+  EnergyTermWeighting(energyTerms);
+  for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    energyTerms[0] += energyTerms[i];
+  }
+  ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
+  return Success;
+}
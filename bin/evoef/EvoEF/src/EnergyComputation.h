@@ -21,6 +21,10 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Structure.h"
 #include "EnergyFunction.h"
+#include "CellList.h"
+#include "ThreadPool.h"
+#include "BondSeparation.h"
+#include "EnergyOutput.h"
 
 
 //FOLDX energy functions
@@ -32,5 +36,9 @@ int FOLDEF_ComputeChainFoldingFreeEnergy(Structure *pStructure, int chainIndex,
 int FOLDEF_ComputeStructureFoldingFreeEnergy(Structure *pStructure, double *energyTerms);
 int FOLDEF_ComputeStructureBindingEnergy(Structure *pStructure, double *energyTerms);
 
+int EvoEF_ComputeStabilityTerms(Structure *pStructure, int chainIndex, double *energyTerms);
 int EvoEF_ComputeChainStability(Structure *pStructure, int chainIndex, double *energyTerms);
+int EvoEF_ComputeBurialRatios(Structure *pStructure, CellList* pCellList, double* ratiosComplex, double* ratiosChain);
+int EvoEF_ComputeResiduePairBinding(ResiduePack* pPack1, ResiduePack* pPack2, BOOL sameChain, BOOL nextResidue, double ratio12, double ratio12Chain, double *energyTerms, double *energyTermsChain);
+int EvoEF_ComputeBinding(Structure *pStructure, double *energyTerms);
 #endif
@@ -17,6 +17,9 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 ********************************************************************************************************************************/
 
 #include "EnergyFunction.h"
+#include "EnergyTable.h"
+#include "BondSeparation.h"
+#include "Profiler.h"
 #include "Atom.h"
 #include "Residue.h"
 #include <stdlib.h>
@@ -270,7 +273,12 @@ int VdwAttEnergyAtomAndAtom(Residue* pResi1, Residue* pResi2, Atom *pAtom1, Atom
   if(distance>=VDW_DISTANCE_CUTOFF) return Success;
   if(bondType==12||bondType==13) return Success;
   if(AtomIsHydrogen(pAtom1) || AtomIsHydrogen(pAtom2)) return Success;
-  double rmin = RADIUS_SCALE_FOR_VDW * (pAtom1->CHARMM_radius + pAtom2->CHARMM_radius);
+  EnergyTable* pTable = EnergyTableGet();
+  int pairIndex = -1;
+  if(EnergyTableIsEnabled() && pAtom1->energyType >= 0 && pAtom2->energyType >= 0){
+    pairIndex = EnergyTablePairIndex(pAtom1->energyType, pAtom2->energyType);
+  }
+  double rmin = pairIndex >= 0 ? pTable->pairRmin[pairIndex] : RADIUS_SCALE_FOR_VDW * (pAtom1->CHARMM_radius + pAtom2->CHARMM_radius);
   double ratio = distance/rmin;
   double energy=0.0;
   double scale=0.0;
@@ -281,11 +289,15 @@ int VdwAttEnergyAtomAndAtom(Residue* pResi1, Residue* pResi2, Atom *pAtom1, Atom
     energy=0.0;
   }
   else if(distance <= 5.0){
-    double epsilon  = sqrt(pAtom1->CHARMM_epsilon*pAtom2->CHARMM_epsilon);
+    double epsilon  = pairIndex >= 0 ? pTable->pairEpsilon[pairIndex] : sqrt(pAtom1->CHARMM_epsilon*pAtom2->CHARMM_epsilon);
     double B6 = pow(1/ratio, 6.0);
     double A12 = B6*B6;
     energy = epsilon * (A12 - 2.0 * B6);
   }
+  else if(distance > 5.0 && distance < VDW_DISTANCE_CUTOFF && pairIndex >= 0){
+    double* coefficients = pTable->pairSwitch + 4*pairIndex;
+    energy = coefficients[0] * distance * distance * distance + coefficients[1] * distance * distance + coefficients[2] * distance + coefficients[3];
+  }
   else if(distance > 5.0 && distance < VDW_DISTANCE_CUTOFF){
     double epsilon  = sqrt(pAtom1->CHARMM_epsilon*pAtom2->CHARMM_epsilon);
     double B6 = pow((double)rmin/5.0, 6.0);
@@ -314,9 +326,17 @@ int VdwAttEnergyAtomAndAtom(Residue* pResi1, Residue* pResi2, Atom *pAtom1, Atom
 int VdwRepEnergyAtomAndAtom(Residue* pResi1, Residue* pResi2, Atom *pAtom1, Atom *pAtom2, double *vdwRep, double distance,int bondType){
   if(bondType==12||bondType==13) return Success;
   //if(AtomIsHydrogen(pAtom1) || AtomIsHydrogen(pAtom2)) return Success;
-  double rmin = RADIUS_SCALE_FOR_VDW * (pAtom1->CHARMM_radius + pAtom2->CHARMM_radius);
+  double rmin, epsilon;
+  if(EnergyTableIsEnabled() && pAtom1->energyType >= 0 && pAtom2->energyType >= 0){
+    int pairIndex = EnergyTablePairIndex(pAtom1->energyType, pAtom2->energyType);
+    rmin = EnergyTableGet()->pairRmin[pairIndex];
+    epsilon = EnergyTableGet()->pairEpsilon[pairIndex];
+  }
+  else{
+    rmin = RADIUS_SCALE_FOR_VDW * (pAtom1->CHARMM_radius + pAtom2->CHARMM_radius);
+    epsilon  = sqrt(pAtom1->CHARMM_epsilon*pAtom2->CHARMM_epsilon);
+  }
   double ratio = distance/rmin;
-  double epsilon  = sqrt(pAtom1->CHARMM_epsilon*pAtom2->CHARMM_epsilon);
   double RATIO_CUTOFF = 0.70; // can be adjusted
   double energy=0.0;
   double scale=0.0;
@@ -365,8 +385,8 @@ int HBondEnergyAtomAndAtom(Residue *pDonor, Residue *pAcceptor,Atom *atomH, Atom
   energyR = HBOND_WELL_DEPTH * (5.0 * A12- 6.0 * B10);
   if(energyR > 0.0) return Success;
 
-  Atom *atomD = ResidueGetAtomByName(pDonor, AtomGetHbDorB(atomH));
-  Atom *atomB = ResidueGetAtomByName(pAcceptor, AtomGetHbDorB(atomA));
+  Atom *atomD = ResidueGetHbDorBAtom(pDonor, atomH);
+  Atom *atomB = ResidueGetHbDorBAtom(pAcceptor, atomA);
   XYZ xyzDH = XYZDifference(&atomD->xyz, &atomH->xyz);
   XYZ xyzHA = XYZDifference(&atomH->xyz, &atomA->xyz);
   XYZ xyzAAB = XYZDifference(&atomA->xyz, &atomB->xyz);
@@ -523,8 +543,8 @@ double HBondEnergyPhiSP3(double anglePhi){
 int HBondEnergyAtomAndAtomKortemmeModel(Residue *pDonor, Residue *pAcceptor,Atom *atomH, Atom *atomA, double *hbond, double distanceHA,double ratio12,int bondType){
   if(bondType==12||bondType==13) return Success;
   if(distanceHA > HBOND_DISTANCE_CUTOFF_MAX) return Success;
-  Atom *atomD = ResidueGetAtomByName(pDonor, AtomGetHbDorB(atomH));
-  Atom *atomB = ResidueGetAtomByName(pAcceptor, AtomGetHbDorB(atomA));
+  Atom *atomD = ResidueGetHbDorBAtom(pDonor, atomH);
+  Atom *atomB = ResidueGetHbDorBAtom(pAcceptor, atomA);
   XYZ xyzDH = XYZDifference(&atomD->xyz, &atomH->xyz);
   XYZ xyzHA = XYZDifference(&atomH->xyz, &atomA->xyz);
   XYZ xyzAAB = XYZDifference(&atomA->xyz, &atomB->xyz);
@@ -576,8 +596,8 @@ int HBondEnergyAtomAndAtomKortemmeModel(Residue *pDonor, Residue *pAcceptor,Atom
 int HBondEnergyAtomAndAtomNewFunction(Residue *pDonor, Residue *pAcceptor,Atom *atomH, Atom *atomA, double *etotal, double *edist, double *etheta, double *ephi,double distanceHA,double ratio12,int bondType){
   if(bondType==12||bondType==13) return Success;
   if(distanceHA > HBOND_DISTANCE_CUTOFF_MAX) return Success;
-  Atom *atomD = ResidueGetAtomByName(pDonor, AtomGetHbDorB(atomH));
-  Atom *atomB = ResidueGetAtomByName(pAcceptor, AtomGetHbDorB(atomA));
+  Atom *atomD = ResidueGetHbDorBAtom(pDonor, atomH);
+  Atom *atomB = ResidueGetHbDorBAtom(pAcceptor, atomA);
   XYZ xyzDH = XYZDifference(&atomD->xyz, &atomH->xyz);
   XYZ xyzHA = XYZDifference(&atomH->xyz, &atomA->xyz);
   XYZ xyzAAB = XYZDifference(&atomA->xyz, &atomB->xyz);
@@ -670,15 +690,21 @@ int LKDesolvationEnergyAtomAndAtom(Residue *pResi1, Residue *pResi2, Atom *pAtom
   *energyH = 0.0;
 
   distance = distance < r12 ? r12 : distance;
-  double lamda1 = pAtom1->EEF1_lamda_ * distance * distance;
-  double lamda2 = pAtom2->EEF1_lamda_ * distance * distance;
-  double x1 = (distance - r1)/pAtom1->EEF1_lamda_;
-  double x2 = (distance - r2)/pAtom2->EEF1_lamda_;
-
-  double desolv12 = coefficient * volume2 * dGFreeAtom1 / lamda1;
-  desolv12 *= exp( -1.0 * x1 * x1 );
-  double desolv21 = coefficient * volume1 * dGFreeAtom2 / lamda2;
-  desolv21 *= exp( -1.0 * x2 * x2 );
+  double desolv12, desolv21;
+  if(EnergyTableIsEnabled() && pAtom1->energyType >= 0 && pAtom2->energyType >= 0){
+    desolv12 = volume2 * EnergyTableDesolvationFactor(pAtom1->energyType, distance);
+    desolv21 = volume1 * EnergyTableDesolvationFactor(pAtom2->energyType, distance);
+  }
+  else{
+    double lamda1 = pAtom1->EEF1_lamda_ * distance * distance;
+    double lamda2 = pAtom2->EEF1_lamda_ * distance * distance;
+    double x1 = (distance - r1)/pAtom1->EEF1_lamda_;
+    double x2 = (distance - r2)/pAtom2->EEF1_lamda_;
+    desolv12 = coefficient * volume2 * dGFreeAtom1 / lamda1;
+    desolv12 *= exp( -1.0 * x1 * x1 );
+    desolv21 = coefficient * volume1 * dGFreeAtom2 / lamda2;
+    desolv21 *= exp( -1.0 * x2 * x2 );
+  }
   if(pAtom1->polarity == Type_AtomPolarity_P || pAtom1->polarity == Type_AtomPolarity_C) *energyP += desolv12;
   else *energyH += desolv12;
   if(pAtom2->polarity == Type_AtomPolarity_P || pAtom2->polarity == Type_AtomPolarity_C) *energyP += desolv21;
@@ -725,13 +751,24 @@ int ResidueReferenceEnergy(Residue *pResidue, double energyTerm[MAX_EVOEF_ENERGY
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // the following are energy between residue and residue
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// profiling counters of one call of an energy kernel
+int EnergyCountAtomPairs(long long atomPairs, int pairsInCutoff, BOOL residuePair){
+  if(residuePair) ProfilerCount(Type_ProfileCounter_ResiduePairs, 1);
+  ProfilerCount(Type_ProfileCounter_AtomPairs, atomPairs);
+  ProfilerCount(Type_ProfileCounter_AtomPairsInCutoff, pairsInCutoff);
+  return Success;
+}
+
 int EVOEF_EnergyResidueSelfEnergy(Residue* pThis, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int pairsInCutoff = 0;
+  int context=BondSeparationFindContext(ResidueGetBonds(pThis));
   for(int i=0; i<ResidueGetAtomCount(pThis); ++i){
     Atom* pAtom1=ResidueGetAtom(pThis,i);
     for(int j=i+1; j<ResidueGetAtomCount(pThis);++j){
       Atom* pAtom2=ResidueGetAtom(pThis,j);
       double distance=XYZDistance(&pAtom1->xyz,&pAtom2->xyz);
       if(distance>VDW_DISTANCE_CUTOFF) continue;
+      pairsInCutoff++;
       if(pAtom2->isBBAtom==TRUE && pAtom1->isBBAtom==TRUE){
         //int bondType=ResidueIntraBondConnectionCheck(AtomGetName(pAtom1),AtomGetName(pAtom2),ResidueGetBonds(pThis));
         //if(bondType==12||bondType==13) continue;
@@ -744,7 +781,7 @@ int EVOEF_EnergyResidueSelfEnergy(Residue* pThis, double ratio12,double energyTe
         if(strcmp(ResidueGetName(pThis),"ILE")==0 || strcmp(ResidueGetName(pThis),"MET")==0 ||
           strcmp(ResidueGetName(pThis),"GLN")==0||strcmp(ResidueGetName(pThis),"GLU")==0||
           strcmp(ResidueGetName(pThis),"LYS")==0||strcmp(ResidueGetName(pThis),"ARG")==0){
-            int bondType=ResidueIntraBondConnectionCheck(AtomGetName(pAtom1),AtomGetName(pAtom2),ResidueGetBonds(pThis));
+            int bondType=BondSeparationIntraResidue(context,pAtom1,pAtom2,ResidueGetBonds(pThis));
             if(bondType==12||bondType==13) continue;
             double vdwAtt=0,vdwRep=0,desolvP=0,desolvH=0;
             VdwAttEnergyAtomAndAtom(pThis,pThis,pAtom1,pAtom2,&vdwAtt,distance,bondType);
@@ -758,7 +795,7 @@ int EVOEF_EnergyResidueSelfEnergy(Residue* pThis, double ratio12,double energyTe
       }
       else if((pAtom1->isBBAtom == TRUE && pAtom2->isBBAtom == FALSE) || (pAtom1->isBBAtom == FALSE && pAtom2->isBBAtom == TRUE)){
         if(strcmp(AtomGetName(pAtom1),"CB")==0 || strcmp(AtomGetName(pAtom2),"CB")==0) continue;
-        int bondType=ResidueIntraBondConnectionCheck(AtomGetName(pAtom1),AtomGetName(pAtom2),ResidueGetBonds(pThis));
+        int bondType=BondSeparationIntraResidue(context,pAtom1,pAtom2,ResidueGetBonds(pThis));
         if(bondType==12||bondType==13) continue;
         double vdwAtt=0,vdwRep=0,desolvP=0,desolvH=0,ele=0;
         VdwAttEnergyAtomAndAtom(pThis,pThis,pAtom1,pAtom2,&vdwAtt,distance,bondType);
@@ -798,18 +835,21 @@ int EVOEF_EnergyResidueSelfEnergy(Residue* pThis, double ratio12,double energyTe
     }
 
   }  
+  if(profilerEnabled) EnergyCountAtomPairs((long long)ResidueGetAtomCount(pThis)*(ResidueGetAtomCount(pThis)-1)/2, pairsInCutoff, FALSE);
   return Success;
 }
 
 int EVOEF_EnergyResidueAndNextResidue(Residue* pThis, Residue* pOther, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int pairsInCutoff = 0;
   for(int i=0; i<ResidueGetAtomCount(pThis); ++i){
     Atom* pAtom1=ResidueGetAtom(pThis,i);
     for(int j=0; j<ResidueGetAtomCount(pOther); ++j){
       Atom* pAtom2=ResidueGetAtom(pOther,j);
       double distance=XYZDistance(&pAtom1->xyz,&pAtom2->xyz);
       if(distance>VDW_DISTANCE_CUTOFF) continue;
+      pairsInCutoff++;
       if(pAtom2->isBBAtom==TRUE && pAtom1->isBBAtom==TRUE){
-        int bondType=ResidueAndNextResidueInterBondConnectionCheck_charmm19(AtomGetName(pAtom1),AtomGetName(pAtom2),pThis,pOther);
+        int bondType=BondSeparationNextResidue(pAtom1,pAtom2,pThis,pOther);
         if(bondType==12||bondType==13) continue;
         double desolvP=0.0, desolvH=0.0;
         LKDesolvationEnergyAtomAndAtom(pThis,pOther,pAtom1,pAtom2,&desolvP,&desolvH,distance,bondType);
@@ -854,7 +894,7 @@ int EVOEF_EnergyResidueAndNextResidue(Residue* pThis, Residue* pOther, double ra
         }
       }
       else if((pAtom1->isBBAtom == TRUE && pAtom2->isBBAtom == FALSE) || (pAtom1->isBBAtom == FALSE && pAtom2->isBBAtom == TRUE)){
-        int bondType=ResidueAndNextResidueInterBondConnectionCheck_charmm19(AtomGetName(pAtom1),AtomGetName(pAtom2),pThis,pOther);
+        int bondType=BondSeparationNextResidue(pAtom1,pAtom2,pThis,pOther);
         if(bondType==12||bondType==13)continue;
         double vdwAtt=0,vdwRep=0,desolvP=0,desolvH=0,ele=0;
         VdwAttEnergyAtomAndAtom(pThis,pOther,pAtom1,pAtom2,&vdwAtt,distance,bondType);
@@ -893,16 +933,19 @@ int EVOEF_EnergyResidueAndNextResidue(Residue* pThis, Residue* pOther, double ra
       }
     }
   }
+  if(profilerEnabled) EnergyCountAtomPairs((long long)ResidueGetAtomCount(pThis)*ResidueGetAtomCount(pOther), pairsInCutoff, TRUE);
   return Success;
 }
 
 int EVOEF_EnergyResidueAndOtherResidueSameChain(Residue* pThis, Residue* pOther, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int pairsInCutoff = 0;
   for(int i=0; i<ResidueGetAtomCount(pThis); ++i){
     Atom* pAtom1=ResidueGetAtom(pThis,i);
     for(int j=0; j<ResidueGetAtomCount(pOther); ++j){
       Atom* pAtom2=ResidueGetAtom(pOther,j);
       double distance=XYZDistance(&pAtom1->xyz,&pAtom2->xyz);
       if(distance>VDW_DISTANCE_CUTOFF) continue;
+      pairsInCutoff++;
       int bondType=15;
       double vdwAtt=0,vdwRep=0,ele=0,desolvP=0,desolvH=0;
       VdwAttEnergyAtomAndAtom(pThis,pOther,pAtom1,pAtom2,&vdwAtt,distance,bondType);
@@ -940,17 +983,20 @@ int EVOEF_EnergyResidueAndOtherResidueSameChain(Residue* pThis, Residue* pOther,
       }
     }
   }
+  if(profilerEnabled) EnergyCountAtomPairs((long long)ResidueGetAtomCount(pThis)*ResidueGetAtomCount(pOther), pairsInCutoff, TRUE);
   return Success;
 }
 
 
 int EVOEF_EnergyResidueAndOtherResidueDifferentChain(Residue* pThis, Residue* pOther, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int pairsInCutoff = 0;
   for(int i=0; i<ResidueGetAtomCount(pThis); ++i){
     Atom* pAtom1=ResidueGetAtom(pThis,i);
     for(int j=0; j<ResidueGetAtomCount(pOther); ++j){
       Atom* pAtom2=ResidueGetAtom(pOther,j);
       double distance=XYZDistance(&pAtom1->xyz,&pAtom2->xyz);
       if(distance>VDW_DISTANCE_CUTOFF) continue;
+      pairsInCutoff++;
       int bondType=15;
       double vdwAtt=0,vdwRep=0,ele=0,desolvP=0,desolvH=0;
       VdwAttEnergyAtomAndAtom(pThis,pOther,pAtom1,pAtom2,&vdwAtt,distance,bondType);
@@ -988,6 +1034,156 @@ int EVOEF_EnergyResidueAndOtherResidueDifferentChain(Residue* pThis, Residue* pO
       }
     }
   }
+  if(profilerEnabled) EnergyCountAtomPairs((long long)ResidueGetAtomCount(pThis)*ResidueGetAtomCount(pOther), pairsInCutoff, TRUE);
+  return Success;
+}
+
+
+// packed version of EVOEF_EnergyResidueAndOtherResidueSameChain() and EVOEF_EnergyResidueAndOtherResidueDifferentChain(),
+// distances are screened block by block in a branch-free loop, the five non-hbond terms are then evaluated in one pass;
+// the per-pair arithmetic follows EvoReal and only the sums are kept in double
+int EVOEF_EnergyPackedResidueAndOtherResidue(ResiduePack* pThis, ResiduePack* pOther, double ratio12, BOOL sameChain, double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int pairsInCutoff = 0;
+  int offset = sameChain ? 0 : 50;
+  EvoReal distances[RESIDUE_PACK_BLOCK_SIZE];
+  double RATIO_CUTOFF = 0.70;
+  double B6_0 = pow(1/RATIO_CUTOFF, 6.0);
+  double coefficient = -0.089793561062582974; // 0.5/(pi^1.5)
+  EnergyTable* pTable = EnergyTableGet();
+  BOOL useTable = EnergyTableIsEnabled();
+  for(int i = 0; i < pThis->atomNum; i++){
+    EvoReal x1 = pThis->X[i], y1 = pThis->Y[i], z1 = pThis->Z[i];
+    for(int start = 0; start < pOther->atomNum; start += RESIDUE_PACK_BLOCK_SIZE){
+      int end = start + RESIDUE_PACK_BLOCK_SIZE < pOther->atomNum ? start + RESIDUE_PACK_BLOCK_SIZE : pOther->atomNum;
+      for(int j = start; j < end; j++){
+        EvoReal distX = x1 - pOther->X[j];
+        EvoReal distY = y1 - pOther->Y[j];
+        EvoReal distZ = z1 - pOther->Z[j];
+        distances[j-start] = sqrt(distX * distX + distY * distY + distZ * distZ);
+      }
+      for(int j = start; j < end; j++){
+        EvoReal distance = distances[j-start];
+        if(distance > VDW_DISTANCE_CUTOFF) continue;
+        pairsInCutoff++;
+        int pairIndex = -1;
+        if(useTable && pThis->energyType[i] >= 0 && pOther->energyType[j] >= 0){
+          pairIndex = EnergyTablePairIndex(pThis->energyType[i], pOther->energyType[j]);
+        }
+        EvoReal rmin = pairIndex >= 0 ? pTable->pairRmin[pairIndex] : RADIUS_SCALE_FOR_VDW * (pThis->radius[i] + pOther->radius[j]);
+        EvoReal ratio = distance/rmin;
+        EvoReal epsilon = pairIndex >= 0 ? pTable->pairEpsilon[pairIndex] : sqrt(pThis->epsilon[i]*pOther->epsilon[j]);
+        BOOL hasHydrogen = pThis->isHydrogen[i] || pOther->isHydrogen[j];
+
+        EvoReal vdwAtt = 0.0;
+        if(distance < VDW_DISTANCE_CUTOFF && !hasHydrogen && ratio >= 0.8909){
+          if(distance <= 5.0){
+            double B2 = 1.0/(ratio*ratio);
+            double B6 = B2*B2*B2;
+            vdwAtt = epsilon * (B6*B6 - 2.0 * B6);
+          }
+          else if(pairIndex >= 0){
+            double* coefficients = pTable->pairSwitch + 4*pairIndex;
+            vdwAtt = coefficients[0] * distance * distance * distance + coefficients[1] * distance * distance + coefficients[2] * distance + coefficients[3];
+          }
+          else{
+            double B2 = rmin*rmin/25.0;
+            double B6 = B2*B2*B2;
+            double A12 = B6 * B6;
+            double M = epsilon * ( A12 - 2.0 * B6);
+            double N = 2.4 * epsilon * (B6 - A12);
+            double a = 2 * M + N;
+            double b = -33 * M - 17 * N;
+            double c = 180 * M + 96 * N;
+            double d = -324 * M -180 * N;
+            vdwAtt = a * distance * distance * distance + b * distance * distance + c * distance + d;
+          }
+        }
+
+        EvoReal vdwRep = 0.0;
+        if(ratio <= 0.8909){
+          if(ratio >= RATIO_CUTOFF){
+            double B2 = 1.0/(ratio*ratio);
+            double B6 = B2*B2*B2;
+            vdwRep = epsilon * (B6*B6 - 2.0 * B6);
+          }
+          else{
+            double a = epsilon * (B6_0 * B6_0 - 2.0 * B6_0);
+            double b = epsilon * 12.0 * (B6_0 / RATIO_CUTOFF - B6_0 * B6_0 / RATIO_CUTOFF);
+            vdwRep = b * epsilon * (ratio - RATIO_CUTOFF) + a * epsilon;
+          }
+          if(vdwRep > 5.0*epsilon) vdwRep = 5.0*epsilon;
+        }
+
+        EvoReal ele = 0.0;
+        if(fabs(pThis->charge[i]) >= 1e-2 && fabs(pOther->charge[j]) >= 1e-2){
+          EvoReal distance12 = distance;
+          if(distance12 < 0.8*(pThis->radius[i] + pOther->radius[j])) distance12 = 0.8*(pThis->radius[i] + pOther->radius[j]);
+          ele = COULOMB_CONSTANT*pThis->charge[i]*pOther->charge[j]/distance12/distance12/40.0;
+        }
+
+        EvoReal desolvP = 0.0, desolvH = 0.0;
+        if(!hasHydrogen){
+          EvoReal r1 = pThis->radius[i]*RADIUS_SCALE_FOR_DESOLV;
+          EvoReal r2 = pOther->radius[j]*RADIUS_SCALE_FOR_DESOLV;
+          EvoReal r12 = r1+r2;
+          EvoReal dist = distance < r12 ? r12 : distance;
+          EvoReal desolv12, desolv21;
+          if(pairIndex >= 0){
+            desolv12 = pOther->volume[j] * EnergyTableDesolvationFactor(pThis->energyType[i], dist);
+            desolv21 = pThis->volume[i] * EnergyTableDesolvationFactor(pOther->energyType[j], dist);
+          }
+          else{
+            EvoReal lamda1 = pThis->lamda[i] * dist * dist;
+            EvoReal lamda2 = pOther->lamda[j] * dist * dist;
+            EvoReal x1 = (dist - r1)/pThis->lamda[i];
+            EvoReal x2 = (dist - r2)/pOther->lamda[j];
+            desolv12 = coefficient * pOther->volume[j] * pThis->freeDG[i] / lamda1;
+            desolv12 *= exp( -1.0 * x1 * x1 );
+            desolv21 = coefficient * pThis->volume[i] * pOther->freeDG[j] / lamda2;
+            desolv21 *= exp( -1.0 * x2 * x2 );
+          }
+          if(pThis->isPolar[i]) desolvP += desolv12;
+          else desolvH += desolv12;
+          if(pOther->isPolar[j]) desolvP += desolv21;
+          else desolvH += desolv21;
+        }
+
+        energyTerm[offset+1]+=vdwAtt;
+        energyTerm[offset+2]+=vdwRep;
+        energyTerm[offset+3]+=ele;
+        energyTerm[offset+4]+=desolvP;
+        energyTerm[offset+5]+=desolvH;
+
+        if(distance < HBOND_DISTANCE_CUTOFF_MAX){
+          Atom* pAtom1 = ResidueGetAtom(pThis->pResidue, i);
+          Atom* pAtom2 = ResidueGetAtom(pOther->pResidue, j);
+          double hb_tot=0,hb_dist=0,hb_theta=0,hb_phi=0;
+          if(pThis->isHBatomH[i] == TRUE && pOther->isHBatomA[j] == TRUE){
+            HBondEnergyAtomAndAtomNewFunction(pThis->pResidue, pOther->pResidue, pAtom1, pAtom2, &hb_tot,&hb_dist,&hb_theta,&hb_phi,distance,ratio12,15);
+          }
+          else if(pOther->isHBatomH[j] == TRUE && pThis->isHBatomA[i] == TRUE){
+            HBondEnergyAtomAndAtomNewFunction(pOther->pResidue, pThis->pResidue, pAtom2, pAtom1, &hb_tot,&hb_dist,&hb_theta,&hb_phi,distance,ratio12,15);
+          }
+          if(pThis->isBBAtom[i] == TRUE && pOther->isBBAtom[j] == TRUE){
+            energyTerm[offset+11]+=hb_dist;
+            energyTerm[offset+12]+=hb_theta;
+            energyTerm[offset+13]+=hb_phi;
+          }
+          else if(pThis->isBBAtom[i] == FALSE && pOther->isBBAtom[j] == FALSE){
+            energyTerm[offset+17]+=hb_dist;
+            energyTerm[offset+18]+=hb_theta;
+            energyTerm[offset+19]+=hb_phi;
+          }
+          else{
+            energyTerm[offset+14]+=hb_dist;
+            energyTerm[offset+15]+=hb_theta;
+            energyTerm[offset+16]+=hb_phi;
+          }
+        }
+      }
+    }
+  }
+  if(profilerEnabled) EnergyCountAtomPairs((long long)pThis->atomNum*pOther->atomNum, pairsInCutoff, TRUE);
   return Success;
 }
 
@@ -1005,11 +1201,11 @@ double FOLDEF_calculate_atom_occupancy_atom_and_atom(Residue *pResi1, Residue *p
 
 double FOLDEF_HBondEnergyAtomAndAtom(Residue *pDonor, Residue *pAcceptor,Atom *atomH, Atom *atomA, double distanceHA){
   if(distanceHA > 3.0 || distanceHA < 1.5) return 0.0;
-  Atom *atomD = ResidueGetAtomByName(pDonor, AtomGetHbDorB(atomH));
+  Atom *atomD = ResidueGetHbDorBAtom(pDonor, atomH);
   double distanceDA = XYZDistance(&atomD->xyz, &atomA->xyz);
   if(distanceDA > 4.0) return 0.0;
 
-  Atom *atomB = ResidueGetAtomByName(pAcceptor, AtomGetHbDorB(atomA));
+  Atom *atomB = ResidueGetHbDorBAtom(pAcceptor, atomA);
   XYZ xyzDH = XYZDifference(&atomD->xyz, &atomH->xyz);
   XYZ xyzHA = XYZDifference(&atomH->xyz, &atomA->xyz);
   XYZ xyzAAB = XYZDifference(&atomA->xyz, &atomB->xyz);
@@ -1168,6 +1364,7 @@ double CLASHCHECK_VdwRepEnergyAtomAndAtom(Atom *pThis, Atom *pOther, double dist
 
 
 int CLASHCHECK_EnergyResidueSelfEnergy(Residue* pThis, double ratio1, double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int context=BondSeparationFindContext(ResidueGetBonds(pThis));
   for(int i=0; i<ResidueGetAtomCount(pThis); ++i){
     Atom* pAtom1=ResidueGetAtom(pThis,i);
     for(int j=i+1; j<ResidueGetAtomCount(pThis);++j){
@@ -1181,14 +1378,14 @@ int CLASHCHECK_EnergyResidueSelfEnergy(Residue* pThis, double ratio1, double ene
         if(strcmp(ResidueGetName(pThis),"ILE")==0 || strcmp(ResidueGetName(pThis),"MET")==0 ||
           strcmp(ResidueGetName(pThis),"GLN")==0||strcmp(ResidueGetName(pThis),"GLU")==0||
           strcmp(ResidueGetName(pThis),"LYS")==0||strcmp(ResidueGetName(pThis),"ARG")==0){
-            int bondType=ResidueIntraBondConnectionCheck(AtomGetName(pAtom1),AtomGetName(pAtom2),ResidueGetBonds(pThis));
+            int bondType=BondSeparationIntraResidue(context,pAtom1,pAtom2,ResidueGetBonds(pThis));
             if(bondType==12||bondType==13) continue;
             energyTerm[2]+=CLASHCHECK_VdwRepEnergyAtomAndAtom(pAtom1,pAtom2,distance,bondType);
         }
       }
       else if((pAtom1->isBBAtom == TRUE && pAtom2->isBBAtom == FALSE) || (pAtom1->isBBAtom == FALSE && pAtom2->isBBAtom == TRUE)){ 
         if(strcmp(AtomGetName(pAtom1),"CB")==0 || strcmp(AtomGetName(pAtom2),"CB")==0) continue;
-        int bondType=ResidueIntraBondConnectionCheck(AtomGetName(pAtom1),AtomGetName(pAtom2),ResidueGetBonds(pThis));
+        int bondType=BondSeparationIntraResidue(context,pAtom1,pAtom2,ResidueGetBonds(pThis));
         if(bondType==12||bondType==13) continue;
         energyTerm[2]+=CLASHCHECK_VdwRepEnergyAtomAndAtom(pAtom1,pAtom2,distance,bondType);
         energyTerm[6]+=CLASHCHECK_ElecEnergyAtomAndAtom(pThis,pThis,pAtom1,pAtom2,distance,ratio1,bondType);
@@ -1217,7 +1414,7 @@ int CLASHCHECK_EnergyResidueAndNextResidue(Residue* pThis, Residue* pOther, doub
       }
       else if(pAtom1->isBBAtom == FALSE && pAtom2->isBBAtom == TRUE){
         if(strcmp(AtomGetName(pAtom1),"CB")==0) continue;
-        int bondType=ResidueAndNextResidueInterBondConnectionCheck_charmm19(AtomGetName(pAtom1),AtomGetName(pAtom2),pThis,pOther);
+        int bondType=BondSeparationNextResidue(pAtom1,pAtom2,pThis,pOther);
         energyTerm[2]+=CLASHCHECK_VdwRepEnergyAtomAndAtom(pAtom1,pAtom2,distance,bondType);
         energyTerm[6]+=CLASHCHECK_ElecEnergyAtomAndAtom(pThis,pOther,pAtom1,pAtom2,distance,ratio12,bondType);
       }
@@ -19,6 +19,7 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef ENERGY_FUNCTION_H
 #define ENERGY_FUNCTION_H
 #include "Residue.h"
+#include "ResiduePack.h"
 
 #define ENERGY_DEBUG_MODE_VDW_ATT           0
 #define ENERGY_DEBUG_MODE_VDW_REP           0
@@ -26,6 +27,9 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define ENERGY_DEBUG_MODE_ELEC              0
 #define ENERGY_DEBUG_MODE_DESOLV            0
 
+// use the packed residue kernel for the non-bonded residue pairs, 0 falls back to the per-atom functions
+#define ENERGY_USE_PACKED_KERNEL            1
+
 
 // a maximum of energy weights
 #define MAX_EVOEF_ENERGY_TERM_NUM          100
@@ -80,6 +84,7 @@ int EVOEF_EnergyResidueSelfEnergy(Residue* pThis, double ratio12,double energyTe
 int EVOEF_EnergyResidueAndNextResidue(Residue* pThis, Residue* pOther, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]);
 int EVOEF_EnergyResidueAndOtherResidueSameChain(Residue* pThis, Residue* pOther, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]);
 int EVOEF_EnergyResidueAndOtherResidueDifferentChain(Residue* pThis, Residue* pOther, double ratio12,double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]);
+int EVOEF_EnergyPackedResidueAndOtherResidue(ResiduePack* pThis, ResiduePack* pOther, double ratio12, BOOL sameChain, double energyTerm[MAX_EVOEF_ENERGY_TERM_NUM]);
 
 
 double FOLDEF_calculate_atom_occupancy_atom_and_atom(Residue *pResi1, Residue *pResi2, Atom *pAtom1, Atom *pAtom2, double distance);
@@ -0,0 +1,295 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "EnergyGraph.h"
+#include "Profiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+int EnergyGraphCreate(EnergyGraph* pThis){
+  pThis->chainIndexes = NULL;
+  pThis->resiIndexes = NULL;
+  pThis->resiNames = NULL;
+  pThis->atomOffsets = NULL;
+  pThis->atomXYZs = NULL;
+  pThis->ratiosComplex = NULL;
+  pThis->ratiosChain = NULL;
+  pThis->nodeTerms = NULL;
+  pThis->edgeResidues = NULL;
+  pThis->edgeTerms = NULL;
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) pThis->bindingTerms[i] = 0.0;
+  pThis->residueNum = 0;
+  pThis->edgeNum = 0;
+  pThis->edgeCapacity = 0;
+  return Success;
+}
+
+int EnergyGraphDestroy(EnergyGraph* pThis){
+  free(pThis->chainIndexes);
+  free(pThis->resiIndexes);
+  free(pThis->resiNames);
+  free(pThis->atomOffsets);
+  free(pThis->atomXYZs);
+  free(pThis->ratiosComplex);
+  free(pThis->ratiosChain);
+  free(pThis->nodeTerms);
+  free(pThis->edgeResidues);
+  free(pThis->edgeTerms);
+  EnergyGraphCreate(pThis);
+  return Success;
+}
+
+// self energy change of a residue whose burial ratio differs between the complex and the separated chain
+int EnergyGraphEvaluateNode(Residue* pResidue, double ratioComplex, double ratioChain, double *terms){
+  double termsChain[MAX_EVOEF_ENERGY_TERM_NUM];
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    terms[i] = 0.0;
+    termsChain[i] = 0.0;
+  }
+  EVOEF_EnergyResidueSelfEnergy(pResidue,ratioComplex,terms);
+  EVOEF_EnergyResidueSelfEnergy(pResidue,ratioChain,termsChain);
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) terms[i] -= termsChain[i];
+  return Success;
+}
+
+// binding contribution of the pair of nodes 'first' < 'second' of the cell list
+int EnergyGraphEvaluateEdge(CellList* pCellList, ResiduePack* packs, double* ratiosComplex, double* ratiosChain, int first, int second, double *terms){
+  double termsChain[MAX_EVOEF_ENERGY_TERM_NUM];
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    terms[i] = 0.0;
+    termsChain[i] = 0.0;
+  }
+  BOOL sameChain = CellListGetChainIndex(pCellList, first) == CellListGetChainIndex(pCellList, second);
+  BOOL nextResidue = sameChain && CellListGetResidueIndex(pCellList, second) == CellListGetResidueIndex(pCellList, first)+1;
+  double ratio12 = CalcAverageBuriedRatio(ratiosComplex[first], ratiosComplex[second]);
+  double ratio12Chain = CalcAverageBuriedRatio(ratiosChain[first], ratiosChain[second]);
+  EvoEF_ComputeResiduePairBinding(&packs[first],&packs[second],sameChain,nextResidue,ratio12,ratio12Chain,terms,termsChain);
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) terms[i] -= termsChain[i];
+  return Success;
+}
+
+// a same-chain pair contributes to the binding energy only if the burial of one of its residues changes on binding
+BOOL EnergyGraphPairContributes(CellList* pCellList, double* ratiosComplex, double* ratiosChain, int first, int second){
+  if(CellListGetChainIndex(pCellList, first) != CellListGetChainIndex(pCellList, second)) return TRUE;
+  return ratiosComplex[first] != ratiosChain[first] || ratiosComplex[second] != ratiosChain[second];
+}
+
+int EnergyGraphAddEdge(EnergyGraph* pThis, int first, int second, double *terms){
+  if(pThis->edgeNum == pThis->edgeCapacity){
+    pThis->edgeCapacity = pThis->edgeCapacity == 0 ? 1024 : pThis->edgeCapacity*2;
+    pThis->edgeResidues = (int*)realloc(pThis->edgeResidues, sizeof(int)*2*pThis->edgeCapacity);
+    pThis->edgeTerms = (double*)realloc(pThis->edgeTerms, sizeof(double)*MAX_EVOEF_ENERGY_TERM_NUM*pThis->edgeCapacity);
+  }
+  pThis->edgeResidues[2*pThis->edgeNum] = first;
+  pThis->edgeResidues[2*pThis->edgeNum+1] = second;
+  memcpy(pThis->edgeTerms+MAX_EVOEF_ENERGY_TERM_NUM*pThis->edgeNum, terms, sizeof(double)*MAX_EVOEF_ENERGY_TERM_NUM);
+  pThis->edgeNum++;
+  return Success;
+}
+
+int EnergyGraphBuild(EnergyGraph* pThis, Structure* pStructure){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_EnergyEvaluation);
+  EnergyGraphDestroy(pThis);
+  CellList cellList;
+  IntArray neighbors;
+  CellListCreate(&cellList);
+  IntArrayCreate(&neighbors, 0);
+  CellListBuild(&cellList, pStructure, -1, VDW_DISTANCE_CUTOFF);
+  int residueCount = CellListGetResidueCount(&cellList);
+  pThis->residueNum = residueCount;
+  pThis->chainIndexes = (int*)malloc(sizeof(int)*(residueCount+1));
+  pThis->resiIndexes = (int*)malloc(sizeof(int)*(residueCount+1));
+  pThis->resiNames = (char*)malloc(sizeof(char)*(MAX_LENGTH_RESIDUE_NAME+1)*(residueCount+1));
+  pThis->atomOffsets = (int*)malloc(sizeof(int)*(residueCount+1));
+  pThis->ratiosComplex = (double*)malloc(sizeof(double)*(residueCount+1));
+  pThis->ratiosChain = (double*)malloc(sizeof(double)*(residueCount+1));
+  pThis->nodeTerms = (double*)calloc(MAX_EVOEF_ENERGY_TERM_NUM*(residueCount+1), sizeof(double));
+
+  // remember the identity and coordinates of every residue, a model is compared against them
+  pThis->atomOffsets[0] = 0;
+  for(int index = 0; index < residueCount; index++){
+    Residue* pResidue = CellListGetResidue(&cellList, index);
+    pThis->chainIndexes[index] = CellListGetChainIndex(&cellList, index);
+    pThis->resiIndexes[index] = CellListGetResidueIndex(&cellList, index);
+    strcpy(pThis->resiNames+(MAX_LENGTH_RESIDUE_NAME+1)*index, ResidueGetName(pResidue));
+    pThis->atomOffsets[index+1] = pThis->atomOffsets[index]+ResidueGetAtomCount(pResidue);
+  }
+  pThis->atomXYZs = (XYZ*)malloc(sizeof(XYZ)*(pThis->atomOffsets[residueCount]+1));
+  for(int index = 0; index < residueCount; index++){
+    Residue* pResidue = CellListGetResidue(&cellList, index);
+    for(int k = 0; k < ResidueGetAtomCount(pResidue); k++){
+      pThis->atomXYZs[pThis->atomOffsets[index]+k] = ResidueGetAtom(pResidue, k)->xyz;
+    }
+  }
+  EvoEF_ComputeBurialRatios(pStructure, &cellList, pThis->ratiosComplex, pThis->ratiosChain);
+
+  ResiduePack* packs = (ResiduePack*)malloc(sizeof(ResiduePack)*(residueCount+1));
+  for(int index = 0; index < residueCount; index++){
+    ResiduePackCreate(&packs[index]);
+    ResiduePackBuild(&packs[index], CellListGetResidue(&cellList, index));
+  }
+  double terms[MAX_EVOEF_ENERGY_TERM_NUM];
+  for(int index = 0; index < residueCount; index++){
+    if(pThis->ratiosComplex[index] != pThis->ratiosChain[index]){
+      double* nodeTerms = pThis->nodeTerms+MAX_EVOEF_ENERGY_TERM_NUM*index;
+      EnergyGraphEvaluateNode(CellListGetResidue(&cellList, index), pThis->ratiosComplex[index], pThis->ratiosChain[index], nodeTerms);
+      for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) pThis->bindingTerms[i] += nodeTerms[i];
+    }
+    CellListGetNeighbors(&cellList, index, &neighbors);
+    for(int n = 0; n < IntArrayGetLength(&neighbors); n++){
+      int neighbor = IntArrayGet(&neighbors, n);
+      if(!EnergyGraphPairContributes(&cellList, pThis->ratiosComplex, pThis->ratiosChain, index, neighbor)) continue;
+      EnergyGraphEvaluateEdge(&cellList, packs, pThis->ratiosComplex, pThis->ratiosChain, index, neighbor, terms);
+      EnergyGraphAddEdge(pThis, index, neighbor, terms);
+      for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) pThis->bindingTerms[i] += terms[i];
+    }
+  }
+  for(int index = 0; index < residueCount; index++){
+    ResiduePackDestroy(&packs[index]);
+  }
+  free(packs);
+  IntArrayDestroy(&neighbors);
+  CellListDestroy(&cellList);
+  ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
+  return Success;
+}
+
+int EnergyGraphGetResidueCount(EnergyGraph* pThis){
+  return pThis->residueNum;
+}
+
+int EnergyGraphGetEdgeCount(EnergyGraph* pThis){
+  return pThis->edgeNum;
+}
+
+// weighted binding energy of the reference complex, term [0] is the total
+int EnergyGraphGetBindingEnergy(EnergyGraph* pThis, double *energyTerms){
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = pThis->bindingTerms[i];
+  energyTerms[0] = 0.0;
+  EnergyTermWeighting(energyTerms);
+  for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    energyTerms[0] += energyTerms[i];
+  }
+  return Success;
+}
+
+// a residue is changed if its identity, its atoms or its burial ratios differ from the reference
+BOOL EnergyGraphResidueChanged(EnergyGraph* pThis, int index, Residue* pResidue, double ratioComplex, double ratioChain){
+  if(strcmp(pThis->resiNames+(MAX_LENGTH_RESIDUE_NAME+1)*index, ResidueGetName(pResidue)) != 0) return TRUE;
+  if(pThis->atomOffsets[index+1]-pThis->atomOffsets[index] != ResidueGetAtomCount(pResidue)) return TRUE;
+  if(pThis->ratiosComplex[index] != ratioComplex || pThis->ratiosChain[index] != ratioChain) return TRUE;
+  for(int k = 0; k < ResidueGetAtomCount(pResidue); k++){
+    XYZ* pRefXYZ = &pThis->atomXYZs[pThis->atomOffsets[index]+k];
+    XYZ* pXYZ = &ResidueGetAtom(pResidue, k)->xyz;
+    if(pRefXYZ->X != pXYZ->X || pRefXYZ->Y != pXYZ->Y || pRefXYZ->Z != pXYZ->Z) return TRUE;
+  }
+  return FALSE;
+}
+
+// weighted binding energy of a model built from the reference complex, e.g. a mutant written by BuildMutant,
+// only the nodes and edges of the changed residues are re-evaluated. the model must have the same chains and residue counts
+int EnergyGraphComputeModelBinding(EnergyGraph* pThis, Structure* pModel, double *energyTerms, int* pChangedCount){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_EnergyEvaluation);
+  CellList cellList;
+  CellListCreate(&cellList);
+  CellListBuild(&cellList, pModel, -1, VDW_DISTANCE_CUTOFF);
+  int residueCount = CellListGetResidueCount(&cellList);
+  BOOL sameTopology = residueCount == pThis->residueNum;
+  for(int index = 0; sameTopology && index < residueCount; index++){
+    sameTopology = CellListGetChainIndex(&cellList, index) == pThis->chainIndexes[index] &&
+      CellListGetResidueIndex(&cellList, index) == pThis->resiIndexes[index];
+  }
+  if(!sameTopology){
+    CellListDestroy(&cellList);
+    char usrMsg[MAX_LENGTH_ERR_MSG+1];
+    sprintf(usrMsg, "in file %s function %s() line %d, the model does not have the chains and residues of the reference complex", __FILE__, __FUNCTION__, __LINE__);
+    TraceError(usrMsg, ValueError);
+    ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
+    return ValueError;
+  }
+
+  double* ratiosComplex = (double*)malloc(sizeof(double)*(residueCount+1));
+  double* ratiosChain = (double*)malloc(sizeof(double)*(residueCount+1));
+  BOOL* changed = (BOOL*)malloc(sizeof(BOOL)*(residueCount+1));
+  EvoEF_ComputeBurialRatios(pModel, &cellList, ratiosComplex, ratiosChain);
+  int changedCount = 0;
+  for(int index = 0; index < residueCount; index++){
+    changed[index] = EnergyGraphResidueChanged(pThis, index, CellListGetResidue(&cellList, index), ratiosComplex[index], ratiosChain[index]);
+    if(changed[index]) changedCount++;
+  }
+  if(pChangedCount != NULL) *pChangedCount = changedCount;
+
+  // drop the reference contributions of the changed residues
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = pThis->bindingTerms[i];
+  for(int index = 0; index < residueCount; index++){
+    if(!changed[index]) continue;
+    double* nodeTerms = pThis->nodeTerms+MAX_EVOEF_ENERGY_TERM_NUM*index;
+    for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] -= nodeTerms[i];
+  }
+  for(int e = 0; e < pThis->edgeNum; e++){
+    if(!changed[pThis->edgeResidues[2*e]] && !changed[pThis->edgeResidues[2*e+1]]) continue;
+    double* edgeTerms = pThis->edgeTerms+MAX_EVOEF_ENERGY_TERM_NUM*e;
+    for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] -= edgeTerms[i];
+  }
+
+  // add the contributions of the changed residues in the model, residues are packed on first use
+  IntArray neighbors;
+  IntArrayCreate(&neighbors, 0);
+  ResiduePack* packs = (ResiduePack*)malloc(sizeof(ResiduePack)*(residueCount+1));
+  for(int index = 0; index < residueCount; index++){
+    ResiduePackCreate(&packs[index]);
+  }
+  double terms[MAX_EVOEF_ENERGY_TERM_NUM];
+  for(int index = 0; index < residueCount; index++){
+    if(!changed[index]) continue;
+    if(ratiosComplex[index] != ratiosChain[index]){
+      EnergyGraphEvaluateNode(CellListGetResidue(&cellList, index), ratiosComplex[index], ratiosChain[index], terms);
+      for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] += terms[i];
+    }
+    CellListGetAllNeighbors(&cellList, index, &neighbors);
+    for(int n = 0; n < IntArrayGetLength(&neighbors); n++){
+      int neighbor = IntArrayGet(&neighbors, n);
+      // a pair of two changed residues is visited from its first residue only
+      if(changed[neighbor] && neighbor < index) continue;
+      int first = index < neighbor ? index : neighbor;
+      int second = index < neighbor ? neighbor : index;
+      if(!EnergyGraphPairContributes(&cellList, ratiosComplex, ratiosChain, first, second)) continue;
+      if(ResiduePackGetResidue(&packs[first]) == NULL) ResiduePackBuild(&packs[first], CellListGetResidue(&cellList, first));
+      if(ResiduePackGetResidue(&packs[second]) == NULL) ResiduePackBuild(&packs[second], CellListGetResidue(&cellList, second));
+      EnergyGraphEvaluateEdge(&cellList, packs, ratiosComplex, ratiosChain, first, second, terms);
+      for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] += terms[i];
+    }
+  }
+  for(int index = 0; index < residueCount; index++){
+    ResiduePackDestroy(&packs[index]);
+  }
+  free(packs);
+  IntArrayDestroy(&neighbors);
+  free(changed);
+  free(ratiosChain);
+  free(ratiosComplex);
+  CellListDestroy(&cellList);
+
+  energyTerms[0] = 0.0;
+  EnergyTermWeighting(energyTerms);
+  for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
+    energyTerms[0] += energyTerms[i];
+  }
+  ProfilerEnd(Type_ProfilePhase_EnergyEvaluation, profileStart);
+  return Success;
+}
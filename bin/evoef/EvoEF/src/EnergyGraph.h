@@ -0,0 +1,52 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef ENERGY_GRAPH_H
+#define ENERGY_GRAPH_H
+
+#include "EnergyComputation.h"
+
+// residue-pair interaction graph of the binding energy of a reference complex, usually the repaired wild type.
+// every node and edge keeps its unweighted binding terms, so the binding energy of a model built from the same
+// complex is updated by re-evaluating only the nodes and edges of residues that differ from the reference
+typedef struct _EnergyGraph{
+  int* chainIndexes;      // 4/8 bytes, chain index of every node
+  int* resiIndexes;       // 4/8 bytes, residue index in the chain of every node
+  char* resiNames;        // 4/8 bytes, (MAX_LENGTH_RESIDUE_NAME+1) chars per node
+  int* atomOffsets;       // 4/8 bytes, first atom of every node in atomXYZs, residueNum+1 entries
+  XYZ* atomXYZs;          // 4/8 bytes, atom coordinates of the reference
+  double* ratiosComplex;  // 4/8 bytes, burial ratio in the complex
+  double* ratiosChain;    // 4/8 bytes, burial ratio in the separated chain
+  double* nodeTerms;      // 4/8 bytes, MAX_EVOEF_ENERGY_TERM_NUM per node, self energy change on binding
+  int* edgeResidues;      // 4/8 bytes, two node indexes per edge
+  double* edgeTerms;      // 4/8 bytes, MAX_EVOEF_ENERGY_TERM_NUM per edge
+  double bindingTerms[MAX_EVOEF_ENERGY_TERM_NUM]; // sum over all nodes and edges, not weighted
+  int residueNum;         // 4 bytes
+  int edgeNum;            // 4 bytes
+  int edgeCapacity;       // 4 bytes
+} EnergyGraph;
+
+int EnergyGraphCreate(EnergyGraph* pThis);
+int EnergyGraphDestroy(EnergyGraph* pThis);
+int EnergyGraphBuild(EnergyGraph* pThis, Structure* pStructure);
+int EnergyGraphGetResidueCount(EnergyGraph* pThis);
+int EnergyGraphGetEdgeCount(EnergyGraph* pThis);
+int EnergyGraphGetBindingEnergy(EnergyGraph* pThis, double *energyTerms);
+int EnergyGraphComputeModelBinding(EnergyGraph* pThis, Structure* pModel, double *energyTerms, int* pChangedCount);
+
+#endif // ENERGY_GRAPH_H
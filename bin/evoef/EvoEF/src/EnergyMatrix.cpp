@@ -0,0 +1,935 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "EnergyMatrix.h"
+#include "Profiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+Type_RotamerPacker rotamerPacker = Type_RotamerPacker_Local;
+BOOL deadEndEliminationEnabled = FALSE;
+int annealStepNum = ENERGY_MATRIX_ANNEAL_DEFAULT_STEP_NUM;
+unsigned long long annealSeed = ENERGY_MATRIX_ANNEAL_DEFAULT_SEED;
+
+int EnergyMatrixSetPacker(char* packerName){
+  if(!strcmp(packerName, "local")) rotamerPacker = Type_RotamerPacker_Local;
+  else if(!strcmp(packerName, "matrix")) rotamerPacker = Type_RotamerPacker_Matrix;
+  else if(!strcmp(packerName, "anneal")) rotamerPacker = Type_RotamerPacker_Anneal;
+  else return ValueError;
+  return Success;
+}
+
+Type_RotamerPacker EnergyMatrixGetPacker(){
+  return rotamerPacker;
+}
+
+int EnergyMatrixSetDeadEndElimination(BOOL enabled){
+  deadEndEliminationEnabled = enabled;
+  return Success;
+}
+
+BOOL EnergyMatrixIsDeadEndEliminationEnabled(){
+  return deadEndEliminationEnabled;
+}
+
+int EnergyMatrixSetAnnealStepCount(int stepNum){
+  annealStepNum = stepNum;
+  return Success;
+}
+
+int EnergyMatrixGetAnnealStepCount(){
+  return annealStepNum;
+}
+
+int EnergyMatrixSetAnnealSeed(unsigned long long seed){
+  annealSeed = seed;
+  return Success;
+}
+
+unsigned long long EnergyMatrixGetAnnealSeed(){
+  return annealSeed;
+}
+
+int EnergyMatrixCreate(EnergyMatrix* pThis){
+  pThis->siteChains = NULL;
+  pThis->siteResidues = NULL;
+  pThis->rotamerOffsets = NULL;
+  pThis->allowed = NULL;
+  pThis->blockIndexes = NULL;
+  pThis->blockCounts = NULL;
+  pThis->oneBody = NULL;
+  pThis->edgeSites = NULL;
+  pThis->edgeOffsets = NULL;
+  pThis->pairEnergies = NULL;
+  pThis->siteEdgeOffsets = NULL;
+  pThis->siteEdges = NULL;
+  pThis->assignment = NULL;
+  pThis->siteNum = 0;
+  pThis->rotamerNum = 0;
+  pThis->edgeNum = 0;
+  return Success;
+}
+
+int EnergyMatrixDestroy(EnergyMatrix* pThis){
+  free(pThis->siteChains);
+  free(pThis->siteResidues);
+  free(pThis->rotamerOffsets);
+  free(pThis->allowed);
+  free(pThis->blockIndexes);
+  free(pThis->blockCounts);
+  free(pThis->oneBody);
+  free(pThis->edgeSites);
+  free(pThis->edgeOffsets);
+  free(pThis->pairEnergies);
+  free(pThis->siteEdgeOffsets);
+  free(pThis->siteEdges);
+  free(pThis->assignment);
+  EnergyMatrixCreate(pThis);
+  return Success;
+}
+
+// bounding sphere of the atoms of a residue, two residues whose spheres are farther apart than the cutoff of the
+// energy terms do not interact
+int EnergyMatrixResidueSphere(Residue* pResidue, XYZ* pCenter, double* pRadius){
+  pCenter->X = 0.0; pCenter->Y = 0.0; pCenter->Z = 0.0;
+  *pRadius = 0.0;
+  int atomCount = ResidueGetAtomCount(pResidue);
+  if(atomCount == 0) return Success;
+  for(int i = 0; i < atomCount; i++) XYZAdd(pCenter, &ResidueGetAtom(pResidue, i)->xyz);
+  XYZScale(pCenter, 1.0/atomCount);
+  for(int i = 0; i < atomCount; i++){
+    double distance = XYZDistance(pCenter, &ResidueGetAtom(pResidue, i)->xyz);
+    if(distance > *pRadius) *pRadius = distance;
+  }
+  return Success;
+}
+
+BOOL EnergyMatrixSpheresInContact(XYZ* pCenter1, double radius1, XYZ* pCenter2, double radius2){
+  return XYZDistance(pCenter1, pCenter2) <= radius1 + radius2 + VDW_DISTANCE_CUTOFF;
+}
+
+// weighted interaction of two packed residues, evaluated as ProteinSiteOptimizeRotamerLocally() evaluates it
+double EnergyMatrixResiduePairEnergy(ResiduePack* pPack1, ResiduePack* pPack2){
+  Residue* pResi1 = ResiduePackGetResidue(pPack1);
+  Residue* pResi2 = ResiduePackGetResidue(pPack2);
+  double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM];
+  for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = 0.0;
+  double ratio12 = CalcAverageBuriedRatio(CalcResidueBuriedRatio(pResi1), CalcResidueBuriedRatio(pResi2));
+  BOOL sameChain = strcmp(pResi1->chainName, pResi2->chainName) == 0;
+  if(sameChain && pResi1->posInChain == pResi2->posInChain-1){
+    EVOEF_EnergyResidueAndNextResidue(pResi1, pResi2, ratio12, energyTerms);
+  }
+  else if(sameChain && pResi1->posInChain == pResi2->posInChain+1){
+    EVOEF_EnergyResidueAndNextResidue(pResi2, pResi1, ratio12, energyTerms);
+  }
+#if ENERGY_USE_PACKED_KERNEL
+  else{
+    EVOEF_EnergyPackedResidueAndOtherResidue(pPack1, pPack2, ratio12, sameChain, energyTerms);
+  }
+#else
+  else if(sameChain){
+    EVOEF_EnergyResidueAndOtherResidueSameChain(pResi1, pResi2, ratio12, energyTerms);
+  }
+  else{
+    EVOEF_EnergyResidueAndOtherResidueDifferentChain(pResi1, pResi2, ratio12, energyTerms);
+  }
+#endif
+  EnergyTermWeighting(energyTerms);
+  double energy = 0.0;
+  for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energy += energyTerms[i];
+  return energy;
+}
+
+// places rotamer ir of a rotamer set in pScratch, a copy of the site residue pDesign with the atoms of the rotamer.
+// the residue, atoms and bonds are copied only when the atom layout differs from the last call on pScratch (*ppLayout,
+// NULL at first), otherwise only the coordinates are set. the set is only read, so that the tasks of several threads
+// can place the rotamers of one site at a time
+int EnergyMatrixPlaceRotamer(RotamerSet* pRotSet, int ir, Residue* pDesign, Residue* pScratch, Rotamer** ppLayout){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  Rotamer* pRotamer = RotamerSetGet(pRotSet, ir);
+  // a rotamer that was never extracted keeps its own atoms
+  Rotamer* pLayout = AtomArrayGetCount(&pRotamer->atoms) > 0 ? pRotamer : RotamerSetGetRepresentative(pRotSet, RotamerGetType(pRotamer));
+  if(pLayout == NULL){
+    sprintf(usrMsg, "in file %s function %s() line %d, cannot find the representative rotamer for type %s", __FILE__, __FUNCTION__, __LINE__, RotamerGetType(pRotamer));
+    TraceError(usrMsg, DataNotExistError);
+    return DataNotExistError;
+  }
+  if(pLayout != *ppLayout){
+    ResidueCopy(pScratch, pDesign);
+    ResidueSetName(pScratch, RotamerGetType(pRotamer));
+    AtomArrayCopy(&pScratch->atoms, &pLayout->atoms);
+    BondSetCopy(&pScratch->bonds, &pLayout->bonds);
+    *ppLayout = pLayout;
+  }
+  if(pLayout == pRotamer) return Success;
+  return RotamerPlaceAtoms(pRotamer, pLayout, &pScratch->atoms);
+}
+
+// the matrix is filled by one task per site and then one task per edge
+typedef struct _EnergyMatrixTask{
+  EnergyMatrix* pMatrix;      // 4/8 bytes
+  Structure* pStructure;      // 4/8 bytes
+  Residue** ppResidues;       // 4/8 bytes, all residues of the structure in chain order
+  ResiduePack* residuePacks;  // 4/8 bytes, packs of the residues that are not design sites
+  int* residueSites;          // 4/8 bytes, site index of every residue, -1 for the fixed residues
+  XYZ* residueCenters;        // 4/8 bytes, bounding sphere of every residue
+  double* residueRadii;       // 4/8 bytes
+  XYZ* rotamerCenters;        // 4/8 bytes, bounding sphere of every rotamer
+  double* rotamerRadii;       // 4/8 bytes
+  double rmsdcutoff;          // 8 bytes
+  int residueNum;             // 4 bytes
+} EnergyMatrixTask;
+
+// place the rotamers of a site in a scratch residue one at a time and compute their one-body energies. the rotamers of
+// a residue type that was in the structure are allowed only within rmsdcutoff of its side chain, like in the local
+// optimization
+int EnergyMatrixSiteTaskRun(void* pArgs, int site, int /*threadIndex*/){
+  EnergyMatrixTask* pTask = (EnergyMatrixTask*)pArgs;
+  EnergyMatrix* pMatrix = pTask->pMatrix;
+  DesignSite* pDesignSite = StructureGetDesignSite(pTask->pStructure, pMatrix->siteChains[site], pMatrix->siteResidues[site]);
+  RotamerSet* pRotSet = DesignSiteGetRotamers(pDesignSite);
+  Residue* pDesign = pDesignSite->pResidue;
+  Residue scratch;
+  ResidueCreate(&scratch);
+  Residue* pResidue = &scratch;
+  Rotamer* pLayout = NULL;
+  ResiduePack rotamerPack;
+  ResiduePackCreate(&rotamerPack);
+  for(int ir = 0; ir < RotamerSetGetCount(pRotSet); ir++){
+    int rotamer = pMatrix->rotamerOffsets[site]+ir;
+    pMatrix->allowed[rotamer] = FALSE;
+    pMatrix->oneBody[rotamer] = 0.0;
+    if(FAILED(EnergyMatrixPlaceRotamer(pRotSet, ir, pDesign, pResidue, &pLayout))){
+      EnergyMatrixResidueSphere(pDesign, &pTask->rotamerCenters[rotamer], &pTask->rotamerRadii[rotamer]);
+      continue;
+    }
+    EnergyMatrixResidueSphere(pResidue, &pTask->rotamerCenters[rotamer], &pTask->rotamerRadii[rotamer]);
+    // not '<=', the rmsd of a side chain without heavy atoms beyond CB is not a number and never exceeds the cutoff
+    pMatrix->allowed[rotamer] = !(ResidueAndResidueSidechainRMSD(pResidue, pDesign) > pTask->rmsdcutoff);
+    if(!pMatrix->allowed[rotamer]) continue;
+
+    ResiduePackBuild(&rotamerPack, pResidue);
+    double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM];
+    for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = 0.0;
+    ResidueReferenceEnergy(pResidue, energyTerms);
+    EVOEF_EnergyResidueSelfEnergy(pResidue, CalcResidueBuriedRatio(pResidue), energyTerms);
+    EnergyTermWeighting(energyTerms);
+    for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) pMatrix->oneBody[rotamer] += energyTerms[i];
+    for(int k = 0; k < pTask->residueNum; k++){
+      if(pTask->residueSites[k] != -1) continue;
+      if(!EnergyMatrixSpheresInContact(&pTask->rotamerCenters[rotamer], pTask->rotamerRadii[rotamer], &pTask->residueCenters[k], pTask->residueRadii[k])) continue;
+      pMatrix->oneBody[rotamer] += EnergyMatrixResiduePairEnergy(&rotamerPack, &pTask->residuePacks[k]);
+    }
+  }
+  ResiduePackDestroy(&rotamerPack);
+  ResidueDestroy(&scratch);
+  return Success;
+}
+
+// the rotamers of the two sites are placed again in one scratch residue per site, only the rotamer pairs in contact
+int EnergyMatrixEdgeTaskRun(void* pArgs, int edge, int /*threadIndex*/){
+  EnergyMatrixTask* pTask = (EnergyMatrixTask*)pArgs;
+  EnergyMatrix* pMatrix = pTask->pMatrix;
+  int first = pMatrix->edgeSites[2*edge];
+  int second = pMatrix->edgeSites[2*edge+1];
+  DesignSite* pFirstSite = StructureGetDesignSite(pTask->pStructure, pMatrix->siteChains[first], pMatrix->siteResidues[first]);
+  DesignSite* pSecondSite = StructureGetDesignSite(pTask->pStructure, pMatrix->siteChains[second], pMatrix->siteResidues[second]);
+  double* pairEnergies = pMatrix->pairEnergies+pMatrix->edgeOffsets[edge];
+  int secondCount = pMatrix->blockCounts[second];
+  Residue firstResidue, secondResidue;
+  ResidueCreate(&firstResidue);
+  ResidueCreate(&secondResidue);
+  Rotamer* pFirstLayout = NULL;
+  Rotamer* pSecondLayout = NULL;
+  ResiduePack firstPack, secondPack;
+  ResiduePackCreate(&firstPack);
+  ResiduePackCreate(&secondPack);
+  for(int r = pMatrix->rotamerOffsets[first]; r < pMatrix->rotamerOffsets[first+1]; r++){
+    if(!pMatrix->allowed[r]) continue;
+    EnergyMatrixPlaceRotamer(DesignSiteGetRotamers(pFirstSite), r-pMatrix->rotamerOffsets[first], pFirstSite->pResidue, &firstResidue, &pFirstLayout);
+    ResiduePackBuild(&firstPack, &firstResidue);
+    for(int s = pMatrix->rotamerOffsets[second]; s < pMatrix->rotamerOffsets[second+1]; s++){
+      if(!pMatrix->allowed[s]) continue;
+      double* pEnergy = pairEnergies+pMatrix->blockIndexes[r]*secondCount+pMatrix->blockIndexes[s];
+      *pEnergy = 0.0;
+      if(!EnergyMatrixSpheresInContact(&pTask->rotamerCenters[r], pTask->rotamerRadii[r], &pTask->rotamerCenters[s], pTask->rotamerRadii[s])) continue;
+      EnergyMatrixPlaceRotamer(DesignSiteGetRotamers(pSecondSite), s-pMatrix->rotamerOffsets[second], pSecondSite->pResidue, &secondResidue, &pSecondLayout);
+      ResiduePackBuild(&secondPack, &secondResidue);
+      *pEnergy = EnergyMatrixResiduePairEnergy(&firstPack, &secondPack);
+    }
+  }
+  ResiduePackDestroy(&firstPack);
+  ResiduePackDestroy(&secondPack);
+  ResidueDestroy(&firstResidue);
+  ResidueDestroy(&secondResidue);
+  return Success;
+}
+
+// the sites are given as chain and residue index pairs. a residue listed twice is one site, and the residues without
+// rotamers stay fixed. every site starts from the rotamer closest to its side chain in the structure, or from no
+// rotamer if none has its residue type
+int EnergyMatrixBuild(EnergyMatrix* pThis, Structure* pStructure, IntArray* pSites, double rmsdcutoff){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
+  EnergyMatrixDestroy(pThis);
+  EnergyMatrixTask task;
+  task.pMatrix = pThis;
+  task.pStructure = pStructure;
+  task.rmsdcutoff = rmsdcutoff;
+  task.residueNum = 0;
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++) task.residueNum += ChainGetResidueCount(StructureGetChain(pStructure, i));
+  task.ppResidues = (Residue**)malloc(sizeof(Residue*)*(task.residueNum+1));
+  task.residueSites = (int*)malloc(sizeof(int)*(task.residueNum+1));
+  task.residueCenters = (XYZ*)malloc(sizeof(XYZ)*(task.residueNum+1));
+  task.residueRadii = (double*)malloc(sizeof(double)*(task.residueNum+1));
+  task.residuePacks = (ResiduePack*)malloc(sizeof(ResiduePack)*(task.residueNum+1));
+  int* chainOffsets = (int*)malloc(sizeof(int)*(StructureGetChainCount(pStructure)+1));
+  int residue = 0;
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    chainOffsets[i] = residue;
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      task.ppResidues[residue] = ChainGetResidue(pChain, j);
+      task.residueSites[residue] = -1;
+      EnergyMatrixResidueSphere(task.ppResidues[residue], &task.residueCenters[residue], &task.residueRadii[residue]);
+      residue++;
+    }
+  }
+
+  int capacity = IntArrayGetLength(pSites)/2+1;
+  pThis->siteChains = (int*)malloc(sizeof(int)*capacity);
+  pThis->siteResidues = (int*)malloc(sizeof(int)*capacity);
+  pThis->rotamerOffsets = (int*)malloc(sizeof(int)*(capacity+1));
+  pThis->rotamerOffsets[0] = 0;
+  for(int ii = 0; ii < IntArrayGetLength(pSites); ii += 2){
+    int chainIndex = IntArrayGet(pSites, ii);
+    int resiIndex = IntArrayGet(pSites, ii+1);
+    DesignSite* pDesignSite = StructureGetDesignSite(pStructure, chainIndex, resiIndex);
+    if(pDesignSite == NULL || RotamerSetGetCount(DesignSiteGetRotamers(pDesignSite)) == 0) continue;
+    if(task.residueSites[chainOffsets[chainIndex]+resiIndex] != -1) continue;
+    task.residueSites[chainOffsets[chainIndex]+resiIndex] = pThis->siteNum;
+    pThis->siteChains[pThis->siteNum] = chainIndex;
+    pThis->siteResidues[pThis->siteNum] = resiIndex;
+    pThis->rotamerOffsets[pThis->siteNum+1] = pThis->rotamerOffsets[pThis->siteNum]+RotamerSetGetCount(DesignSiteGetRotamers(pDesignSite));
+    pThis->siteNum++;
+  }
+  pThis->rotamerNum = pThis->rotamerOffsets[pThis->siteNum];
+  for(int k = 0; k < task.residueNum; k++){
+    ResiduePackCreate(&task.residuePacks[k]);
+    if(task.residueSites[k] == -1) ResiduePackBuild(&task.residuePacks[k], task.ppResidues[k]);
+  }
+  pThis->allowed = (BOOL*)malloc(sizeof(BOOL)*(pThis->rotamerNum+1));
+  pThis->oneBody = (double*)malloc(sizeof(double)*(pThis->rotamerNum+1));
+  pThis->assignment = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  task.rotamerCenters = (XYZ*)malloc(sizeof(XYZ)*(pThis->rotamerNum+1));
+  task.rotamerRadii = (double*)malloc(sizeof(double)*(pThis->rotamerNum+1));
+  ThreadPoolRun(pThis->siteNum, EnergyMatrixSiteTaskRun, &task);
+  // the pair blocks hold only the rotamers allowed now, the others never enter a packing
+  pThis->blockIndexes = (int*)malloc(sizeof(int)*(pThis->rotamerNum+1));
+  pThis->blockCounts = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  for(int site = 0; site < pThis->siteNum; site++){
+    pThis->blockCounts[site] = 0;
+    for(int r = pThis->rotamerOffsets[site]; r < pThis->rotamerOffsets[site+1]; r++){
+      pThis->blockIndexes[r] = pThis->allowed[r] ? pThis->blockCounts[site]++ : -1;
+    }
+  }
+
+  // an edge for every site pair with a rotamer pair in contact
+  int edgeCapacity = 0;
+  pThis->edgeOffsets = (int*)malloc(sizeof(int));
+  pThis->edgeOffsets[0] = 0;
+  for(int first = 0; first < pThis->siteNum; first++){
+    for(int second = first+1; second < pThis->siteNum; second++){
+      BOOL inContact = FALSE;
+      for(int r = pThis->rotamerOffsets[first]; r < pThis->rotamerOffsets[first+1] && !inContact; r++){
+        if(!pThis->allowed[r]) continue;
+        for(int s = pThis->rotamerOffsets[second]; s < pThis->rotamerOffsets[second+1]; s++){
+          if(pThis->allowed[s] && EnergyMatrixSpheresInContact(&task.rotamerCenters[r], task.rotamerRadii[r], &task.rotamerCenters[s], task.rotamerRadii[s])){
+            inContact = TRUE;
+            break;
+          }
+        }
+      }
+      if(!inContact) continue;
+      if(pThis->edgeNum == edgeCapacity){
+        edgeCapacity = edgeCapacity == 0 ? 64 : edgeCapacity*2;
+        pThis->edgeSites = (int*)realloc(pThis->edgeSites, sizeof(int)*2*edgeCapacity);
+        pThis->edgeOffsets = (int*)realloc(pThis->edgeOffsets, sizeof(int)*(edgeCapacity+1));
+      }
+      pThis->edgeSites[2*pThis->edgeNum] = first;
+      pThis->edgeSites[2*pThis->edgeNum+1] = second;
+      pThis->edgeOffsets[pThis->edgeNum+1] = pThis->edgeOffsets[pThis->edgeNum]+pThis->blockCounts[first]*pThis->blockCounts[second];
+      pThis->edgeNum++;
+    }
+  }
+  pThis->pairEnergies = (double*)malloc(sizeof(double)*(pThis->edgeOffsets[pThis->edgeNum]+1));
+  ThreadPoolRun(pThis->edgeNum, EnergyMatrixEdgeTaskRun, &task);
+
+  // the edges of every site, in the order of the other site
+  pThis->siteEdgeOffsets = (int*)calloc(pThis->siteNum+1, sizeof(int));
+  pThis->siteEdges = (int*)malloc(sizeof(int)*(2*pThis->edgeNum+1));
+  for(int edge = 0; edge < pThis->edgeNum; edge++){
+    pThis->siteEdgeOffsets[pThis->edgeSites[2*edge]+1]++;
+    pThis->siteEdgeOffsets[pThis->edgeSites[2*edge+1]+1]++;
+  }
+  for(int site = 0; site < pThis->siteNum; site++) pThis->siteEdgeOffsets[site+1] += pThis->siteEdgeOffsets[site];
+  int* siteEdgeCounts = (int*)calloc(pThis->siteNum+1, sizeof(int));
+  for(int edge = 0; edge < pThis->edgeNum; edge++){
+    for(int k = 0; k < 2; k++){
+      int site = pThis->edgeSites[2*edge+k];
+      pThis->siteEdges[pThis->siteEdgeOffsets[site]+siteEdgeCounts[site]] = edge;
+      siteEdgeCounts[site]++;
+    }
+  }
+  free(siteEdgeCounts);
+
+  Residue scratch;
+  ResidueCreate(&scratch);
+  Rotamer* pLayout = NULL;
+  for(int site = 0; site < pThis->siteNum; site++){
+    Residue* pResidue = ChainGetResidue(StructureGetChain(pStructure, pThis->siteChains[site]), pThis->siteResidues[site]);
+    DesignSite* pDesignSite = StructureGetDesignSite(pStructure, pThis->siteChains[site], pThis->siteResidues[site]);
+    RotamerSet* pRotSet = DesignSiteGetRotamers(pDesignSite);
+    pThis->assignment[site] = -1;
+    double minRMSD = 0.0;
+    for(int r = pThis->rotamerOffsets[site]; r < pThis->rotamerOffsets[site+1]; r++){
+      int ir = r-pThis->rotamerOffsets[site];
+      if(!pThis->allowed[r] || strcmp(RotamerGetType(RotamerSetGet(pRotSet, ir)), ResidueGetName(pResidue)) != 0) continue;
+      EnergyMatrixPlaceRotamer(pRotSet, ir, pDesignSite->pResidue, &scratch, &pLayout);
+      double rmsd = ResidueAndResidueSidechainRMSD(&scratch, pResidue);
+      if(pThis->assignment[site] == -1 || rmsd < minRMSD){
+        pThis->assignment[site] = ir;
+        minRMSD = rmsd;
+      }
+    }
+  }
+  ResidueDestroy(&scratch);
+
+  for(int k = 0; k < task.residueNum; k++) ResiduePackDestroy(&task.residuePacks[k]);
+  free(task.residuePacks);
+  free(task.ppResidues);
+  free(task.residueSites);
+  free(task.residueCenters);
+  free(task.residueRadii);
+  free(task.rotamerCenters);
+  free(task.rotamerRadii);
+  free(chainOffsets);
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
+  return Success;
+}
+
+int EnergyMatrixGetSiteCount(EnergyMatrix* pThis){
+  return pThis->siteNum;
+}
+
+int EnergyMatrixGetRotamerCount(EnergyMatrix* pThis, int site){
+  return pThis->rotamerOffsets[site+1]-pThis->rotamerOffsets[site];
+}
+
+int EnergyMatrixGetEdgeCount(EnergyMatrix* pThis){
+  return pThis->edgeNum;
+}
+
+double EnergyMatrixGetOneBody(EnergyMatrix* pThis, int site, int rotamer){
+  return pThis->oneBody[pThis->rotamerOffsets[site]+rotamer];
+}
+
+// pair energy of the rotamer of 'site' and the rotamer of the other site of the edge, both must have been allowed
+// when the matrix was built
+double EnergyMatrixGetPair(EnergyMatrix* pThis, int edge, int site, int rotamer, int otherRotamer){
+  double* pairEnergies = pThis->pairEnergies+pThis->edgeOffsets[edge];
+  int first = pThis->edgeSites[2*edge];
+  int second = pThis->edgeSites[2*edge+1];
+  int secondCount = pThis->blockCounts[second];
+  if(first == site) return pairEnergies[pThis->blockIndexes[pThis->rotamerOffsets[first]+rotamer]*secondCount+pThis->blockIndexes[pThis->rotamerOffsets[second]+otherRotamer]];
+  return pairEnergies[pThis->blockIndexes[pThis->rotamerOffsets[first]+otherRotamer]*secondCount+pThis->blockIndexes[pThis->rotamerOffsets[second]+rotamer]];
+}
+
+int EnergyMatrixGetOtherSite(EnergyMatrix* pThis, int edge, int site){
+  return pThis->edgeSites[2*edge] == site ? pThis->edgeSites[2*edge+1] : pThis->edgeSites[2*edge];
+}
+
+// energy of a rotamer of a site against the current rotamers of the other sites
+double EnergyMatrixGetRotamerEnergy(EnergyMatrix* pThis, int site, int rotamer){
+  double energy = EnergyMatrixGetOneBody(pThis, site, rotamer);
+  for(int e = pThis->siteEdgeOffsets[site]; e < pThis->siteEdgeOffsets[site+1]; e++){
+    int edge = pThis->siteEdges[e];
+    int other = EnergyMatrixGetOtherSite(pThis, edge, site);
+    if(pThis->assignment[other] == -1) continue;
+    energy += EnergyMatrixGetPair(pThis, edge, site, rotamer, pThis->assignment[other]);
+  }
+  return energy;
+}
+
+// energy of the current rotamers of all sites, the sites without a rotamer are left out
+double EnergyMatrixGetTotalEnergy(EnergyMatrix* pThis){
+  double energy = 0.0;
+  for(int site = 0; site < pThis->siteNum; site++){
+    if(pThis->assignment[site] != -1) energy += EnergyMatrixGetOneBody(pThis, site, pThis->assignment[site]);
+  }
+  for(int edge = 0; edge < pThis->edgeNum; edge++){
+    int first = pThis->edgeSites[2*edge];
+    int second = pThis->edgeSites[2*edge+1];
+    if(pThis->assignment[first] == -1 || pThis->assignment[second] == -1) continue;
+    energy += EnergyMatrixGetPair(pThis, edge, first, pThis->assignment[first], pThis->assignment[second]);
+  }
+  return energy;
+}
+
+// the smallest energy difference between rotamer r and rotamer t of a site against the allowed rotamers of the other
+// site of every edge of the site, one minimum per edge
+int EnergyMatrixMinPairDifferences(EnergyMatrix* pThis, int site, int r, int t, double* minDifferences){
+  for(int e = pThis->siteEdgeOffsets[site]; e < pThis->siteEdgeOffsets[site+1]; e++){
+    int edge = pThis->siteEdges[e];
+    int other = EnergyMatrixGetOtherSite(pThis, edge, site);
+    double minDifference = 0.0;
+    BOOL found = FALSE;
+    for(int s = 0; s < EnergyMatrixGetRotamerCount(pThis, other); s++){
+      if(!pThis->allowed[pThis->rotamerOffsets[other]+s]) continue;
+      double difference = EnergyMatrixGetPair(pThis, edge, site, r, s)-EnergyMatrixGetPair(pThis, edge, site, t, s);
+      if(!found || difference < minDifference){
+        minDifference = difference;
+        found = TRUE;
+      }
+    }
+    minDifferences[e-pThis->siteEdgeOffsets[site]] = minDifference;
+  }
+  return Success;
+}
+
+// the lowest and the highest energy that a rotamer can have against the allowed rotamers of the neighbor sites
+int EnergyMatrixRotamerBounds(EnergyMatrix* pThis, int site, int rotamer, double* pLower, double* pUpper){
+  *pLower = EnergyMatrixGetOneBody(pThis, site, rotamer);
+  *pUpper = *pLower;
+  for(int e = pThis->siteEdgeOffsets[site]; e < pThis->siteEdgeOffsets[site+1]; e++){
+    int edge = pThis->siteEdges[e];
+    int other = EnergyMatrixGetOtherSite(pThis, edge, site);
+    double minPair = 0.0, maxPair = 0.0;
+    BOOL found = FALSE;
+    for(int s = 0; s < EnergyMatrixGetRotamerCount(pThis, other); s++){
+      if(!pThis->allowed[pThis->rotamerOffsets[other]+s]) continue;
+      double pair = EnergyMatrixGetPair(pThis, edge, site, rotamer, s);
+      if(!found || pair < minPair) minPair = pair;
+      if(!found || pair > maxPair) maxPair = pair;
+      found = TRUE;
+    }
+    *pLower += minPair;
+    *pUpper += maxPair;
+  }
+  return Success;
+}
+
+// Goldstein and split dead-end elimination over the allowed rotamers. rotamer r of site i is removed if a rotamer t
+// of the site gives E(r)-E(t)+sum_j min_s[E(r,s)-E(t,s)] > 0. otherwise it is removed if for some neighbor site k
+// every rotamer v of k has a rotamer t with E(r)-E(t)+sum_{j!=k} min_s[E(r,s)-E(t,s)]+E(r,v)-E(t,v) > 0. neither
+// removes a rotamer of the lowest-energy assignment of the matrix. a rotamer whose lowest energy is above the highest
+// energy of another one is removed at once, the others are tested against the ENERGY_MATRIX_DEE_WITNESS_NUM rotamers
+// of the site with the lowest bounds. the last allowed rotamer of a site is always kept. a site whose current rotamer
+// was removed then takes the allowed rotamer with the lowest lower bound, so that the search does not start it from
+// whatever its neighbors happen to hold when it is visited
+int EnergyMatrixEliminateDeadEnds(EnergyMatrix* pThis, DeadEndStats* pStats){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
+  pStats->rotamerNum = 0;
+  pStats->singleEliminated = 0;
+  pStats->splitEliminated = 0;
+  pStats->passNum = 0;
+  int maxRotamerCount = 0, maxEdgeCount = 0;
+  for(int site = 0; site < pThis->siteNum; site++){
+    if(EnergyMatrixGetRotamerCount(pThis, site) > maxRotamerCount) maxRotamerCount = EnergyMatrixGetRotamerCount(pThis, site);
+    if(pThis->siteEdgeOffsets[site+1]-pThis->siteEdgeOffsets[site] > maxEdgeCount) maxEdgeCount = pThis->siteEdgeOffsets[site+1]-pThis->siteEdgeOffsets[site];
+  }
+  for(int r = 0; r < pThis->rotamerNum; r++){
+    if(pThis->allowed[r]) pStats->rotamerNum++;
+  }
+  double* lowers = (double*)malloc(sizeof(double)*(maxRotamerCount+1));
+  double* uppers = (double*)malloc(sizeof(double)*(maxRotamerCount+1));
+  int witnesses[ENERGY_MATRIX_DEE_WITNESS_NUM];
+  // per witness: its one-body difference to the tested rotamer plus all edge minima, and the minimum of every edge
+  double totals[ENERGY_MATRIX_DEE_WITNESS_NUM];
+  double* minDifferences = (double*)malloc(sizeof(double)*(ENERGY_MATRIX_DEE_WITNESS_NUM*maxEdgeCount+1));
+
+  // a site is tested again only if a rotamer of a neighbor site was removed since its last test
+  BOOL* changed = (BOOL*)malloc(sizeof(BOOL)*(pThis->siteNum+1));
+  for(int site = 0; site < pThis->siteNum; site++) changed[site] = TRUE;
+  // the sites whose current rotamer was removed
+  BOOL* removed = (BOOL*)malloc(sizeof(BOOL)*(pThis->siteNum+1));
+  for(int site = 0; site < pThis->siteNum; site++) removed[site] = FALSE;
+  BOOL eliminated = TRUE;
+  while(eliminated && pStats->passNum < ENERGY_MATRIX_MAX_DEE_PASS_NUM){
+    eliminated = FALSE;
+    for(int site = 0; site < pThis->siteNum; site++){
+      if(!changed[site]) continue;
+      changed[site] = FALSE;
+      int offset = pThis->rotamerOffsets[site];
+      int rotamerCount = EnergyMatrixGetRotamerCount(pThis, site);
+      int edgeCount = pThis->siteEdgeOffsets[site+1]-pThis->siteEdgeOffsets[site];
+      int allowedCount = 0;
+      // the two lowest upper bounds, so that every rotamer is compared with the best other one
+      int bestUpper = -1, secondUpper = -1;
+      int witnessNum = 0;
+      for(int r = 0; r < rotamerCount; r++){
+        if(!pThis->allowed[offset+r]) continue;
+        allowedCount++;
+        EnergyMatrixRotamerBounds(pThis, site, r, &lowers[r], &uppers[r]);
+        if(bestUpper == -1 || uppers[r] < uppers[bestUpper]){
+          secondUpper = bestUpper;
+          bestUpper = r;
+        }
+        else if(secondUpper == -1 || uppers[r] < uppers[secondUpper]){
+          secondUpper = r;
+        }
+        // keep the witnesses sorted by their lower bound
+        int k = witnessNum < ENERGY_MATRIX_DEE_WITNESS_NUM ? witnessNum++ : ENERGY_MATRIX_DEE_WITNESS_NUM;
+        while(k > 0 && lowers[witnesses[k-1]] > lowers[r]){
+          if(k < ENERGY_MATRIX_DEE_WITNESS_NUM) witnesses[k] = witnesses[k-1];
+          k--;
+        }
+        if(k < ENERGY_MATRIX_DEE_WITNESS_NUM) witnesses[k] = r;
+      }
+
+      for(int r = 0; r < rotamerCount && allowedCount > 1; r++){
+        if(!pThis->allowed[offset+r]) continue;
+        int other = r == bestUpper ? secondUpper : bestUpper;
+        BOOL single = other != -1 && pThis->allowed[offset+other] && lowers[r] > uppers[other];
+        for(int w = 0; w < witnessNum && !single; w++){
+          int t = witnesses[w];
+          totals[w] = 0.0;
+          if(t == r || !pThis->allowed[offset+t]) continue;
+          EnergyMatrixMinPairDifferences(pThis, site, r, t, minDifferences+w*edgeCount);
+          totals[w] = pThis->oneBody[offset+r]-pThis->oneBody[offset+t];
+          for(int e = 0; e < edgeCount; e++) totals[w] += minDifferences[w*edgeCount+e];
+          if(totals[w] > 0.0) single = TRUE;
+        }
+        BOOL split = FALSE;
+        for(int e = 0; e < edgeCount && !single && !split; e++){
+          int edge = pThis->siteEdges[pThis->siteEdgeOffsets[site]+e];
+          int neighbor = EnergyMatrixGetOtherSite(pThis, edge, site);
+          int coveredCount = 0;
+          split = TRUE;
+          for(int v = 0; v < EnergyMatrixGetRotamerCount(pThis, neighbor) && split; v++){
+            if(!pThis->allowed[pThis->rotamerOffsets[neighbor]+v]) continue;
+            BOOL covered = FALSE;
+            for(int w = 0; w < witnessNum && !covered; w++){
+              int t = witnesses[w];
+              if(t == r || !pThis->allowed[offset+t]) continue;
+              double bound = totals[w]-minDifferences[w*edgeCount+e]+EnergyMatrixGetPair(pThis, edge, site, r, v)-EnergyMatrixGetPair(pThis, edge, site, t, v);
+              if(bound > 0.0) covered = TRUE;
+            }
+            if(!covered) split = FALSE;
+            else coveredCount++;
+          }
+          if(coveredCount == 0) split = FALSE;
+        }
+        if(!single && !split) continue;
+        pThis->allowed[offset+r] = FALSE;
+        if(pThis->assignment[site] == r){
+          pThis->assignment[site] = -1;
+          removed[site] = TRUE;
+        }
+        if(single) pStats->singleEliminated++;
+        else pStats->splitEliminated++;
+        allowedCount--;
+        eliminated = TRUE;
+        for(int e = pThis->siteEdgeOffsets[site]; e < pThis->siteEdgeOffsets[site+1]; e++){
+          changed[EnergyMatrixGetOtherSite(pThis, pThis->siteEdges[e], site)] = TRUE;
+        }
+      }
+    }
+    pStats->passNum++;
+  }
+  for(int site = 0; site < pThis->siteNum; site++){
+    if(!removed[site]) continue;
+    double minLower = 0.0, upper = 0.0;
+    for(int r = 0; r < EnergyMatrixGetRotamerCount(pThis, site); r++){
+      if(!pThis->allowed[pThis->rotamerOffsets[site]+r]) continue;
+      EnergyMatrixRotamerBounds(pThis, site, r, &lowers[r], &upper);
+      if(pThis->assignment[site] == -1 || lowers[r] < minLower){
+        pThis->assignment[site] = r;
+        minLower = lowers[r];
+      }
+    }
+  }
+  free(changed);
+  free(removed);
+  free(lowers);
+  free(uppers);
+  free(minDifferences);
+  if(profilerEnabled){
+    ProfilerCount(Type_ProfileCounter_DeeRotamers, pStats->rotamerNum);
+    ProfilerCount(Type_ProfileCounter_DeeSingleEliminated, pStats->singleEliminated);
+    ProfilerCount(Type_ProfileCounter_DeeSplitEliminated, pStats->splitEliminated);
+  }
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
+  return Success;
+}
+
+// every site in turn takes its best rotamer against the current rotamers of the others, as the cycles of the local
+// optimization do, until a cycle changes no site. a site changes only to a strictly lower energy, so the total
+// energy decreases with every change
+int EnergyMatrixOptimizeGreedy(EnergyMatrix* pThis, int* pCycleNum){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
+  int cycle = 0;
+  BOOL changed = TRUE;
+  while(changed && cycle < ENERGY_MATRIX_MAX_CYCLE_NUM){
+    changed = FALSE;
+    for(int site = 0; site < pThis->siteNum; site++){
+      int minRotamer = pThis->assignment[site];
+      double minEnergy = minRotamer == -1 ? 0.0 : EnergyMatrixGetRotamerEnergy(pThis, site, minRotamer);
+      for(int r = 0; r < EnergyMatrixGetRotamerCount(pThis, site); r++){
+        if(!pThis->allowed[pThis->rotamerOffsets[site]+r] || r == pThis->assignment[site]) continue;
+        double energy = EnergyMatrixGetRotamerEnergy(pThis, site, r);
+        if(minRotamer == -1 || energy < minEnergy){
+          minRotamer = r;
+          minEnergy = energy;
+        }
+      }
+      if(minRotamer != pThis->assignment[site]){
+        pThis->assignment[site] = minRotamer;
+        changed = TRUE;
+      }
+    }
+    cycle++;
+  }
+  if(pCycleNum != NULL) *pCycleNum = cycle;
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
+  return Success;
+}
+
+// splitmix64, every annealing has its own generator state, so the result depends only on the seed and not on the
+// platform or on the other threads
+unsigned long long EnergyMatrixRandom(unsigned long long* pState){
+  unsigned long long z = (*pState += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// uniform in [0, 1)
+double EnergyMatrixRandomUniform(unsigned long long* pState){
+  return (EnergyMatrixRandom(pState) >> 11) * (1.0/9007199254740992.0);
+}
+
+// simulated annealing of all sites. the search starts from the result of EnergyMatrixOptimizeGreedy(), so it never
+// ends above it. a move gives a random site a random other allowed rotamer and is accepted by the Metropolis
+// criterion, its energy change is looked up from the one-body energies and the pair energies with the current
+// rotamers of the neighbor sites only. the temperature falls geometrically over the moves. the lowest-energy
+// assignment met is kept and relaxed with EnergyMatrixOptimizeGreedy() again
+int EnergyMatrixAnneal(EnergyMatrix* pThis, int stepNum, unsigned long long seed, AnnealStats* pStats){
+  EnergyMatrixOptimizeGreedy(pThis, NULL);
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
+  pStats->stepNum = 0;
+  pStats->acceptedNum = 0;
+  // the allowed rotamers of every site, only the sites with a choice are moved
+  int* allowedOffsets = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  int* allowedRotamers = (int*)malloc(sizeof(int)*(pThis->rotamerNum+1));
+  int* movableSites = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  int* bestAssignment = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  int movableNum = 0;
+  allowedOffsets[0] = 0;
+  for(int site = 0; site < pThis->siteNum; site++){
+    allowedOffsets[site+1] = allowedOffsets[site];
+    for(int r = 0; r < EnergyMatrixGetRotamerCount(pThis, site); r++){
+      if(!pThis->allowed[pThis->rotamerOffsets[site]+r]) continue;
+      allowedRotamers[allowedOffsets[site+1]++] = r;
+    }
+    if(allowedOffsets[site+1]-allowedOffsets[site] > 1) movableSites[movableNum++] = site;
+  }
+  double energy = EnergyMatrixGetTotalEnergy(pThis);
+  pStats->bestEnergy = energy;
+  memcpy(bestAssignment, pThis->assignment, sizeof(int)*pThis->siteNum);
+
+  unsigned long long state = seed;
+  double cooling = stepNum > 1 ? pow(ENERGY_MATRIX_ANNEAL_TEMPERATURE_LOW/ENERGY_MATRIX_ANNEAL_TEMPERATURE_HIGH, 1.0/(stepNum-1)) : 1.0;
+  double temperature = ENERGY_MATRIX_ANNEAL_TEMPERATURE_HIGH;
+  for(int step = 0; step < stepNum && movableNum > 0; step++){
+    int site = movableSites[EnergyMatrixRandom(&state) % movableNum];
+    int allowedCount = allowedOffsets[site+1]-allowedOffsets[site];
+    // any allowed rotamer but the current one
+    int current = pThis->assignment[site];
+    int candidate = allowedRotamers[allowedOffsets[site]+EnergyMatrixRandom(&state) % (allowedCount-1)];
+    if(candidate == current) candidate = allowedRotamers[allowedOffsets[site+1]-1];
+    double delta = EnergyMatrixGetRotamerEnergy(pThis, site, candidate)-EnergyMatrixGetRotamerEnergy(pThis, site, current);
+    pStats->stepNum++;
+    if(delta <= 0.0 || EnergyMatrixRandomUniform(&state) < exp(-delta/temperature)){
+      pThis->assignment[site] = candidate;
+      energy += delta;
+      pStats->acceptedNum++;
+      if(energy < pStats->bestEnergy){
+        pStats->bestEnergy = energy;
+        memcpy(bestAssignment, pThis->assignment, sizeof(int)*pThis->siteNum);
+      }
+    }
+    temperature *= cooling;
+  }
+  memcpy(pThis->assignment, bestAssignment, sizeof(int)*pThis->siteNum);
+  free(allowedOffsets);
+  free(allowedRotamers);
+  free(movableSites);
+  free(bestAssignment);
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
+  EnergyMatrixOptimizeGreedy(pThis, NULL);
+  pStats->bestEnergy = EnergyMatrixGetTotalEnergy(pThis);
+  return Success;
+}
+
+// copy the current rotamer of every site into the structure, the residues of the sites must be detached
+int EnergyMatrixApply(EnergyMatrix* pThis, Structure* pStructure){
+  Residue scratch;
+  ResidueCreate(&scratch);
+  for(int site = 0; site < pThis->siteNum; site++){
+    if(pThis->assignment[site] == -1) continue;
+    Residue* pResidue = ChainGetResidue(StructureGetChain(pStructure, pThis->siteChains[site]), pThis->siteResidues[site]);
+    DesignSite* pDesignSite = StructureGetDesignSite(pStructure, pThis->siteChains[site], pThis->siteResidues[site]);
+    Rotamer* pLayout = NULL;
+    EnergyMatrixPlaceRotamer(DesignSiteGetRotamers(pDesignSite), pThis->assignment[site], pDesignSite->pResidue, &scratch, &pLayout);
+    ResidueCopy(pResidue, &scratch);
+  }
+  ResidueDestroy(&scratch);
+  return Success;
+}
+
+// a random matrix of 2 to ENERGY_MATRIX_CHECK_DEE_SITE_NUM sites of 1 to ENERGY_MATRIX_CHECK_DEE_ROTAMER_NUM
+// rotamers, about one in eight of them not allowed. about three in four site pairs are edges. the one-body energies
+// are uniform in [-3, 3) and the pair energies in [-1, 1), every site starts from a random allowed rotamer
+int EnergyMatrixCreateRandom(EnergyMatrix* pThis, unsigned long long* pState){
+  EnergyMatrixCreate(pThis);
+  pThis->siteNum = 2+(int)(EnergyMatrixRandom(pState) % (ENERGY_MATRIX_CHECK_DEE_SITE_NUM-1));
+  pThis->rotamerOffsets = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  pThis->blockCounts = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  pThis->assignment = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  pThis->rotamerOffsets[0] = 0;
+  for(int site = 0; site < pThis->siteNum; site++){
+    pThis->rotamerOffsets[site+1] = pThis->rotamerOffsets[site]+1+(int)(EnergyMatrixRandom(pState) % ENERGY_MATRIX_CHECK_DEE_ROTAMER_NUM);
+  }
+  pThis->rotamerNum = pThis->rotamerOffsets[pThis->siteNum];
+  pThis->allowed = (BOOL*)malloc(sizeof(BOOL)*(pThis->rotamerNum+1));
+  pThis->blockIndexes = (int*)malloc(sizeof(int)*(pThis->rotamerNum+1));
+  pThis->oneBody = (double*)malloc(sizeof(double)*(pThis->rotamerNum+1));
+  for(int site = 0; site < pThis->siteNum; site++){
+    int offset = pThis->rotamerOffsets[site];
+    pThis->assignment[site] = (int)(EnergyMatrixRandom(pState) % EnergyMatrixGetRotamerCount(pThis, site));
+    pThis->blockCounts[site] = 0;
+    for(int r = 0; r < EnergyMatrixGetRotamerCount(pThis, site); r++){
+      pThis->allowed[offset+r] = r == pThis->assignment[site] || EnergyMatrixRandom(pState) % 8 != 0;
+      pThis->blockIndexes[offset+r] = pThis->allowed[offset+r] ? pThis->blockCounts[site]++ : -1;
+      pThis->oneBody[offset+r] = 6.0*EnergyMatrixRandomUniform(pState)-3.0;
+    }
+  }
+  pThis->edgeSites = (int*)malloc(sizeof(int)*(pThis->siteNum*pThis->siteNum+1));
+  pThis->edgeOffsets = (int*)malloc(sizeof(int)*(pThis->siteNum*pThis->siteNum/2+1));
+  pThis->edgeOffsets[0] = 0;
+  for(int first = 0; first < pThis->siteNum; first++){
+    for(int second = first+1; second < pThis->siteNum; second++){
+      if(EnergyMatrixRandom(pState) % 4 == 0) continue;
+      pThis->edgeSites[2*pThis->edgeNum] = first;
+      pThis->edgeSites[2*pThis->edgeNum+1] = second;
+      pThis->edgeOffsets[pThis->edgeNum+1] = pThis->edgeOffsets[pThis->edgeNum]+pThis->blockCounts[first]*pThis->blockCounts[second];
+      pThis->edgeNum++;
+    }
+  }
+  pThis->pairEnergies = (double*)malloc(sizeof(double)*(pThis->edgeOffsets[pThis->edgeNum]+1));
+  for(int k = 0; k < pThis->edgeOffsets[pThis->edgeNum]; k++) pThis->pairEnergies[k] = 2.0*EnergyMatrixRandomUniform(pState)-1.0;
+  pThis->siteEdgeOffsets = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  pThis->siteEdges = (int*)malloc(sizeof(int)*(2*pThis->edgeNum+1));
+  for(int site = 0; site <= pThis->siteNum; site++) pThis->siteEdgeOffsets[site] = 0;
+  for(int edge = 0; edge < pThis->edgeNum; edge++){
+    pThis->siteEdgeOffsets[pThis->edgeSites[2*edge]+1]++;
+    pThis->siteEdgeOffsets[pThis->edgeSites[2*edge+1]+1]++;
+  }
+  for(int site = 0; site < pThis->siteNum; site++) pThis->siteEdgeOffsets[site+1] += pThis->siteEdgeOffsets[site];
+  int siteEdgeCounts[ENERGY_MATRIX_CHECK_DEE_SITE_NUM];
+  for(int site = 0; site < pThis->siteNum; site++) siteEdgeCounts[site] = 0;
+  for(int edge = 0; edge < pThis->edgeNum; edge++){
+    for(int k = 0; k < 2; k++){
+      int site = pThis->edgeSites[2*edge+k];
+      pThis->siteEdges[pThis->siteEdgeOffsets[site]+siteEdgeCounts[site]++] = edge;
+    }
+  }
+  return Success;
+}
+
+// the lowest total energy over all assignments of allowed rotamers, by enumeration. the assignment is kept
+double EnergyMatrixExhaustiveMinimum(EnergyMatrix* pThis){
+  int* saved = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  int* firstAllowed = (int*)malloc(sizeof(int)*(pThis->siteNum+1));
+  memcpy(saved, pThis->assignment, sizeof(int)*pThis->siteNum);
+  for(int site = 0; site < pThis->siteNum; site++){
+    firstAllowed[site] = -1;
+    for(int r = 0; r < EnergyMatrixGetRotamerCount(pThis, site) && firstAllowed[site] == -1; r++){
+      if(pThis->allowed[pThis->rotamerOffsets[site]+r]) firstAllowed[site] = r;
+    }
+    pThis->assignment[site] = firstAllowed[site];
+  }
+  double minEnergy = EnergyMatrixGetTotalEnergy(pThis);
+  while(TRUE){
+    // the next assignment, counting through the allowed rotamers with the first site changing fastest
+    int site = 0;
+    for(; site < pThis->siteNum; site++){
+      if(pThis->assignment[site] == -1) continue;
+      int r = pThis->assignment[site]+1;
+      while(r < EnergyMatrixGetRotamerCount(pThis, site) && !pThis->allowed[pThis->rotamerOffsets[site]+r]) r++;
+      if(r < EnergyMatrixGetRotamerCount(pThis, site)){
+        pThis->assignment[site] = r;
+        break;
+      }
+      pThis->assignment[site] = firstAllowed[site];
+    }
+    if(site == pThis->siteNum) break;
+    double energy = EnergyMatrixGetTotalEnergy(pThis);
+    if(energy < minEnergy) minEnergy = energy;
+  }
+  memcpy(pThis->assignment, saved, sizeof(int)*pThis->siteNum);
+  free(saved);
+  free(firstAllowed);
+  return minEnergy;
+}
+
+// checks EnergyMatrixEliminateDeadEnds() on random matrices against exhaustive search: the lowest total energy of
+// the rotamers left must equal that of all allowed rotamers, and every site must hold an allowed rotamer afterwards
+int EnergyMatrixCheckDeadEndElimination(int matrixNum){
+  unsigned long long state = ENERGY_MATRIX_ANNEAL_DEFAULT_SEED;
+  int failedNum = 0, rotamerNum = 0, singleEliminated = 0, splitEliminated = 0;
+  double maxDeviation = 0.0;
+  for(int m = 0; m < matrixNum; m++){
+    EnergyMatrix matrix;
+    EnergyMatrixCreateRandom(&matrix, &state);
+    double minEnergy = EnergyMatrixExhaustiveMinimum(&matrix);
+    DeadEndStats stats;
+    EnergyMatrixEliminateDeadEnds(&matrix, &stats);
+    rotamerNum += stats.rotamerNum;
+    singleEliminated += stats.singleEliminated;
+    splitEliminated += stats.splitEliminated;
+    double deviation = fabs(EnergyMatrixExhaustiveMinimum(&matrix)-minEnergy);
+    if(deviation > maxDeviation) maxDeviation = deviation;
+    BOOL assigned = TRUE;
+    for(int site = 0; site < matrix.siteNum; site++){
+      if(matrix.assignment[site] == -1 || !matrix.allowed[matrix.rotamerOffsets[site]+matrix.assignment[site]]) assigned = FALSE;
+    }
+    if(deviation > ENERGY_MATRIX_CHECK_DEE_TOLERANCE || !assigned){
+      printf("matrix %d of %d sites and %d rotamers: lowest energy %.6f before and %.6f after dead-end elimination%s\n",
+        m, matrix.siteNum, matrix.rotamerNum, minEnergy, EnergyMatrixExhaustiveMinimum(&matrix), assigned ? "" : ", a site has no allowed rotamer");
+      failedNum++;
+    }
+    EnergyMatrixDestroy(&matrix);
+  }
+  printf("dead-end elimination on %d random matrices removed %d of %d rotamers (Goldstein %d, split %d)\n",
+    matrixNum, singleEliminated+splitEliminated, rotamerNum, singleEliminated, splitEliminated);
+  printf("lowest energy vs exhaustive search: max deviation %.3e, %d matrices failed, %s\n",
+    maxDeviation, failedNum, failedNum > 0 ? "failed" : "passed");
+  return failedNum > 0 ? ValueError : Success;
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef ENERGY_MATRIX_H
+#define ENERGY_MATRIX_H
+
+#include "EnergyComputation.h"
+
+// a packing cycle of the matrix packer stops when no site changes its rotamer, or after this many cycles
+#define ENERGY_MATRIX_MAX_CYCLE_NUM  100
+// dead-end elimination stops when a pass over all sites removes no rotamer, or after this many passes
+#define ENERGY_MATRIX_MAX_DEE_PASS_NUM  20
+// the rotamers of a site with the lowest energy bounds that every other rotamer of the site is tested against
+#define ENERGY_MATRIX_DEE_WITNESS_NUM   16
+// simulated annealing: default number of moves and seed, and the temperatures of the first and the last move
+#define ENERGY_MATRIX_ANNEAL_DEFAULT_STEP_NUM  100000
+#define ENERGY_MATRIX_ANNEAL_DEFAULT_SEED      1
+#define ENERGY_MATRIX_ANNEAL_TEMPERATURE_HIGH  5.0
+#define ENERGY_MATRIX_ANNEAL_TEMPERATURE_LOW   0.05
+// CheckDeadEndElimination: the number of random matrices, their largest size, and the largest deviation of the
+// lowest energy from exhaustive search
+#define ENERGY_MATRIX_CHECK_DEE_MATRIX_NUM    3400
+#define ENERGY_MATRIX_CHECK_DEE_SITE_NUM      6
+#define ENERGY_MATRIX_CHECK_DEE_ROTAMER_NUM   5
+#define ENERGY_MATRIX_CHECK_DEE_TOLERANCE     1e-9
+
+// the side-chain packer of the mutant models: the rotamers of the design sites are optimized one site at a time
+// against the current structure (local, the default), or searched in the precomputed energy matrix one site at a
+// time (matrix) or by simulated annealing of all sites (anneal)
+typedef enum _Type_RotamerPacker{
+  Type_RotamerPacker_Local,
+  Type_RotamerPacker_Matrix,
+  Type_RotamerPacker_Anneal
+} Type_RotamerPacker;
+
+// rotamers removed by dead-end elimination. a rotamer is removed by the Goldstein criterion if another rotamer of
+// its site is better in every environment, and by the split criterion if the environments can be split by the
+// rotamer of one neighbor site so that in each part another rotamer is better
+typedef struct _DeadEndStats{
+  int rotamerNum;         // 4 bytes, allowed rotamers before the elimination
+  int singleEliminated;   // 4 bytes, removed by the Goldstein criterion
+  int splitEliminated;    // 4 bytes, removed by the split criterion
+  int passNum;            // 4 bytes, passes over all sites until no rotamer was removed
+} DeadEndStats;
+
+typedef struct _AnnealStats{
+  int stepNum;            // 4 bytes, moves tried
+  int acceptedNum;        // 4 bytes, moves accepted
+  double bestEnergy;      // 8 bytes, lowest total energy met, the final assignment
+} AnnealStats;
+
+// weighted rotamer energies of a set of design sites. the one-body energy of a rotamer is its reference and self
+// energy plus its interaction with all residues that are not design sites, the pair energy of two rotamers is their
+// interaction. a block of pair energies is kept only for the site pairs that have a rotamer pair in contact, so the
+// energy of any assignment of rotamers to the sites is a sum of table entries.
+// the blocks cover only the rotamers allowed when the matrix is built
+typedef struct _EnergyMatrix{
+  int* siteChains;        // 4/8 bytes, chain index of every site
+  int* siteResidues;      // 4/8 bytes, residue index in the chain of every site
+  int* rotamerOffsets;    // 4/8 bytes, first rotamer of every site, siteNum+1 entries. the rotamers of a site are
+                          // those of its rotamer set in the same order and are placed in a residue only when needed
+  BOOL* allowed;          // 4/8 bytes, FALSE for the rotamers that the packer must not choose
+  int* blockIndexes;      // 4/8 bytes, row or column of every rotamer in the pair blocks of its site, -1 if not allowed
+  int* blockCounts;       // 4/8 bytes, rotamers of every site in the pair blocks, those allowed when the matrix was built
+  double* oneBody;        // 4/8 bytes, one-body energy of every rotamer
+  int* edgeSites;         // 4/8 bytes, two site indexes per edge, the first is the lower one
+  int* edgeOffsets;       // 4/8 bytes, first pair energy of every edge, edgeNum+1 entries
+  double* pairEnergies;   // 4/8 bytes, a block count(first) x block count(second) block per edge, row-major
+  int* siteEdgeOffsets;   // 4/8 bytes, first edge of every site in siteEdges, siteNum+1 entries
+  int* siteEdges;         // 4/8 bytes, the edges of every site
+  int* assignment;        // 4/8 bytes, current rotamer of every site in its own numbering, -1 if none
+  int siteNum;            // 4 bytes
+  int rotamerNum;         // 4 bytes
+  int edgeNum;            // 4 bytes
+} EnergyMatrix;
+
+int EnergyMatrixSetPacker(char* packerName);
+Type_RotamerPacker EnergyMatrixGetPacker();
+int EnergyMatrixSetDeadEndElimination(BOOL enabled);
+BOOL EnergyMatrixIsDeadEndEliminationEnabled();
+int EnergyMatrixSetAnnealStepCount(int stepNum);
+int EnergyMatrixGetAnnealStepCount();
+int EnergyMatrixSetAnnealSeed(unsigned long long seed);
+unsigned long long EnergyMatrixGetAnnealSeed();
+
+int EnergyMatrixCreate(EnergyMatrix* pThis);
+int EnergyMatrixDestroy(EnergyMatrix* pThis);
+int EnergyMatrixBuild(EnergyMatrix* pThis, Structure* pStructure, IntArray* pSites, double rmsdcutoff);
+int EnergyMatrixGetSiteCount(EnergyMatrix* pThis);
+int EnergyMatrixGetRotamerCount(EnergyMatrix* pThis, int site);
+int EnergyMatrixGetEdgeCount(EnergyMatrix* pThis);
+double EnergyMatrixGetOneBody(EnergyMatrix* pThis, int site, int rotamer);
+double EnergyMatrixGetPair(EnergyMatrix* pThis, int edge, int site, int rotamer, int otherRotamer);
+int EnergyMatrixGetOtherSite(EnergyMatrix* pThis, int edge, int site);
+double EnergyMatrixGetRotamerEnergy(EnergyMatrix* pThis, int site, int rotamer);
+double EnergyMatrixGetTotalEnergy(EnergyMatrix* pThis);
+int EnergyMatrixEliminateDeadEnds(EnergyMatrix* pThis, DeadEndStats* pStats);
+int EnergyMatrixOptimizeGreedy(EnergyMatrix* pThis, int* pCycleNum);
+unsigned long long EnergyMatrixRandom(unsigned long long* pState);
+int EnergyMatrixAnneal(EnergyMatrix* pThis, int stepNum, unsigned long long seed, AnnealStats* pStats);
+int EnergyMatrixApply(EnergyMatrix* pThis, Structure* pStructure);
+int EnergyMatrixCheckDeadEndElimination(int matrixNum);
+
+#endif // ENERGY_MATRIX_H
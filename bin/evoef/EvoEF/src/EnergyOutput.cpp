@@ -0,0 +1,196 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "EnergyOutput.h"
+#include <string.h>
+
+// the schema of the records, the order of the terms never changes and new terms are only appended
+static int energyOutputTermIndex[] = {
+   0,
+  21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+   6,  7,  8,  9, 10, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+   1,  2,  3,  4,  5, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+  51, 52, 53, 54, 55, 61, 62, 63, 64, 65, 66, 67, 68, 69
+};
+static const char* energyOutputTermName[] = {
+  "Total",
+  "reference_ALA", "reference_CYS", "reference_ASP", "reference_GLU", "reference_PHE", 
+  "reference_GLY", "reference_HIS", "reference_ILE", "reference_LYS", "reference_LEU", 
+  "reference_MET", "reference_ASN", "reference_PRO", "reference_GLN", "reference_ARG", 
+  "reference_SER", "reference_THR", "reference_VAL", "reference_TRP", "reference_TYR",
+  "intraR_vdwatt", "intraR_vdwrep", "intraR_electr", "intraR_deslvP", "intraR_deslvH",
+  "intraR_hbbbbb_dis", "intraR_hbbbbb_the", "intraR_hbbbbb_phi",
+  "intraR_hbscbb_dis", "intraR_hbscbb_the", "intraR_hbscbb_phi",
+  "intraR_hbscsc_dis", "intraR_hbscsc_the", "intraR_hbscsc_phi",
+  "interS_vdwatt", "interS_vdwrep", "interS_electr", "interS_deslvP", "interS_deslvH",
+  "interS_hbbbbb_dis", "interS_hbbbbb_the", "interS_hbbbbb_phi",
+  "interS_hbscbb_dis", "interS_hbscbb_the", "interS_hbscbb_phi",
+  "interS_hbscsc_dis", "interS_hbscsc_the", "interS_hbscsc_phi",
+  "interD_vdwatt", "interD_vdwrep", "interD_electr", "interD_deslvP", "interD_deslvH",
+  "interD_hbbbbb_dis", "interD_hbbbbb_the", "interD_hbbbbb_phi",
+  "interD_hbscbb_dis", "interD_hbscbb_the", "interD_hbscbb_phi",
+  "interD_hbscsc_dis", "interD_hbscsc_the", "interD_hbscsc_phi"
+};
+
+typedef struct _EnergyOutput{
+  Type_EnergyOutputFormat format;
+  FILE* pFile;              // set by --energy-file, the non-text formats need it
+  BOOL headerWritten;       // the tsv header and the binary header are written once per stream
+  char structureName[ENERGY_OUTPUT_STRUCTURE_LENGTH];
+} EnergyOutput;
+
+EnergyOutput energyOutput = {Type_EnergyOutputFormat_Text, NULL, FALSE, ""};
+
+int EnergyOutputSetFormat(char* formatName){
+  if(!strcmp(formatName, "text")) energyOutput.format = Type_EnergyOutputFormat_Text;
+  else if(!strcmp(formatName, "json")) energyOutput.format = Type_EnergyOutputFormat_Json;
+  else if(!strcmp(formatName, "tsv")) energyOutput.format = Type_EnergyOutputFormat_Tsv;
+  else if(!strcmp(formatName, "binary")) energyOutput.format = Type_EnergyOutputFormat_Binary;
+  else return ValueError;
+  return Success;
+}
+
+Type_EnergyOutputFormat EnergyOutputGetFormat(){
+  return energyOutput.format;
+}
+
+BOOL EnergyOutputIsText(){
+  return energyOutput.format == Type_EnergyOutputFormat_Text;
+}
+
+BOOL EnergyOutputHasFile(){
+  return energyOutput.pFile != NULL;
+}
+
+int EnergyOutputSetFile(char* fileName){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  EnergyOutputClose();
+  energyOutput.pFile = fopen(fileName, "wb");
+  if(energyOutput.pFile == NULL){
+    sprintf(usrMsg, "in file %s function %s() line %d, cannot open energy file %s", __FILE__, __FUNCTION__, __LINE__, fileName);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  energyOutput.headerWritten = FALSE;
+  return Success;
+}
+
+int EnergyOutputSetStructureName(char* structureName){
+  strncpy(energyOutput.structureName, structureName, ENERGY_OUTPUT_STRUCTURE_LENGTH-1);
+  energyOutput.structureName[ENERGY_OUTPUT_STRUCTURE_LENGTH-1] = '\0';
+  return Success;
+}
+
+int EnergyOutputGetTermCount(){
+  return (int)(sizeof(energyOutputTermIndex)/sizeof(int));
+}
+
+int EnergyOutputWriteJsonString(FILE* pFile, const char* str){
+  fputc('"', pFile);
+  for(const char* p = str; *p != '\0'; p++){
+    if(*p == '"' || *p == '\\') fputc('\\', pFile);
+    fputc(*p, pFile);
+  }
+  fputc('"', pFile);
+  return Success;
+}
+
+// the terms as one json object, e.g. {"Total":-24.286000,"reference_ALA":...}
+int EnergyOutputWriteJsonTerms(FILE* pFile, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]){
+  int termCount = EnergyOutputGetTermCount();
+  fputc('{', pFile);
+  for(int i = 0; i < termCount; i++){
+    fprintf(pFile, "%s\"%s\":%.6f", i == 0 ? "" : ",", energyOutputTermName[i], energyTerms[energyOutputTermIndex[i]]);
+  }
+  fputc('}', pFile);
+  return Success;
+}
+
+int EnergyOutputWriteHeader(FILE* pFile){
+  int termCount = EnergyOutputGetTermCount();
+  if(energyOutput.format == Type_EnergyOutputFormat_Tsv){
+    fprintf(pFile, "structure\tevaluation");
+    for(int i = 0; i < termCount; i++) fprintf(pFile, "\t%s", energyOutputTermName[i]);
+    fprintf(pFile, "\n");
+  }
+  else if(energyOutput.format == Type_EnergyOutputFormat_Binary){
+    // magic, version, term count, and the term names in record order
+    int version = ENERGY_OUTPUT_BINARY_VERSION;
+    fwrite(ENERGY_OUTPUT_BINARY_MAGIC, 1, 8, pFile);
+    fwrite(&version, sizeof(int), 1, pFile);
+    fwrite(&termCount, sizeof(int), 1, pFile);
+    for(int i = 0; i < termCount; i++){
+      char name[ENERGY_OUTPUT_NAME_LENGTH] = {0};
+      strncpy(name, energyOutputTermName[i], ENERGY_OUTPUT_NAME_LENGTH-1);
+      fwrite(name, 1, ENERGY_OUTPUT_NAME_LENGTH, pFile);
+    }
+  }
+  return Success;
+}
+
+// one record per evaluation, e.g. the structure, a chain or the binding energy of a complex
+int EnergyOutputWrite(char* evaluation, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]){
+  if(energyOutput.format == Type_EnergyOutputFormat_Text) return Success;
+  FILE* pFile = energyOutput.pFile;
+  if(pFile == NULL){
+    char usrMsg[MAX_LENGTH_ERR_MSG+1];
+    sprintf(usrMsg, "in file %s function %s() line %d, no energy file is open for the %s record", __FILE__, __FUNCTION__, __LINE__, evaluation);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  int termCount = EnergyOutputGetTermCount();
+  if(!energyOutput.headerWritten){
+    EnergyOutputWriteHeader(pFile);
+    energyOutput.headerWritten = TRUE;
+  }
+
+  if(energyOutput.format == Type_EnergyOutputFormat_Json){
+    fprintf(pFile, "{\"structure\":");
+    EnergyOutputWriteJsonString(pFile, energyOutput.structureName);
+    fprintf(pFile, ",\"evaluation\":");
+    EnergyOutputWriteJsonString(pFile, evaluation);
+    fprintf(pFile, ",\"terms\":");
+    EnergyOutputWriteJsonTerms(pFile, energyTerms);
+    fprintf(pFile, "}\n");
+  }
+  else if(energyOutput.format == Type_EnergyOutputFormat_Tsv){
+    fprintf(pFile, "%s\t%s", energyOutput.structureName, evaluation);
+    for(int i = 0; i < termCount; i++) fprintf(pFile, "\t%.6f", energyTerms[energyOutputTermIndex[i]]);
+    fprintf(pFile, "\n");
+  }
+  else{
+    // fixed-size record: structure name, evaluation name and the terms as doubles
+    char structure[ENERGY_OUTPUT_STRUCTURE_LENGTH] = {0};
+    char evaluationName[ENERGY_OUTPUT_EVALUATION_LENGTH] = {0};
+    memcpy(structure, energyOutput.structureName, ENERGY_OUTPUT_STRUCTURE_LENGTH-1);
+    strncpy(evaluationName, evaluation, ENERGY_OUTPUT_EVALUATION_LENGTH-1);
+    fwrite(structure, 1, ENERGY_OUTPUT_STRUCTURE_LENGTH, pFile);
+    fwrite(evaluationName, 1, ENERGY_OUTPUT_EVALUATION_LENGTH, pFile);
+    for(int i = 0; i < termCount; i++) fwrite(&energyTerms[energyOutputTermIndex[i]], sizeof(double), 1, pFile);
+  }
+  fflush(pFile);
+  return Success;
+}
+
+int EnergyOutputClose(){
+  if(energyOutput.pFile != NULL){
+    fclose(energyOutput.pFile);
+    energyOutput.pFile = NULL;
+  }
+  return Success;
+}
@@ -0,0 +1,50 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef ENERGY_OUTPUT_H
+#define ENERGY_OUTPUT_H
+
+#include "EnergyFunction.h"
+
+#define ENERGY_OUTPUT_BINARY_MAGIC         "EVOEFTRM"
+#define ENERGY_OUTPUT_BINARY_VERSION       1
+#define ENERGY_OUTPUT_NAME_LENGTH          24
+#define ENERGY_OUTPUT_STRUCTURE_LENGTH     64
+#define ENERGY_OUTPUT_EVALUATION_LENGTH    16
+
+// text keeps the tables printed by every command, the other formats write one record with all energy terms per evaluation
+typedef enum _Type_EnergyOutputFormat{
+  Type_EnergyOutputFormat_Text,
+  Type_EnergyOutputFormat_Json,
+  Type_EnergyOutputFormat_Tsv,
+  Type_EnergyOutputFormat_Binary
+} Type_EnergyOutputFormat;
+
+int EnergyOutputSetFormat(char* formatName);
+Type_EnergyOutputFormat EnergyOutputGetFormat();
+BOOL EnergyOutputIsText();
+BOOL EnergyOutputHasFile();
+int EnergyOutputSetFile(char* fileName);
+int EnergyOutputSetStructureName(char* structureName);
+int EnergyOutputGetTermCount();
+int EnergyOutputWriteJsonString(FILE* pFile, const char* str);
+int EnergyOutputWriteJsonTerms(FILE* pFile, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]);
+int EnergyOutputWrite(char* evaluation, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]);
+int EnergyOutputClose();
+
+#endif // ENERGY_OUTPUT_H
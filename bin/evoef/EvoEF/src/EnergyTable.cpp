@@ -0,0 +1,194 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "EnergyTable.h"
+#include "EnergyFunction.h"
+#include <stdlib.h>
+#include <math.h>
+
+// the tables are compiled once from the atom parameters and shared by all energy functions
+EnergyTable energyTable = {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0, 0, TRUE};
+
+int EnergyTableFindType(Atom* pAtom){
+  for(int i = 0; i < energyTable.typeNum; i++){
+    if(energyTable.epsilon[i] == pAtom->CHARMM_epsilon && energyTable.radius[i] == pAtom->CHARMM_radius &&
+      energyTable.volume[i] == pAtom->EEF1_volume && energyTable.lamda[i] == pAtom->EEF1_lamda_ &&
+      energyTable.freeDG[i] == pAtom->EEF1_freeDG){
+      return i;
+    }
+  }
+  return -1;
+}
+
+int EnergyTableAddType(Atom* pAtom){
+  int n = energyTable.typeNum+1;
+  energyTable.epsilon = (double*)realloc(energyTable.epsilon, sizeof(double)*n);
+  energyTable.radius = (double*)realloc(energyTable.radius, sizeof(double)*n);
+  energyTable.volume = (double*)realloc(energyTable.volume, sizeof(double)*n);
+  energyTable.lamda = (double*)realloc(energyTable.lamda, sizeof(double)*n);
+  energyTable.freeDG = (double*)realloc(energyTable.freeDG, sizeof(double)*n);
+  energyTable.epsilon[n-1] = pAtom->CHARMM_epsilon;
+  energyTable.radius[n-1] = pAtom->CHARMM_radius;
+  energyTable.volume[n-1] = pAtom->EEF1_volume;
+  energyTable.lamda[n-1] = pAtom->EEF1_lamda_;
+  energyTable.freeDG[n-1] = pAtom->EEF1_freeDG;
+  energyTable.typeNum = n;
+  return n-1;
+}
+
+// LK desolvation of an atom of the given type by a partner of unit volume,
+// the distance is expected to be clamped to r1+r2 by the caller
+double EnergyTableDesolvationFactorAnalytic(int type, double distance){
+  double coefficient = -0.089793561062582974; // 0.5/(pi^1.5)
+  double lamda = energyTable.lamda[type];
+  double x = (distance - energyTable.radius[type]*RADIUS_SCALE_FOR_DESOLV)/lamda;
+  return coefficient * energyTable.freeDG[type] / (lamda * distance * distance) * exp( -1.0 * x * x );
+}
+
+double EnergyTableDesolvationSlopeAnalytic(int type, double distance){
+  double lamda = energyTable.lamda[type];
+  double x = (distance - energyTable.radius[type]*RADIUS_SCALE_FOR_DESOLV)/lamda;
+  return EnergyTableDesolvationFactorAnalytic(type, distance) * (-2.0/distance - 2.0*x/lamda);
+}
+
+int EnergyTableDestroy(){
+  free(energyTable.epsilon);
+  free(energyTable.radius);
+  free(energyTable.volume);
+  free(energyTable.lamda);
+  free(energyTable.freeDG);
+  free(energyTable.hasSpline);
+  free(energyTable.pairRmin);
+  free(energyTable.pairEpsilon);
+  free(energyTable.pairSwitch);
+  free(energyTable.desolvValues);
+  free(energyTable.desolvSlopes);
+  BOOL enabled = energyTable.enabled;
+  EnergyTable empty = {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0, 0, FALSE};
+  energyTable = empty;
+  energyTable.enabled = enabled;
+  return Success;
+}
+
+// assign an energy type to every atom parameter and compile the pair and spline tables,
+// must be called after the EEF1 parameters have been assigned
+int EnergyTableBuild(AtomParamsSet* pAtomParams){
+  EnergyTableDestroy();
+  for(int i = 0; i < AtomParamsSetGetResidueCount(pAtomParams); i++){
+    for(int j = 0; j < pAtomParams->atomCount[i]; j++){
+      Atom* pAtom = &pAtomParams->atoms[i][j];
+      int type = EnergyTableFindType(pAtom);
+      if(type < 0) type = EnergyTableAddType(pAtom);
+      pAtom->energyType = type;
+    }
+  }
+
+  int n = energyTable.typeNum;
+  energyTable.pairRmin = (double*)malloc(sizeof(double)*n*n);
+  energyTable.pairEpsilon = (double*)malloc(sizeof(double)*n*n);
+  energyTable.pairSwitch = (double*)malloc(sizeof(double)*n*n*4);
+  for(int i = 0; i < n; i++){
+    for(int j = 0; j < n; j++){
+      int index = i*n+j;
+      double rmin = RADIUS_SCALE_FOR_VDW * (energyTable.radius[i] + energyTable.radius[j]);
+      double epsilon = sqrt(energyTable.epsilon[i]*energyTable.epsilon[j]);
+      double B6 = pow((double)rmin/5.0, 6.0);
+      double A12 = B6 * B6;
+      double M = epsilon * ( A12 - 2.0 * B6);
+      double N = 2.4 * epsilon * (B6 - A12);
+      energyTable.pairRmin[index] = rmin;
+      energyTable.pairEpsilon[index] = epsilon;
+      energyTable.pairSwitch[4*index+0] = 2 * M + N;
+      energyTable.pairSwitch[4*index+1] = -33 * M - 17 * N;
+      energyTable.pairSwitch[4*index+2] = 180 * M + 96 * N;
+      energyTable.pairSwitch[4*index+3] = -324 * M -180 * N;
+    }
+  }
+
+  energyTable.knotNum = (int)((ENERGY_TABLE_DISTANCE_MAX-ENERGY_TABLE_DISTANCE_MIN)/ENERGY_TABLE_BIN_WIDTH + 0.5) + 1;
+  energyTable.hasSpline = (BOOL*)malloc(sizeof(BOOL)*n);
+  energyTable.desolvValues = (double*)malloc(sizeof(double)*n*energyTable.knotNum);
+  energyTable.desolvSlopes = (double*)malloc(sizeof(double)*n*energyTable.knotNum);
+  for(int i = 0; i < n; i++){
+    energyTable.hasSpline[i] = energyTable.lamda[i] > 0.0 ? TRUE : FALSE;
+    for(int k = 0; k < energyTable.knotNum; k++){
+      double distance = ENERGY_TABLE_DISTANCE_MIN + k*ENERGY_TABLE_BIN_WIDTH;
+      energyTable.desolvValues[i*energyTable.knotNum+k] = energyTable.hasSpline[i] ? EnergyTableDesolvationFactorAnalytic(i, distance) : 0.0;
+      energyTable.desolvSlopes[i*energyTable.knotNum+k] = energyTable.hasSpline[i] ? EnergyTableDesolvationSlopeAnalytic(i, distance) : 0.0;
+    }
+  }
+  return Success;
+}
+
+EnergyTable* EnergyTableGet(){
+  return &energyTable;
+}
+
+BOOL EnergyTableIsEnabled(){
+  return energyTable.enabled && energyTable.typeNum > 0;
+}
+
+int EnergyTableSetEnabled(BOOL enabled){
+  energyTable.enabled = enabled;
+  return Success;
+}
+
+int EnergyTablePairIndex(int type1, int type2){
+  return type1*energyTable.typeNum + type2;
+}
+
+// cubic hermite interpolation between the two knots around the distance
+double EnergyTableDesolvationFactor(int type, double distance){
+  double u = (distance - ENERGY_TABLE_DISTANCE_MIN)/ENERGY_TABLE_BIN_WIDTH;
+  int k = (int)u;
+  if(u < 0.0 || k >= energyTable.knotNum-1 || !energyTable.hasSpline[type]){
+    return EnergyTableDesolvationFactorAnalytic(type, distance);
+  }
+  double t = u - k;
+  double* values = energyTable.desolvValues + type*energyTable.knotNum + k;
+  double* slopes = energyTable.desolvSlopes + type*energyTable.knotNum + k;
+  double t2 = t*t;
+  double t3 = t2*t;
+  return (2.0*t3-3.0*t2+1.0)*values[0] + (t3-2.0*t2+t)*ENERGY_TABLE_BIN_WIDTH*slopes[0] +
+    (-2.0*t3+3.0*t2)*values[1] + (t3-t2)*ENERGY_TABLE_BIN_WIDTH*slopes[1];
+}
+
+// report the largest deviation of the splines from the analytic LK function over all type pairs,
+// sampled at the distances the energy functions can actually ask for
+int EnergyTableCheck(){
+  double maxAbsError = 0.0;
+  double maxRelError = 0.0;
+  int sampleCount = 0;
+  for(int i = 0; i < energyTable.typeNum; i++){
+    if(!energyTable.hasSpline[i]) continue;
+    for(int j = 0; j < energyTable.typeNum; j++){
+      double r12 = (energyTable.radius[i]+energyTable.radius[j])*RADIUS_SCALE_FOR_DESOLV;
+      for(double distance = r12; distance <= LK_SOLV_DISTANCE_CUTOFF; distance += ENERGY_TABLE_BIN_WIDTH/7.0){
+        double exact = energyTable.volume[j]*EnergyTableDesolvationFactorAnalytic(i, distance);
+        double approx = energyTable.volume[j]*EnergyTableDesolvationFactor(i, distance);
+        double error = fabs(exact-approx);
+        if(error > maxAbsError) maxAbsError = error;
+        if(fabs(exact) > 1e-8 && error/fabs(exact) > maxRelError) maxRelError = error/fabs(exact);
+        sampleCount++;
+      }
+    }
+  }
+  printf("energy table: %d atom types, %d knots per spline, bin width %.3f\n", energyTable.typeNum, energyTable.knotNum, ENERGY_TABLE_BIN_WIDTH);
+  printf("desolvation spline vs analytic over %d samples: max abs error %.3e, max rel error %.3e\n", sampleCount, maxAbsError, maxRelError);
+  return Success;
+}
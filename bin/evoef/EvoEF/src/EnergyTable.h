@@ -0,0 +1,58 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef ENERGY_TABLE_H
+#define ENERGY_TABLE_H
+
+#include "AtomParamsSet.h"
+
+// knots of the desolvation splines, distances outside the range are computed analytically
+#define ENERGY_TABLE_DISTANCE_MIN      1.0
+#define ENERGY_TABLE_DISTANCE_MAX      6.0
+#define ENERGY_TABLE_BIN_WIDTH         0.01
+
+// parameters shared by all atoms with the same CHARMM vdw and EEF1 parameters,
+// pair tables are stored as typeNum*typeNum dense matrices
+typedef struct _EnergyTable{
+  double* epsilon;        // per type, CHARMM epsilon
+  double* radius;         // per type, CHARMM radius
+  double* volume;         // per type, EEF1 volume
+  double* lamda;          // per type, EEF1 lamda
+  double* freeDG;         // per type, EEF1 free dG
+  BOOL* hasSpline;        // per type, FALSE if the type has no valid EEF1 parameters
+  double* pairRmin;       // RADIUS_SCALE_FOR_VDW*(r1+r2)
+  double* pairEpsilon;    // sqrt(eps1*eps2)
+  double* pairSwitch;     // four coefficients of the cubic vdw attraction between 5 and 6 angstrom
+  double* desolvValues;   // per type and knot, LK desolvation factor without the volume of the partner
+  double* desolvSlopes;   // per type and knot, derivative of the desolvation factor
+  int typeNum;
+  int knotNum;
+  BOOL enabled;
+} EnergyTable;
+
+int EnergyTableBuild(AtomParamsSet* pAtomParams);
+int EnergyTableDestroy();
+EnergyTable* EnergyTableGet();
+BOOL EnergyTableIsEnabled();
+int EnergyTableSetEnabled(BOOL enabled);
+int EnergyTablePairIndex(int type1, int type2);
+double EnergyTableDesolvationFactorAnalytic(int type, double distance);
+double EnergyTableDesolvationFactor(int type, double distance);
+int EnergyTableCheck();
+
+#endif // ENERGY_TABLE_H
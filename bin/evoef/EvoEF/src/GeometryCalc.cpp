@@ -67,14 +67,15 @@ double XYZNormalization(XYZ* pThis){
 }
 
 double XYZDistance(XYZ* pThis, XYZ* pOther){
-  double distX = pThis->X - pOther->X;
-  double distY = pThis->Y - pOther->Y;
-  double distZ = pThis->Z - pOther->Z;
+  EvoReal distX = pThis->X - pOther->X;
+  EvoReal distY = pThis->Y - pOther->Y;
+  EvoReal distZ = pThis->Z - pOther->Z;
   return sqrt(distX * distX + distY * distY + distZ * distZ);
 }
 
 double XYZDotProduct(XYZ* pThis, XYZ* pOther){
-  return pThis->X*pOther->X + pThis->Y*pOther->Y + pThis->Z*pOther->Z;
+  EvoReal product = pThis->X*pOther->X + pThis->Y*pOther->Y + pThis->Z*pOther->Z;
+  return product;
 }
 
 XYZ XYZCrossProduct(XYZ* pThis, XYZ* pOther){
@@ -87,9 +88,9 @@ XYZ XYZCrossProduct(XYZ* pThis, XYZ* pOther){
 
 double XYZAngle(XYZ* pThis, XYZ* pOther){
   double cosValue;
-  double this2 = pThis->X * pThis->X + pThis->Y * pThis->Y + pThis->Z * pThis->Z;
-  double other2 = pOther->X * pOther->X + pOther->Y * pOther->Y + pOther->Z * pOther->Z;
-  double norm = sqrt(this2 * other2);
+  EvoReal this2 = pThis->X * pThis->X + pThis->Y * pThis->Y + pThis->Z * pThis->Z;
+  EvoReal other2 = pOther->X * pOther->X + pOther->Y * pOther->Y + pOther->Z * pOther->Z;
+  EvoReal norm = sqrt(this2 * other2);
   if(norm < MIN_ZERO_TOLERANCE)  {
     char usrMsg[MAX_LENGTH_ERR_MSG+1];
     int errorCode = ZeroDivisonError;
@@ -365,6 +366,35 @@ int GetFourthAtom(XYZ* pAtomA, XYZ* pAtomB, XYZ* pAtomC, double* icParam, XYZ* p
   return result;
 }
 
+// places atom D of count conformers at once, with the same geometry as GetFourthAtom(): R(CD) is bond, Theta(BCD) is
+// angle and Phi(ABCD) is given by its cosine and sine for every conformer. every atom is a block of count X, then
+// count Y, then count Z coordinates, so the loop below has no dependencies between conformers and is vectorized
+int GetFourthAtoms(int count, double* pAtomsA, double* pAtomsB, double* pAtomsC, double bond, double angle, double* torsionCos, double* torsionSin, double* pAtomsD){
+  double radial = -bond*cos(angle);
+  double tangential = bond*sin(angle);
+  double* ax = pAtomsA; double* ay = pAtomsA+count; double* az = pAtomsA+2*count;
+  double* bx = pAtomsB; double* by = pAtomsB+count; double* bz = pAtomsB+2*count;
+  double* cx = pAtomsC; double* cy = pAtomsC+count; double* cz = pAtomsC+2*count;
+  double* dx = pAtomsD; double* dy = pAtomsD+count; double* dz = pAtomsD+2*count;
+  for(int i=0; i<count; i++){
+    // the local frame at atom C: u along BC, n normal to the plane ABC and m = n x u
+    double ux = cx[i]-bx[i], uy = cy[i]-by[i], uz = cz[i]-bz[i];
+    double norm = 1.0/sqrt(ux*ux+uy*uy+uz*uz);
+    ux *= norm; uy *= norm; uz *= norm;
+    double vx = bx[i]-ax[i], vy = by[i]-ay[i], vz = bz[i]-az[i];
+    double nx = vy*uz-vz*uy, ny = vz*ux-vx*uz, nz = vx*uy-vy*ux;
+    norm = 1.0/sqrt(nx*nx+ny*ny+nz*nz);
+    nx *= norm; ny *= norm; nz *= norm;
+    double mx = ny*uz-nz*uy, my = nz*ux-nx*uz, mz = nx*uy-ny*ux;
+    double along = tangential*torsionCos[i];
+    double normal = tangential*torsionSin[i];
+    dx[i] = cx[i]+radial*ux+along*mx+normal*nx;
+    dy[i] = cy[i]+radial*uy+along*my+normal*ny;
+    dz[i] = cz[i]+radial*uz+along*mz+normal*nz;
+  }
+  return Success;
+}
+
 double GetTorsionAngle(XYZ* pAtomA, XYZ* pAtomB, XYZ* pAtomC, XYZ* pAtomD){
   FourXYZsGroup group;
   FourXYZsGroupCreate(&group, pAtomA, pAtomB, pAtomC, pAtomD);
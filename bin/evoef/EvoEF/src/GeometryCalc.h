@@ -27,8 +27,16 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define PI 3.1415926535898
 #define MIN_ZERO_TOLERANCE 1e-7
 
+// precision of the coordinates and of the atom-pair energy kernels, double unless EvoEF is
+// built with -DEVOEF_SINGLE_PRECISION; energy terms are always accumulated in double
+#ifdef EVOEF_SINGLE_PRECISION
+typedef float EvoReal;
+#else
+typedef double EvoReal;
+#endif
+
 typedef struct _XYZ{
-  double X, Y, Z; //8*3=24 bytes
+  EvoReal X, Y, Z; //8*3=24 bytes, 4*3=12 bytes in single precision
 } XYZ;
 
 int XYZShow(XYZ* pThis);
@@ -73,6 +81,7 @@ int FourXYZsGroupGetFourthAtom(FourXYZsGroup* pThis, double* icParam, XYZ* pAtom
 int FourXYZsGroupGetFourthAtomNew(FourXYZsGroup* pThis, double* icParam, XYZ* pAtomD);
 int FourXYZsGroupGetICParam(FourXYZsGroup* pThis, int torsionProperFlag, double* icParam);
 int GetFourthAtom(XYZ* pAtomA, XYZ* pAtomB, XYZ* pAtomC, double* icParam, XYZ* pAtomD);
+int GetFourthAtoms(int count, double* pAtomsA, double* pAtomsB, double* pAtomsC, double bond, double angle, double* torsionCos, double* torsionSin, double* pAtomsD);
 double GetTorsionAngle(XYZ* pAtomA, XYZ* pAtomB, XYZ* pAtomC, XYZ* pAtomD);
 
 
@@ -20,9 +20,13 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include <ctype.h>
+#include <limits.h>
 
 #include "Getopt.h"
 #include "ProgramFunction.h"
+#include "Worker.h"
+#include "Profiler.h"
 
 clock_t timeStart;
 clock_t timeEnd;
@@ -52,6 +56,18 @@ int main(int argc, char* argv[]){
   int opt;
   char* mutant_file = NULL;
   char *output_file = "evoef.log";
+  BOOL interface_only = FALSE;
+  char* socket_path = NULL;
+  int worker_num = 1;
+  int thread_num = 0;
+  int worker_cache_size = WORKER_DEFAULT_CACHE_SIZE;
+  int anneal_step_num = ENERGY_MATRIX_ANNEAL_DEFAULT_STEP_NUM;
+  unsigned long long anneal_seed = ENERGY_MATRIX_ANNEAL_DEFAULT_SEED;
+  BOOL repair_in_batches = FALSE;
+  char* repair_scope = "all";
+  RepairScope repairScope;
+  char* profile_file = NULL;
+  EvoEF_ParseRepairScope(repair_scope, &repairScope);
   const char *short_opts = "-vhc:i:";
   struct option long_opts[] = {
     {"help",          no_argument,       NULL, 1},
@@ -61,6 +77,23 @@ int main(int argc, char* argv[]){
     {"mutant-file",   required_argument, NULL, 6},
     {"output-file",   optional_argument, NULL, 8},
     {"cutoff",        required_argument, NULL, 9},
+    {"energy-table",  required_argument, NULL, 10},
+    {"binding-mode",  required_argument, NULL, 11},
+    {"threads",       required_argument, NULL, 12},
+    {"output-format", required_argument, NULL, 13},
+    {"energy-file",   required_argument, NULL, 14},
+    {"cache-dir",     required_argument, NULL, 15},
+    {"socket",        required_argument, NULL, 16},
+    {"workers",       required_argument, NULL, 17},
+    {"worker-cache",  required_argument, NULL, 18},
+    {"repair-mode",   required_argument, NULL, 19},
+    {"repair-scope",  required_argument, NULL, 20},
+    {"profile",       optional_argument, NULL, 21},
+    {"packer",        required_argument, NULL, 22},
+    {"dee",           required_argument, NULL, 23},
+    {"rotamer-lib",   required_argument, NULL, 24},
+    {"anneal-steps",  required_argument, NULL, 25},
+    {"seed",          required_argument, NULL, 26},
     {NULL,            no_argument,       NULL, 0}
   };
   
@@ -120,6 +153,109 @@ int main(int argc, char* argv[]){
         fout = freopen(output_file, "w", stdout);
         setvbuf(fout, NULL, _IONBF, 0);
         break;
+      case 10:
+        if(!strcmp(optarg, "on")) EnergyTableSetEnabled(TRUE);
+        else if(!strcmp(optarg, "off")) EnergyTableSetEnabled(FALSE);
+        else{
+          printf("Unknown value %s for option --energy-table, use on or off.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 11:
+        if(!strcmp(optarg, "full")) interface_only = FALSE;
+        else if(!strcmp(optarg, "interface")) interface_only = TRUE;
+        else{
+          printf("Unknown value %s for option --binding-mode, use full or interface.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 12:
+        // 0 uses all hardware threads
+        if(FAILED(ParseIntegerString(optarg, 0, THREAD_POOL_MAX_THREAD_NUM, &thread_num))){
+          printf("Unknown value %s for option --threads, use a number of threads from 0 to %d.\n", optarg, THREAD_POOL_MAX_THREAD_NUM);
+          exit(ValueError);
+        }
+        ThreadPoolSetThreadCount(thread_num);
+        break;
+      case 13:
+        if(FAILED(EnergyOutputSetFormat(optarg))){
+          printf("Unknown value %s for option --output-format, use text, json, tsv or binary.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 14:
+        if(FAILED(EnergyOutputSetFile(optarg))){
+          exit(IOError);
+        }
+        break;
+      case 15:
+        StructureCacheSetDirectory(optarg);
+        break;
+      case 16:
+        socket_path = optarg;
+        break;
+      case 17:
+        if(FAILED(ParseIntegerString(optarg, 0, INT_MAX, &worker_num))){
+          printf("Unknown value %s for option --workers, use a number of worker processes.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 18:
+        if(FAILED(ParseIntegerString(optarg, 1, INT_MAX, &worker_cache_size))){
+          printf("Unknown value %s for option --worker-cache, use a number of structures.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 19:
+        if(!strcmp(optarg, "sequential")) repair_in_batches = FALSE;
+        else if(!strcmp(optarg, "batch")) repair_in_batches = TRUE;
+        else{
+          printf("Unknown value %s for option --repair-mode, use sequential or batch.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 20:
+        repair_scope = optarg;
+        if(FAILED(EvoEF_ParseRepairScope(repair_scope, &repairScope))){
+          exit(ValueError);
+        }
+        break;
+      case 21:
+        // the report is printed at the end, a file given with --profile=<file> receives it as json
+        ProfilerSetEnabled(TRUE);
+        profile_file = optarg;
+        break;
+      case 22:
+        if(FAILED(EnergyMatrixSetPacker(optarg))){
+          printf("Unknown value %s for option --packer, use local, matrix or anneal.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 23:
+        if(!strcmp(optarg, "on")) EnergyMatrixSetDeadEndElimination(TRUE);
+        else if(!strcmp(optarg, "off")) EnergyMatrixSetDeadEndElimination(FALSE);
+        else{
+          printf("Unknown value %s for option --dee, use on or off.\n", optarg);
+          exit(ValueError);
+        }
+        break;
+      case 24:
+        rotamer_lib_file = optarg;
+        break;
+      case 25:
+        if(FAILED(ParseIntegerString(optarg, 0, INT_MAX, &anneal_step_num))){
+          printf("Unknown value %s for option --anneal-steps, use a number of moves from 0 to %d.\n", optarg, INT_MAX);
+          exit(ValueError);
+        }
+        EnergyMatrixSetAnnealStepCount(anneal_step_num);
+        break;
+      case 26:
+        if(FAILED(ParseUnsignedString(optarg, &anneal_seed))){
+          printf("Unknown value %s for option --seed, use a number from 0 to %llu.\n", optarg, ULLONG_MAX);
+          exit(ValueError);
+        }
+        EnergyMatrixSetAnnealSeed(anneal_seed);
+        break;
       default:
         sprintf(usrMsg, "in file %s function %s() line %d, unknown option, EvoEF will exit.", __FILE__, __FUNCTION__, __LINE__);
         TraceError(usrMsg, ValueError);
@@ -127,7 +263,16 @@ int main(int argc, char* argv[]){
         break;
     }
   }
-
+  // the records would be mixed with the printed messages on the standard output
+  if(!EnergyOutputIsText() && !EnergyOutputHasFile()){
+    printf("Option --output-format needs --energy-file=<file> for the json, tsv and binary records.\n");
+    exit(ValueError);
+  }
+  // the local packer has no energy matrix to eliminate rotamers from
+  if(EnergyMatrixIsDeadEndEliminationEnabled() && EnergyMatrixGetPacker() == Type_RotamerPacker_Local){
+    printf("Option --dee=on needs --packer=matrix or --packer=anneal.\n");
+    exit(ValueError);
+  }
 
   // deal with file name
   char pdbid[MAX_LENGTH_ONE_LINE_IN_FILE+1];
@@ -146,17 +291,62 @@ int main(int argc, char* argv[]){
     }
   }
 
+  EnergyOutputSetStructureName(pdbid);
+  StructureCacheSetFiles(pdb_structure_file, atom_param_file, residue_top_file, rotamer_lib_file);
+
   AtomParamsSet atomParam;
   ResiTopoSet resiTopo;
   Structure structure;
+  double profileStart = ProfilerBegin(Type_ProfilePhase_ParameterLoad);
   AtomParamsSetCreate(&atomParam);
   ResiTopoSetCreate(&resiTopo);
   AtomParameterRead(&atomParam, atom_param_file);
   AtomparamsSetAssignEEF1Parameters(&atomParam);
   AtomparamsSetAssignFOLDEFParameters(&atomParam);
+  EnergyTableBuild(&atomParam);
   ResiTopoSetRead(&resiTopo, residue_top_file);
+  BondSeparationBuild(&atomParam, &resiTopo);
+  ProfilerEnd(Type_ProfilePhase_ParameterLoad, profileStart);
+
+  // the worker keeps the parameters loaded and reads the structures from its requests
+  if(!strcmp(cmdname, "Worker")){
+    Worker worker;
+    WorkerCreate(&worker, &atomParam, &resiTopo, rotamer_lib_file, worker_cache_size);
+    int result = socket_path != NULL ? WorkerServeSocket(&worker, socket_path, worker_num) : WorkerServeStdin(&worker);
+    WorkerDestroy(&worker);
+    ResiTopoSetDestroy(&resiTopo);
+    AtomParamsSetDestroy(&atomParam);
+    EnergyTableDestroy();
+    BondSeparationDestroy();
+    return FAILED(result) ? result : Success;
+  }
+  // the dead-end elimination is checked on random energy matrices, no structure is read
+  if(!strcmp(cmdname, "CheckDeadEndElimination")){
+    int result = EnergyMatrixCheckDeadEndElimination(ENERGY_MATRIX_CHECK_DEE_MATRIX_NUM);
+    ResiTopoSetDestroy(&resiTopo);
+    AtomParamsSetDestroy(&atomParam);
+    EnergyTableDestroy();
+    BondSeparationDestroy();
+    return FAILED(result) ? result : Success;
+  }
+
   StructureCreate(&structure);
-  StructureConfig(&structure, pdb_structure_file, &atomParam, &resiTopo);
+  // a configured structure is taken from the cache as a binary image, which skips the pdb parsing and topology build.
+  // the atom layout is part of the key, so that double and single precision builds can share a cache directory
+  char structureKey[STRUCTURE_CACHE_KEY_LENGTH+1];
+  char structureTag[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  sprintf(structureTag, "structure %d", (int)sizeof(Atom));
+  BOOL useStructureCache = StructureCacheIsEnabled() && !FAILED(StructureCacheGetKey(structureTag, FALSE, structureKey));
+  BOOL structureCached = FALSE;
+  if(useStructureCache){
+    profileStart = ProfilerBegin(Type_ProfilePhase_PdbParse);
+    structureCached = !FAILED(StructureCacheFetchStructure(structureKey, &structure));
+    ProfilerEnd(Type_ProfilePhase_PdbParse, profileStart);
+  }
+  if(!structureCached){
+    StructureConfig(&structure, pdb_structure_file, &atomParam, &resiTopo);
+    if(useStructureCache) StructureCacheStoreStructure(structureKey, &structure);
+  }
   printf("pdb file %s.pdb was read by EvoEF.\n", pdbid);
 
   if(!strcmp(cmdname, "ComputeStability")){
@@ -165,21 +355,64 @@ int main(int argc, char* argv[]){
   }
   else if(!strcmp(cmdname, "ComputeBinding")){
     double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM];
-    EvoEF_AnalyseComplex(&structure, energyTerms);
+    if(interface_only) EvoEF_AnalyseInterface(&structure, energyTerms);
+    else EvoEF_AnalyseComplex(&structure, energyTerms);
+  }
+  else if(!strcmp(cmdname, "ComputeModelBinding")){
+    if(mutant_file == NULL){
+      printf("Command ComputeModelBinding needs a list of model pdb files from option --mutant-file, EvoEF will exit.\n");
+      exit(ValueError);
+    }
+    EvoEF_ComputeModelBinding(&structure, mutant_file, &atomParam, &resiTopo);
   }
   else if(!strcmp(cmdname, "RepairStructure")){
-    RotamerLib rotlib;
-    RotamerLibCreate(&rotlib,rotamer_lib_file);
-    EvoEF_RepairPDB(&structure, &rotlib, &atomParam, &resiTopo,pdbid);
-    RotamerLibDestroy(&rotlib);
+    // a cached repair of the same input and force field skips the rotamer library and the repair
+    char key[STRUCTURE_CACHE_KEY_LENGTH+1];
+    char repairfile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+    sprintf(repairfile, "%s_Repair.pdb", pdbid);
+    // the repair modes and scopes give different models, so they are cached apart. a scope of sites depends on the
+    // contents of the mutant file rather than on its name
+    char repairTag[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+    unsigned long long siteHash = 14695981039346656037ULL;
+    if(StructureCacheIsEnabled() && repairScope.type == Type_RepairScope_Sites) StructureCacheHashFile(&siteHash, repairScope.siteFile);
+    if(repairScope.type == Type_RepairScope_All) strcpy(repairTag, repair_in_batches ? "repair batch" : "repair");
+    else sprintf(repairTag, "%s scope %d %016llx %.6f", repair_in_batches ? "repair batch" : "repair", (int)repairScope.type, siteHash, repairScope.distance);
+    BOOL useCache = StructureCacheIsEnabled() && !FAILED(StructureCacheGetKey(repairTag, TRUE, key));
+    if(useCache && !FAILED(StructureCacheFetchFile(key, "pdb", repairfile))){
+      printf("repaired structure %s read from the cache, key %s\n", repairfile, key);
+    }
+    else{
+      RotamerLib rotlib;
+      if(FAILED(RotamerLibCreate(&rotlib,rotamer_lib_file))) exit(IOError);
+      int result = EvoEF_RepairPDB(&structure, &rotlib, &atomParam, &resiTopo,pdbid,repair_in_batches,&repairScope);
+      RotamerLibDestroy(&rotlib);
+      if(FAILED(result)) exit(result);
+      if(useCache) StructureCacheStoreFile(key, "pdb", repairfile);
+    }
   }
   else if(!strcmp(cmdname, "BuildMutant")){
     RotamerLib rotlib;
-    RotamerLibCreate(&rotlib,rotamer_lib_file);
-    mutant_file = "individual_list.txt";
+    if(FAILED(RotamerLibCreate(&rotlib,rotamer_lib_file))) exit(IOError);
+    if(mutant_file == NULL) mutant_file = "individual_list.txt";
     EvoEF_BuildModel(&structure, mutant_file, &rotlib, &atomParam, &resiTopo,pdbid);
     RotamerLibDestroy(&rotlib);
   }
+  else if(!strcmp(cmdname, "ComputeBindingDDG")){
+    if(mutant_file == NULL){
+      printf("Command ComputeBindingDDG needs a mutant list from option --mutant-file, EvoEF will exit.\n");
+      exit(ValueError);
+    }
+    RotamerLib rotlib;
+    if(FAILED(RotamerLibCreate(&rotlib,rotamer_lib_file))) exit(IOError);
+    EvoEF_ComputeBindingDDG(&structure, mutant_file, &rotlib, &atomParam, &resiTopo);
+    RotamerLibDestroy(&rotlib);
+  }
+  else if(!strcmp(cmdname, "ScanSaturation")){
+    RotamerLib rotlib;
+    if(FAILED(RotamerLibCreate(&rotlib,rotamer_lib_file))) exit(IOError);
+    EvoEF_ScanSaturation(&structure, mutant_file, &rotlib, &atomParam, &resiTopo);
+    RotamerLibDestroy(&rotlib);
+  }
   else if(!strcmp(cmdname, "ComputeResiEnergy")){
     for(int i=0; i<StructureGetChainCount(&structure); ++i){
       Chain* pChain=StructureGetChain(&structure,i);
@@ -197,6 +430,16 @@ int main(int argc, char* argv[]){
   else if(!strcmp(cmdname,"OptimizeHydrogen")){
     EvoEF_OptimizeHydrogen(&structure,&atomParam, &resiTopo,pdbid);
   }
+  else if(!strcmp(cmdname,"CheckEnergyTable")){
+    EnergyTableCheck();
+  }
+  else if(!strcmp(cmdname,"CheckEnergyMatrix")){
+    RotamerLib rotlib;
+    if(FAILED(RotamerLibCreate(&rotlib,rotamer_lib_file))) exit(IOError);
+    int result = EvoEF_CheckEnergyMatrix(&structure, &rotlib, &atomParam, &resiTopo);
+    RotamerLibDestroy(&rotlib);
+    if(FAILED(result)) exit(result);
+  }
   else{
     printf("Unknown command name: %s\n, EvoEF will exit.\n", cmdname);
     exit(ValueError);
@@ -204,6 +447,26 @@ int main(int argc, char* argv[]){
   StructureDestroy(&structure);
   ResiTopoSetDestroy(&resiTopo);
   AtomParamsSetDestroy(&atomParam);
+  EnergyTableDestroy();
+  BondSeparationDestroy();
+  EnergyOutputClose();
+
+  // without a file the report goes to the standard error, so that it never mixes with the energies
+  if(ProfilerIsEnabled()){
+    ProfilerShow(profile_file != NULL ? stdout : stderr);
+    FILE* pProfile = profile_file != NULL ? fopen(profile_file, "w") : NULL;
+    if(profile_file != NULL && pProfile == NULL){
+      sprintf(usrMsg, "in file %s function %s() line %d, cannot write the profile to %s", __FILE__, __FUNCTION__, __LINE__, profile_file);
+      TraceError(usrMsg, IOError);
+    }
+    if(pProfile != NULL){
+      ProfilerWriteJson(pProfile);
+      fclose(pProfile);
+    }
+    else{
+      ProfilerWriteJson(stderr);
+    }
+  }
 
   timeEnd = clock();
   SpentTimeShow(timeStart, timeEnd);
@@ -0,0 +1,144 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <mutex>
+
+BOOL profilerEnabled = FALSE;
+
+// the records of every thread are kept apart and added to the totals when a worker of the thread pool finishes, so
+// the counting itself needs no lock
+typedef struct _ProfileRecord{
+  double phaseTimes[Type_ProfilePhase_Count];         // 8 bytes per phase, seconds
+  long long phaseCalls[Type_ProfilePhase_Count];      // 8 bytes per phase
+  long long counters[Type_ProfileCounter_Count];      // 8 bytes per counter
+} ProfileRecord;
+
+ProfileRecord profileTotal;
+std::mutex profileMutex;
+double profileStartTime = 0.0;
+thread_local ProfileRecord profileThread;
+// a phase entered again on the same thread, e.g. a rotamer builder calling another one, is recorded once
+thread_local int profileDepths[Type_ProfilePhase_Count];
+
+const char* profilePhaseNames[Type_ProfilePhase_Count] = {
+  "parameter_load", "pdb_parse", "topology_build", "rotamer_generation", "rotamer_optimization", "energy_evaluation", "pdb_write"
+};
+
+const char* profileCounterNames[Type_ProfileCounter_Count] = {
+  "residue_pairs", "atom_pairs", "atom_pairs_in_cutoff", "dee_rotamers", "dee_single_eliminated", "dee_split_eliminated"
+};
+
+double ProfilerWallTime(){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int ProfilerClearRecord(ProfileRecord* pRecord){
+  for(int i = 0; i < Type_ProfilePhase_Count; i++){
+    pRecord->phaseTimes[i] = 0.0;
+    pRecord->phaseCalls[i] = 0;
+  }
+  for(int i = 0; i < Type_ProfileCounter_Count; i++) pRecord->counters[i] = 0;
+  return Success;
+}
+
+int ProfilerSetEnabled(BOOL enabled){
+  profilerEnabled = enabled;
+  ProfilerClearRecord(&profileTotal);
+  ProfilerClearRecord(&profileThread);
+  profileStartTime = ProfilerWallTime();
+  return Success;
+}
+
+BOOL ProfilerIsEnabled(){
+  return profilerEnabled;
+}
+
+// returns the start time to be passed to ProfilerEnd(), or a negative time when nothing is recorded
+double ProfilerBegin(Type_ProfilePhase phase){
+  if(!profilerEnabled) return -1.0;
+  if(profileDepths[phase]++ > 0) return -1.0;
+  return ProfilerWallTime();
+}
+
+int ProfilerEnd(Type_ProfilePhase phase, double startTime){
+  if(!profilerEnabled) return Success;
+  profileDepths[phase]--;
+  if(startTime < 0.0) return Success;
+  profileThread.phaseTimes[phase] += ProfilerWallTime()-startTime;
+  profileThread.phaseCalls[phase]++;
+  return Success;
+}
+
+int ProfilerCount(Type_ProfileCounter counter, long long count){
+  profileThread.counters[counter] += count;
+  return Success;
+}
+
+// add the records of the calling thread to the totals
+int ProfilerMergeThread(){
+  if(!profilerEnabled) return Success;
+  std::lock_guard<std::mutex> lock(profileMutex);
+  for(int i = 0; i < Type_ProfilePhase_Count; i++){
+    profileTotal.phaseTimes[i] += profileThread.phaseTimes[i];
+    profileTotal.phaseCalls[i] += profileThread.phaseCalls[i];
+  }
+  for(int i = 0; i < Type_ProfileCounter_Count; i++) profileTotal.counters[i] += profileThread.counters[i];
+  ProfilerClearRecord(&profileThread);
+  return Success;
+}
+
+// the time of a phase run on several threads is summed over the threads, so it may exceed the wall time
+int ProfilerShow(FILE* pFile){
+  ProfilerMergeThread();
+  double wallTime = ProfilerWallTime()-profileStartTime;
+  fprintf(pFile, "EvoEF profile: wall time %.3f s on %d thread(s)\n", wallTime, ThreadPoolGetThreadCount());
+  fprintf(pFile, "%-24s %12s %12s %8s\n", "phase", "calls", "time (s)", "share");
+  for(int i = 0; i < Type_ProfilePhase_Count; i++){
+    fprintf(pFile, "%-24s %12lld %12.3f %7.1f%%\n", profilePhaseNames[i], profileTotal.phaseCalls[i], profileTotal.phaseTimes[i],
+      wallTime > 0.0 ? 100.0*profileTotal.phaseTimes[i]/wallTime : 0.0);
+  }
+  long long atomPairs = profileTotal.counters[Type_ProfileCounter_AtomPairs];
+  long long inCutoff = profileTotal.counters[Type_ProfileCounter_AtomPairsInCutoff];
+  fprintf(pFile, "%-24s %12s\n", "counter", "count");
+  for(int i = 0; i < Type_ProfileCounter_Count; i++){
+    fprintf(pFile, "%-24s %12lld\n", profileCounterNames[i], profileTotal.counters[i]);
+    if(i == Type_ProfileCounter_AtomPairsInCutoff) fprintf(pFile, "%-24s %12lld\n", "atom_pairs_skipped", atomPairs-inCutoff);
+  }
+  return Success;
+}
+
+int ProfilerWriteJson(FILE* pFile){
+  ProfilerMergeThread();
+  double wallTime = ProfilerWallTime()-profileStartTime;
+  fprintf(pFile, "{\"wall_time\":%.6f,\"threads\":%d,\"phases\":{", wallTime, ThreadPoolGetThreadCount());
+  for(int i = 0; i < Type_ProfilePhase_Count; i++){
+    fprintf(pFile, "%s\"%s\":{\"calls\":%lld,\"time\":%.6f}", i > 0 ? "," : "", profilePhaseNames[i], profileTotal.phaseCalls[i], profileTotal.phaseTimes[i]);
+  }
+  fprintf(pFile, "},\"counters\":{");
+  for(int i = 0; i < Type_ProfileCounter_Count; i++){
+    fprintf(pFile, "%s\"%s\":%lld", i > 0 ? "," : "", profileCounterNames[i], profileTotal.counters[i]);
+    if(i == Type_ProfileCounter_AtomPairsInCutoff){
+      fprintf(pFile, ",\"atom_pairs_skipped\":%lld", profileTotal.counters[Type_ProfileCounter_AtomPairs]-profileTotal.counters[Type_ProfileCounter_AtomPairsInCutoff]);
+    }
+  }
+  fprintf(pFile, "}}\n");
+  return Success;
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "Utility.h"
+
+// the phases of a command whose wall time and calls are recorded with --profile
+typedef enum _Type_ProfilePhase{
+  Type_ProfilePhase_ParameterLoad,
+  Type_ProfilePhase_PdbParse,
+  Type_ProfilePhase_TopologyBuild,
+  Type_ProfilePhase_RotamerGeneration,
+  Type_ProfilePhase_RotamerOptimization,
+  Type_ProfilePhase_EnergyEvaluation,
+  Type_ProfilePhase_PdbWrite,
+  Type_ProfilePhase_Count
+} Type_ProfilePhase;
+
+typedef enum _Type_ProfileCounter{
+  Type_ProfileCounter_ResiduePairs,
+  Type_ProfileCounter_AtomPairs,
+  Type_ProfileCounter_AtomPairsInCutoff,
+  Type_ProfileCounter_DeeRotamers,
+  Type_ProfileCounter_DeeSingleEliminated,
+  Type_ProfileCounter_DeeSplitEliminated,
+  Type_ProfileCounter_Count
+} Type_ProfileCounter;
+
+// read by the energy kernels before they count their atom pairs
+extern BOOL profilerEnabled;
+
+int ProfilerSetEnabled(BOOL enabled);
+BOOL ProfilerIsEnabled();
+double ProfilerBegin(Type_ProfilePhase phase);
+int ProfilerEnd(Type_ProfilePhase phase, double startTime);
+int ProfilerCount(Type_ProfileCounter counter, long long count);
+int ProfilerMergeThread();
+int ProfilerShow(FILE* pFile);
+int ProfilerWriteJson(FILE* pFile);
+
+#endif // PROFILER_H
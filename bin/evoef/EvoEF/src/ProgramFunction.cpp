@@ -70,6 +70,13 @@ BOOL CheckCommandName(char* queryname){
     "ComputeResiEnergy",
     "OptimizeHydrogen",
     "ShowResiComposition",
+    "CheckEnergyTable",
+    "CheckEnergyMatrix",
+    "CheckDeadEndElimination",
+    "ComputeModelBinding",
+    "ComputeBindingDDG",
+    "ScanSaturation",
+    "Worker",
     NULL
   };
 
@@ -86,44 +93,26 @@ BOOL CheckCommandName(char* queryname){
   return exist;
 }
 
-int EvoEF_Stability(Structure *pStructure, double *energyTerms){
+// weighted stability terms of the whole structure without printing them, term [0] is the total
+int EvoEF_ComputeStructureStability(Structure *pStructure, double *energyTerms){
   for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = 0.0;
-  int aas[20]={0}; //ACDEFGHIKLMNPQRSTVWY, only for regular amino acid
-  StructureGetAminoAcidComposition(pStructure, aas);
   // if the structure is composed of several chains, the residue position could be different in the whole structure from that in the separate chain
   StructureComputeResiduePosition(pStructure);
-  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
-    Chain *pChainI = StructureGetChain(pStructure,i);
-    for(int ir = 0; ir < ChainGetResidueCount(pChainI); ir++){
-      Residue *pResIR = ChainGetResidue(pChainI,ir);
-      double ratio1 = CalcResidueBuriedRatio(pResIR);
-      double refer=0.0;
-      ResidueReferenceEnergy(pResIR, energyTerms);
-      EVOEF_EnergyResidueSelfEnergy(pResIR,ratio1,energyTerms);
-      for(int is = ir+1; is < ChainGetResidueCount(pChainI); is++){
-        Residue *pResIS = ChainGetResidue(pChainI,is);
-        double ratio2 = CalcResidueBuriedRatio(pResIS);
-        double ratio12 = CalcAverageBuriedRatio(ratio1, ratio2);
-        if(is==ir+1) EVOEF_EnergyResidueAndNextResidue(pResIR,pResIS,ratio12,energyTerms);
-        else EVOEF_EnergyResidueAndOtherResidueSameChain(pResIR,pResIS,ratio12,energyTerms);
-      }
-      for(int k = i+1; k < StructureGetChainCount(pStructure); k++){
-        Chain *pChainK = StructureGetChain(pStructure,k);
-        for(int ks = 0; ks < ChainGetResidueCount(pChainK); ks++){
-          Residue *pResKS = ChainGetResidue(pChainK,ks);
-          double ratio2 = CalcResidueBuriedRatio(pResKS);
-          double ratio12 = CalcAverageBuriedRatio(ratio1, ratio2);
-          EVOEF_EnergyResidueAndOtherResidueDifferentChain(pResIR,pResKS,ratio12,energyTerms);
-        }
-      }
-    }
-  }
+  EvoEF_ComputeStabilityTerms(pStructure, -1, energyTerms);
 
   //total energy: weighted
   EnergyTermWeighting(energyTerms);
   for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++){
     energyTerms[0] += energyTerms[i];
   }
+  return Success;
+}
+
+int EvoEF_Stability(Structure *pStructure, double *energyTerms){
+  int aas[20]={0}; //ACDEFGHIKLMNPQRSTVWY, only for regular amino acid
+  StructureGetAminoAcidComposition(pStructure, aas);
+  EvoEF_ComputeStructureStability(pStructure, energyTerms);
+  if(!EnergyOutputIsText()) return EnergyOutputWrite("structure", energyTerms);
 
   //energy term details: not weighted
   printf("\nStructure energy details:\n");
@@ -196,6 +185,77 @@ int EvoEF_Stability(Structure *pStructure, double *energyTerms){
 
 
 
+int EvoEF_ShowBindingEnergy(double *energyTerms){
+  if(!EnergyOutputIsText()) return EnergyOutputWrite("binding", energyTerms);
+  printf("Binding energy details:\n");
+  printf("reference_ALA         =            %8.2f\n", energyTerms[21]);
+  printf("reference_CYS         =            %8.2f\n", energyTerms[22]);
+  printf("reference_ASP         =            %8.2f\n", energyTerms[23]);
+  printf("reference_GLU         =            %8.2f\n", energyTerms[24]);
+  printf("reference_PHE         =            %8.2f\n", energyTerms[25]);
+  printf("reference_GLY         =            %8.2f\n", energyTerms[26]);
+  printf("reference_HIS         =            %8.2f\n", energyTerms[27]);
+  printf("reference_ILE         =            %8.2f\n", energyTerms[28]);
+  printf("reference_LYS         =            %8.2f\n", energyTerms[29]);
+  printf("reference_LEU         =            %8.2f\n", energyTerms[30]);
+  printf("reference_MET         =            %8.2f\n", energyTerms[31]);
+  printf("reference_ASN         =            %8.2f\n", energyTerms[32]);
+  printf("reference_PRO         =            %8.2f\n", energyTerms[33]);
+  printf("reference_GLN         =            %8.2f\n", energyTerms[34]);
+  printf("reference_ARG         =            %8.2f\n", energyTerms[35]);
+  printf("reference_SER         =            %8.2f\n", energyTerms[36]);
+  printf("reference_THR         =            %8.2f\n", energyTerms[37]);
+  printf("reference_VAL         =            %8.2f\n", energyTerms[38]);
+  printf("reference_TRP         =            %8.2f\n", energyTerms[39]);
+  printf("reference_TYR         =            %8.2f\n", energyTerms[40]);
+  printf("intraR_vdwatt         =            %8.2f\n", energyTerms[6]);
+  printf("intraR_vdwrep         =            %8.2f\n", energyTerms[7]);
+  printf("intraR_electr         =            %8.2f\n", energyTerms[8]);
+  printf("intraR_deslvP         =            %8.2f\n", energyTerms[9]);
+  printf("intraR_deslvH         =            %8.2f\n", energyTerms[10]);
+  printf("intraR_hbbbbb_dis     =            %8.2f\n", energyTerms[41]);
+  printf("intraR_hbbbbb_the     =            %8.2f\n", energyTerms[42]);
+  printf("intraR_hbbbbb_phi     =            %8.2f\n", energyTerms[43]);
+  printf("intraR_hbscbb_dis     =            %8.2f\n", energyTerms[44]);
+  printf("intraR_hbscbb_the     =            %8.2f\n", energyTerms[45]);
+  printf("intraR_hbscbb_phi     =            %8.2f\n", energyTerms[46]);
+  printf("intraR_hbscsc_dis     =            %8.2f\n", energyTerms[47]);
+  printf("intraR_hbscsc_the     =            %8.2f\n", energyTerms[48]);
+  printf("intraR_hbscsc_phi     =            %8.2f\n", energyTerms[49]);
+  printf("interS_vdwatt         =            %8.2f\n", energyTerms[1]);
+  printf("interS_vdwrep         =            %8.2f\n", energyTerms[2]);
+  printf("interS_electr         =            %8.2f\n", energyTerms[3]);
+  printf("interS_deslvP         =            %8.2f\n", energyTerms[4]);
+  printf("interS_deslvH         =            %8.2f\n", energyTerms[5]);
+  printf("interS_hbbbbb_dis     =            %8.2f\n", energyTerms[11]);
+  printf("interS_hbbbbb_the     =            %8.2f\n", energyTerms[12]);
+  printf("interS_hbbbbb_phi     =            %8.2f\n", energyTerms[13]);
+  printf("interS_hbscbb_dis     =            %8.2f\n", energyTerms[14]);
+  printf("interS_hbscbb_the     =            %8.2f\n", energyTerms[15]);
+  printf("interS_hbscbb_phi     =            %8.2f\n", energyTerms[16]);
+  printf("interS_hbscsc_dis     =            %8.2f\n", energyTerms[17]);
+  printf("interS_hbscsc_the     =            %8.2f\n", energyTerms[18]);
+  printf("interS_hbscsc_phi     =            %8.2f\n", energyTerms[19]);
+  printf("interD_vdwatt         =            %8.2f\n", energyTerms[51]);
+  printf("interD_vdwrep         =            %8.2f\n", energyTerms[52]);
+  printf("interD_electr         =            %8.2f\n", energyTerms[53]);
+  printf("interD_deslvP         =            %8.2f\n", energyTerms[54]);
+  printf("interD_deslvH         =            %8.2f\n", energyTerms[55]);
+  printf("interD_hbbbbb_dis     =            %8.2f\n", energyTerms[61]);
+  printf("interD_hbbbbb_the     =            %8.2f\n", energyTerms[62]);
+  printf("interD_hbbbbb_phi     =            %8.2f\n", energyTerms[63]);
+  printf("interD_hbscbb_dis     =            %8.2f\n", energyTerms[64]);
+  printf("interD_hbscbb_the     =            %8.2f\n", energyTerms[65]);
+  printf("interD_hbscbb_phi     =            %8.2f\n", energyTerms[66]);
+  printf("interD_hbscsc_dis     =            %8.2f\n", energyTerms[67]);
+  printf("interD_hbscsc_the     =            %8.2f\n", energyTerms[68]);
+  printf("interD_hbscsc_phi     =            %8.2f\n", energyTerms[69]);
+  printf("----------------------------------------------------\n");
+  printf("Total                 =            %8.2f\n", energyTerms[0]);
+  return Success;
+}
+
+
 int EvoEF_AnalyseComplex(Structure *pStructure, double *energyTerms){
   double energyTermsStructure[MAX_EVOEF_ENERGY_TERM_NUM];
   double energyTermsChain[MAX_EVOEF_ENERGY_TERM_NUM];
@@ -214,89 +274,100 @@ int EvoEF_AnalyseComplex(Structure *pStructure, double *energyTerms){
   }
 
   // energy terms are weighted during the calculation, don't weight them for the difference
-  printf("Binding energy details:\n");
-  printf("reference_ALA         =            %8.2f\n", energyTermsStructure[21] - energyTermsChainSum[21]);
-  printf("reference_CYS         =            %8.2f\n", energyTermsStructure[22] - energyTermsChainSum[22]);
-  printf("reference_ASP         =            %8.2f\n", energyTermsStructure[23] - energyTermsChainSum[23]);
-  printf("reference_GLU         =            %8.2f\n", energyTermsStructure[24] - energyTermsChainSum[24]);
-  printf("reference_PHE         =            %8.2f\n", energyTermsStructure[25] - energyTermsChainSum[25]);
-  printf("reference_GLY         =            %8.2f\n", energyTermsStructure[26] - energyTermsChainSum[26]);
-  printf("reference_HIS         =            %8.2f\n", energyTermsStructure[27] - energyTermsChainSum[27]);
-  printf("reference_ILE         =            %8.2f\n", energyTermsStructure[28] - energyTermsChainSum[28]);
-  printf("reference_LYS         =            %8.2f\n", energyTermsStructure[29] - energyTermsChainSum[29]);
-  printf("reference_LEU         =            %8.2f\n", energyTermsStructure[30] - energyTermsChainSum[30]);
-  printf("reference_MET         =            %8.2f\n", energyTermsStructure[31] - energyTermsChainSum[31]);
-  printf("reference_ASN         =            %8.2f\n", energyTermsStructure[32] - energyTermsChainSum[32]);
-  printf("reference_PRO         =            %8.2f\n", energyTermsStructure[33] - energyTermsChainSum[33]);
-  printf("reference_GLN         =            %8.2f\n", energyTermsStructure[34] - energyTermsChainSum[34]);
-  printf("reference_ARG         =            %8.2f\n", energyTermsStructure[35] - energyTermsChainSum[35]);
-  printf("reference_SER         =            %8.2f\n", energyTermsStructure[36] - energyTermsChainSum[36]);
-  printf("reference_THR         =            %8.2f\n", energyTermsStructure[37] - energyTermsChainSum[37]);
-  printf("reference_VAL         =            %8.2f\n", energyTermsStructure[38] - energyTermsChainSum[38]);
-  printf("reference_TRP         =            %8.2f\n", energyTermsStructure[39] - energyTermsChainSum[39]);
-  printf("reference_TYR         =            %8.2f\n", energyTermsStructure[40] - energyTermsChainSum[40]);
-  printf("intraR_vdwatt         =            %8.2f\n", energyTermsStructure[6] - energyTermsChainSum[6]);
-  printf("intraR_vdwrep         =            %8.2f\n", energyTermsStructure[7] - energyTermsChainSum[7]);
-  printf("intraR_electr         =            %8.2f\n", energyTermsStructure[8] - energyTermsChainSum[8]);
-  printf("intraR_deslvP         =            %8.2f\n", energyTermsStructure[9] - energyTermsChainSum[9]);
-  printf("intraR_deslvH         =            %8.2f\n", energyTermsStructure[10] - energyTermsChainSum[10]);
-  printf("intraR_hbbbbb_dis     =            %8.2f\n", energyTermsStructure[41] - energyTermsChainSum[41]);
-  printf("intraR_hbbbbb_the     =            %8.2f\n", energyTermsStructure[42] - energyTermsChainSum[42]);
-  printf("intraR_hbbbbb_phi     =            %8.2f\n", energyTermsStructure[43] - energyTermsChainSum[43]);
-  printf("intraR_hbscbb_dis     =            %8.2f\n", energyTermsStructure[44] - energyTermsChainSum[44]);
-  printf("intraR_hbscbb_the     =            %8.2f\n", energyTermsStructure[45] - energyTermsChainSum[45]);
-  printf("intraR_hbscbb_phi     =            %8.2f\n", energyTermsStructure[46] - energyTermsChainSum[46]);
-  printf("intraR_hbscsc_dis     =            %8.2f\n", energyTermsStructure[47] - energyTermsChainSum[47]);
-  printf("intraR_hbscsc_the     =            %8.2f\n", energyTermsStructure[48] - energyTermsChainSum[48]);
-  printf("intraR_hbscsc_phi     =            %8.2f\n", energyTermsStructure[49] - energyTermsChainSum[49]);
-  printf("interS_vdwatt         =            %8.2f\n", energyTermsStructure[1] - energyTermsChainSum[1]);
-  printf("interS_vdwrep         =            %8.2f\n", energyTermsStructure[2] - energyTermsChainSum[2]);
-  printf("interS_electr         =            %8.2f\n", energyTermsStructure[3] - energyTermsChainSum[3]);
-  printf("interS_deslvP         =            %8.2f\n", energyTermsStructure[4] - energyTermsChainSum[4]);
-  printf("interS_deslvH         =            %8.2f\n", energyTermsStructure[5] - energyTermsChainSum[5]);
-  printf("interS_hbbbbb_dis     =            %8.2f\n", energyTermsStructure[11] - energyTermsChainSum[11]);
-  printf("interS_hbbbbb_the     =            %8.2f\n", energyTermsStructure[12] - energyTermsChainSum[12]);
-  printf("interS_hbbbbb_phi     =            %8.2f\n", energyTermsStructure[13] - energyTermsChainSum[13]);
-  printf("interS_hbscbb_dis     =            %8.2f\n", energyTermsStructure[14] - energyTermsChainSum[14]);
-  printf("interS_hbscbb_the     =            %8.2f\n", energyTermsStructure[15] - energyTermsChainSum[15]);
-  printf("interS_hbscbb_phi     =            %8.2f\n", energyTermsStructure[16] - energyTermsChainSum[16]);
-  printf("interS_hbscsc_dis     =            %8.2f\n", energyTermsStructure[17] - energyTermsChainSum[17]);
-  printf("interS_hbscsc_the     =            %8.2f\n", energyTermsStructure[18] - energyTermsChainSum[18]);
-  printf("interS_hbscsc_phi     =            %8.2f\n", energyTermsStructure[19] - energyTermsChainSum[19]);
-  printf("interD_vdwatt         =            %8.2f\n", energyTermsStructure[51] - energyTermsChainSum[51]);
-  printf("interD_vdwrep         =            %8.2f\n", energyTermsStructure[52] - energyTermsChainSum[52]);
-  printf("interD_electr         =            %8.2f\n", energyTermsStructure[53] - energyTermsChainSum[53]);
-  printf("interD_deslvP         =            %8.2f\n", energyTermsStructure[54] - energyTermsChainSum[54]);
-  printf("interD_deslvH         =            %8.2f\n", energyTermsStructure[55] - energyTermsChainSum[55]);
-  printf("interD_hbbbbb_dis     =            %8.2f\n", energyTermsStructure[61] - energyTermsChainSum[61]);
-  printf("interD_hbbbbb_the     =            %8.2f\n", energyTermsStructure[62] - energyTermsChainSum[62]);
-  printf("interD_hbbbbb_phi     =            %8.2f\n", energyTermsStructure[63] - energyTermsChainSum[63]);
-  printf("interD_hbscbb_dis     =            %8.2f\n", energyTermsStructure[64] - energyTermsChainSum[64]);
-  printf("interD_hbscbb_the     =            %8.2f\n", energyTermsStructure[65] - energyTermsChainSum[65]);
-  printf("interD_hbscbb_phi     =            %8.2f\n", energyTermsStructure[66] - energyTermsChainSum[66]);
-  printf("interD_hbscsc_dis     =            %8.2f\n", energyTermsStructure[67] - energyTermsChainSum[67]);
-  printf("interD_hbscsc_the     =            %8.2f\n", energyTermsStructure[68] - energyTermsChainSum[68]);
-  printf("interD_hbscsc_phi     =            %8.2f\n", energyTermsStructure[69] - energyTermsChainSum[69]);
-  printf("----------------------------------------------------\n");
-  printf("Total                 =            %8.2f\n", energyTermsStructure[0] - energyTermsChainSum[0]);
+  for(int j = 0; j < MAX_EVOEF_ENERGY_TERM_NUM; j++){
+    energyTerms[j] = energyTermsStructure[j] - energyTermsChainSum[j];
+  }
+  EvoEF_ShowBindingEnergy(energyTerms);
   return Success;
 }
 
 
-//this function is used to build the structure model of mutations
-int EvoEF_BuildModel(Structure* pStructure, char* mutantfile, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid){
+// binding energy of the input complex, taken from the structure cache when it is enabled and holds the entry.
+// like the structure key, the key holds the atom layout, so that double and single precision energies are kept apart
+int EvoEF_ComputeWildtypeBinding(Structure *pStructure, double *energyTerms){
+  char key[STRUCTURE_CACHE_KEY_LENGTH+1];
+  char tag[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  sprintf(tag, "binding %d", (int)sizeof(Atom));
+  BOOL useCache = StructureCacheIsEnabled() && !FAILED(StructureCacheGetKey(tag, FALSE, key));
+  if(useCache && !FAILED(StructureCacheFetchEnergy(key, pStructure, energyTerms))){
+    printf("binding energy of the input structure read from the cache, key %s\n", key);
+    return Success;
+  }
+  EvoEF_ComputeBinding(pStructure, energyTerms);
+  if(useCache) StructureCacheStoreEnergy(key, pStructure, energyTerms);
+  return Success;
+}
+
+
+// only inter-chain pairs are evaluated, the printed binding energy equals that of EvoEF_AnalyseComplex
+int EvoEF_AnalyseInterface(Structure *pStructure, double *energyTerms){
+  EvoEF_ComputeWildtypeBinding(pStructure, energyTerms);
+  EvoEF_ShowBindingEnergy(energyTerms);
+  return Success;
+}
+
+
+// binding energies of models built from the reference complex, e.g. the mutants written by BuildMutant,
+// the residue-pair energies of the reference are cached so that only the residues changed in a model are re-evaluated
+int EvoEF_ComputeModelBinding(Structure* pStructure, char* modelfile, AtomParamsSet* atomParams, ResiTopoSet* resiTopos){
   FileReader fr;
-  FileReaderCreate(&fr, mutantfile);
+  if(FAILED(FileReaderCreate(&fr, modelfile))){
+    printf("Cannot read the model list file %s\n", modelfile);
+    return IOError;
+  }
+  EnergyGraph graph;
+  EnergyGraphCreate(&graph);
+  EnergyGraphBuild(&graph, pStructure);
+  double energyTermsRef[MAX_EVOEF_ENERGY_TERM_NUM];
+  EnergyGraphGetBindingEnergy(&graph, energyTermsRef);
+  printf("reference binding energy %8.2f, %d residues, %d residue pairs\n", energyTermsRef[0], EnergyGraphGetResidueCount(&graph), EnergyGraphGetEdgeCount(&graph));
+  EnergyOutputWrite("binding", energyTermsRef);
+
+  char line[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char modelpdb[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  while(!FAILED(FileReaderGetNextLine(&fr, line))){
+    if(FAILED(ExtractFirstStringFromSourceString(modelpdb, line))) continue;
+    Structure model;
+    StructureCreate(&model);
+    StructureConfig(&model, modelpdb, atomParams, resiTopos);
+    double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM];
+    int changedCount = 0;
+    if(FAILED(EnergyGraphComputeModelBinding(&graph, &model, energyTerms, &changedCount))){
+      printf("model %s: failed\n", modelpdb);
+    }
+    else{
+      printf("model %s: binding energy %8.2f, ddG %8.2f, %d residues re-evaluated\n", modelpdb, energyTerms[0], energyTerms[0]-energyTermsRef[0], changedCount);
+      EnergyOutputSetStructureName(modelpdb);
+      EnergyOutputWrite("binding", energyTerms);
+    }
+    StructureDestroy(&model);
+  }
+  EnergyGraphDestroy(&graph);
+  FileReaderDestroy(&fr);
+  return Success;
+}
+
+
+// reads the mutants from the mutant file, one mutant per line, single mutations are divided by ',' and the line ends with ';'
+int EvoEF_ReadMutantFile(char* mutantfile, StringArray** pMutants, int* pMutantCount){
+  FileReader fr;
+  *pMutants = NULL;
+  *pMutantCount = 0;
+  if(FAILED(FileReaderCreate(&fr, mutantfile))){
+    printf("Cannot read the mutant file %s\n", mutantfile);
+    return IOError;
+  }
   int mutantcount = FileReaderGetLineCount(&fr);
   if(mutantcount<=0){
     printf("There is no mutant found in the mutant file\n");
+    FileReaderDestroy(&fr);
     return DataNotExistError;
   }
 
   StringArray* mutants = (StringArray*)malloc(sizeof(StringArray)*mutantcount);
   char line[MAX_LENGTH_ONE_LINE_IN_FILE+1];
   int mutantIndex=0;
-  while(!FAILED(FileReaderGetNextLine(&fr, line))){
+  while(mutantIndex<mutantcount && !FAILED(FileReaderGetNextLine(&fr, line))){
     StringArrayCreate(&mutants[mutantIndex]);
     StringArraySplitString(&mutants[mutantIndex], line, ',');
     char lastMutant[MAX_LENGTH_ONE_LINE_IN_FILE+1];
@@ -310,87 +381,234 @@ int EvoEF_BuildModel(Structure* pStructure, char* mutantfile, RotamerLib* rotlib
     mutantIndex++;
   }
   FileReaderDestroy(&fr);
+  *pMutants = mutants;
+  *pMutantCount = mutantIndex;
+  return Success;
+}
 
-  for(int mutantIndex = 0; mutantIndex < mutantcount; mutantIndex++){
-    //initialize designsites first
-    StructureInitializeDesignSites(pStructure);
-    //for each mutant, build the rotamer-tree
-    IntArray mutantArray,rotamersArray;
-    IntArrayCreate(&mutantArray,0);
-    IntArrayCreate(&rotamersArray,0);
-    for(int cycle=0; cycle<StringArrayGetCount(&mutants[mutantIndex]); cycle++){
-      char mutstr[10];
-      char aa1, chn, aa2;
-      int posInChain;
-      strcpy(mutstr, StringArrayGet(&mutants[mutantIndex], cycle));
-      sscanf(mutstr, "%c%c%d%c", &aa1, &chn, &posInChain, &aa2);
-      int chainIndex = -1, residueIndex = -1;
-      char chainname[MAX_LENGTH_CHAIN_NAME]; chainname[0] = chn; chainname[1] = '\0';
-      StructureFindChain(pStructure, chainname, &chainIndex);
-      if(chainIndex==-1){
-        printf("in file %s function %s() line %d, cannot find mutation %s\n", __FILE__, __FUNCTION__, __LINE__, mutstr);
-        exit(ValueError);
+
+// builds one mutant in place, the mutated sites and the residues around them are repacked. the repacked residues are
+// detached first, so the mutant can also be built on a snapshot of the wild type
+// repack the design sites given as chain and residue index pairs with the packer chosen by --packer. the local packer
+// optimizes the sites one after the other in the given order for 3 cycles, the matrix packer searches the energy
+// matrix of the sites until no site changes and the anneal packer runs --anneal-steps Monte Carlo moves over all sites
+// from the seed given by --seed, both after the dead-end elimination if --dee is on
+int EvoEF_PackRotamers(Structure* pStructure, IntArray* pSites, BOOL showProgress){
+  if(EnergyMatrixGetPacker() == Type_RotamerPacker_Local){
+    for(int cycle=0; cycle<3; cycle++){
+      if(showProgress) printf("optimization cycle %d ...\n",cycle+1);
+      for(int ii=0; ii<IntArrayGetLength(pSites); ii+=2){
+        int chainIndex = IntArrayGet(pSites, ii);
+        int resiIndex = IntArrayGet(pSites, ii+1);
+        //ProteinSiteOptimizeRotamer(pStructure, chainIndex, resiIndex);
+        ProteinSiteOptimizeRotamerLocally(pStructure,chainIndex,resiIndex,1.0);
       }
-      ChainFindResidueByPosInChain(StructureGetChain(pStructure, chainIndex), posInChain, &residueIndex);
-      if(residueIndex==-1){
-        printf("in file %s function %s() line %d, cannot find mutation %s\n", __FILE__, __FUNCTION__, __LINE__, mutstr);
-        exit(ValueError);
+    }
+    return Success;
+  }
+
+  EnergyMatrix matrix;
+  EnergyMatrixCreate(&matrix);
+  EnergyMatrixBuild(&matrix, pStructure, pSites, 1.0);
+  if(EnergyMatrixIsDeadEndEliminationEnabled()){
+    DeadEndStats stats;
+    EnergyMatrixEliminateDeadEnds(&matrix, &stats);
+    if(showProgress){
+      printf("dead-end elimination removed %d of %d rotamers (Goldstein %d, split %d) in %d passes\n",
+        stats.singleEliminated+stats.splitEliminated, stats.rotamerNum, stats.singleEliminated, stats.splitEliminated, stats.passNum);
+    }
+  }
+  if(EnergyMatrixGetPacker() == Type_RotamerPacker_Anneal){
+    AnnealStats stats;
+    EnergyMatrixAnneal(&matrix, EnergyMatrixGetAnnealStepCount(), EnergyMatrixGetAnnealSeed(), &stats);
+    if(showProgress){
+      printf("energy matrix of %d sites, %d rotamers and %d site pairs, annealed in %d moves (%d accepted), energy %.3f\n",
+        EnergyMatrixGetSiteCount(&matrix), matrix.rotamerNum, EnergyMatrixGetEdgeCount(&matrix), stats.stepNum, stats.acceptedNum, stats.bestEnergy);
+    }
+  }
+  else{
+    int cycleNum = 0;
+    EnergyMatrixOptimizeGreedy(&matrix, &cycleNum);
+    if(showProgress){
+      printf("energy matrix of %d sites, %d rotamers and %d site pairs, packed in %d cycles, energy %.3f\n",
+        EnergyMatrixGetSiteCount(&matrix), matrix.rotamerNum, EnergyMatrixGetEdgeCount(&matrix), cycleNum, EnergyMatrixGetTotalEnergy(&matrix));
+    }
+  }
+  EnergyMatrixApply(&matrix, pStructure);
+  EnergyMatrixDestroy(&matrix);
+  return Success;
+}
+
+// checks the energy matrix against the energy function on the input structure. up to ENERGY_MATRIX_CHECK_SITE_NUM
+// residues next to another chain, or the first residues of a single chain, get their wild-type and crystal rotamers.
+// for the starting packing of the matrix, its greedy packing and random packings, the change of the matrix energy
+// from the starting packing must equal the change of the stability energy, as the interactions among the fixed
+// residues cancel. the burial counts are not updated between the packings, as in the matrix
+int EvoEF_CheckEnergyMatrix(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos){
+  IntArray sites;
+  IntArrayCreate(&sites, 0);
+  EvoEF_FindInterfaceSites(pStructure, &sites);
+  if(IntArrayGetLength(&sites) == 0){
+    Chain* pChain = StructureGetChain(pStructure, 0);
+    for(int k = 0; k < ChainGetResidueCount(pChain) && IntArrayGetLength(&sites) < 2*ENERGY_MATRIX_CHECK_SITE_NUM; k++){
+      if(ThreeLetterAAToOneLetterAA(ResidueGetName(ChainGetResidue(pChain, k))) == 'X') continue;
+      IntArrayAppend(&sites, 0);
+      IntArrayAppend(&sites, k);
+    }
+  }
+  if(IntArrayGetLength(&sites) > 2*ENERGY_MATRIX_CHECK_SITE_NUM) IntArrayResize(&sites, 2*ENERGY_MATRIX_CHECK_SITE_NUM);
+  StructureInitializeDesignSites(pStructure);
+  for(int ii = 0; ii < IntArrayGetLength(&sites); ii += 2){
+    int chainIndex = IntArrayGet(&sites, ii);
+    int resiIndex = IntArrayGet(&sites, ii+1);
+    ProteinSiteBuildWildtypeRotamers(pStructure, chainIndex, resiIndex, rotlib, atomParams, resiTopos);
+    ProteinSiteAddCrystalRotamer(pStructure, chainIndex, resiIndex, resiTopos);
+    ResidueDetach(ChainGetResidue(StructureGetChain(pStructure, chainIndex), resiIndex));
+  }
+  StructureComputeResiduePosition(pStructure);
+
+  EnergyMatrix matrix;
+  EnergyMatrixCreate(&matrix);
+  EnergyMatrixBuild(&matrix, pStructure, &sites, 1.0);
+  int siteNum = EnergyMatrixGetSiteCount(&matrix);
+  int* start = (int*)malloc(sizeof(int)*(siteNum+1));
+  memcpy(start, matrix.assignment, sizeof(int)*siteNum);
+  unsigned long long state = ENERGY_MATRIX_ANNEAL_DEFAULT_SEED;
+  double matrixStart = 0.0, stabilityStart = 0.0, maxDeviation = 0.0;
+  int result = Success;
+  for(int packing = 0; packing < ENERGY_MATRIX_CHECK_PACKING_NUM; packing++){
+    memcpy(matrix.assignment, start, sizeof(int)*siteNum);
+    if(packing == 1){
+      EnergyMatrixOptimizeGreedy(&matrix, NULL);
+    }
+    else if(packing > 1){
+      // a random allowed rotamer for every site that has one
+      for(int site = 0; site < siteNum; site++){
+        if(start[site] == -1) continue;
+        do{
+          matrix.assignment[site] = (int)(EnergyMatrixRandom(&state) % EnergyMatrixGetRotamerCount(&matrix, site));
+        }while(!matrix.allowed[matrix.rotamerOffsets[site]+matrix.assignment[site]]);
       }
-      char mutaatype[MAX_LENGTH_RESIDUE_NAME];
-      OneLetterAAToThreeLetterAA(aa2, mutaatype);
-      StringArray designType, patchType;
-      StringArrayCreate(&designType);
-      StringArrayCreate(&patchType);
-      // for histidine, the default mutaatype is HSD, we need to add HSE
-      StringArrayAppend(&designType, mutaatype); StringArrayAppend(&patchType, "");
-      if(aa2=='H'){StringArrayAppend(&designType, "HSE"); StringArrayAppend(&patchType, "");}
-      ProteinSiteBuildMutatedRotamers(pStructure, chainIndex, residueIndex, rotlib, atomParams, resiTopos, &designType, &patchType);
-      IntArrayAppend(&mutantArray, chainIndex);
-      IntArrayAppend(&mutantArray, residueIndex);
-      IntArrayAppend(&rotamersArray,chainIndex);
-      IntArrayAppend(&rotamersArray,residueIndex);
-      StringArrayDestroy(&designType);
-      StringArrayDestroy(&patchType);
-    }
-
-    // for each mutant, find the surrounding residues and build the wild-type rotamer-tree
-    for(int ii=0; ii<IntArrayGetLength(&mutantArray); ii+=2){
-      int chainIndex = IntArrayGet(&mutantArray,ii);
-      int resiIndex = IntArrayGet(&mutantArray,ii+1);
-      Residue *pResi1 = ChainGetResidue(StructureGetChain(pStructure, chainIndex), resiIndex);
-      for(int j = 0; j < StructureGetChainCount(pStructure); ++j){
-        Chain* pChain = StructureGetChain(pStructure,j);
-        for(int k=0; k<ChainGetResidueCount(pChain); k++){
-          Residue* pResi2 = ChainGetResidue(pChain,k);
-          if(AtomArrayCalcMinDistance(&pResi1->atoms,&pResi2->atoms)<VDW_DISTANCE_CUTOFF){
-            if(pResi2->designSiteType==Type_ResidueDesignType_Fixed){
-              ProteinSiteBuildWildtypeRotamers(pStructure,j,k,rotlib,atomParams,resiTopos);
-              ProteinSiteAddCrystalRotamer(pStructure,j,k,resiTopos);
-              IntArrayAppend(&rotamersArray,j);
-              IntArrayAppend(&rotamersArray,k);
-            }
+    }
+    double matrixEnergy = EnergyMatrixGetTotalEnergy(&matrix);
+    EnergyMatrixApply(&matrix, pStructure);
+    double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM];
+    EvoEF_ComputeStabilityTerms(pStructure, -1, energyTerms);
+    EnergyTermWeighting(energyTerms);
+    double stability = 0.0;
+    for(int i = 1; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) stability += energyTerms[i];
+    if(packing == 0){
+      matrixStart = matrixEnergy;
+      stabilityStart = stability;
+    }
+    double deviation = fabs((matrixEnergy-matrixStart)-(stability-stabilityStart));
+    if(deviation > maxDeviation) maxDeviation = deviation;
+    if(deviation > ENERGY_MATRIX_CHECK_TOLERANCE*(1.0+fabs(stability-stabilityStart))) result = ValueError;
+    printf("packing %d: matrix energy %14.6f change %14.6f, stability %14.6f change %14.6f, deviation %.3e\n",
+      packing, matrixEnergy, matrixEnergy-matrixStart, stability, stability-stabilityStart, deviation);
+  }
+  printf("energy matrix of %d sites, %d rotamers and %d site pairs vs stability energy: max deviation %.3e, %s\n",
+    siteNum, matrix.rotamerNum, EnergyMatrixGetEdgeCount(&matrix), maxDeviation, FAILED(result) ? "failed" : "passed");
+  free(start);
+  EnergyMatrixDestroy(&matrix);
+  StructureDeleteRotamers(pStructure);
+  IntArrayDestroy(&sites);
+  return result;
+}
+
+int EvoEF_BuildOneMutant(Structure* pStructure, StringArray* pMutant, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, int mutantIndex, BOOL showProgress){
+  //initialize designsites first
+  StructureInitializeDesignSites(pStructure);
+  //for each mutant, build the rotamer-tree
+  IntArray mutantArray,rotamersArray;
+  IntArrayCreate(&mutantArray,0);
+  IntArrayCreate(&rotamersArray,0);
+  for(int cycle=0; cycle<StringArrayGetCount(pMutant); cycle++){
+    char* mutstr = StringArrayGet(pMutant, cycle);
+    char aa1, chn, aa2;
+    int posInChain;
+    sscanf(mutstr, "%c%c%d%c", &aa1, &chn, &posInChain, &aa2);
+    int chainIndex = -1, residueIndex = -1;
+    char chainname[MAX_LENGTH_CHAIN_NAME]; chainname[0] = chn; chainname[1] = '\0';
+    StructureFindChain(pStructure, chainname, &chainIndex);
+    if(chainIndex!=-1){
+      ChainFindResidueByPosInChain(StructureGetChain(pStructure, chainIndex), posInChain, &residueIndex);
+    }
+    if(chainIndex==-1 || residueIndex==-1){
+      printf("in file %s function %s() line %d, cannot find mutation %s\n", __FILE__, __FUNCTION__, __LINE__, mutstr);
+      StructureDeleteRotamers(pStructure);
+      IntArrayDestroy(&mutantArray);
+      IntArrayDestroy(&rotamersArray);
+      return ValueError;
+    }
+    char mutaatype[MAX_LENGTH_RESIDUE_NAME];
+    OneLetterAAToThreeLetterAA(aa2, mutaatype);
+    StringArray designType, patchType;
+    StringArrayCreate(&designType);
+    StringArrayCreate(&patchType);
+    // for histidine, the default mutaatype is HSD, we need to add HSE
+    StringArrayAppend(&designType, mutaatype); StringArrayAppend(&patchType, "");
+    if(aa2=='H'){StringArrayAppend(&designType, "HSE"); StringArrayAppend(&patchType, "");}
+    ProteinSiteBuildMutatedRotamers(pStructure, chainIndex, residueIndex, rotlib, atomParams, resiTopos, &designType, &patchType);
+    IntArrayAppend(&mutantArray, chainIndex);
+    IntArrayAppend(&mutantArray, residueIndex);
+    IntArrayAppend(&rotamersArray,chainIndex);
+    IntArrayAppend(&rotamersArray,residueIndex);
+    StringArrayDestroy(&designType);
+    StringArrayDestroy(&patchType);
+  }
+
+  // for each mutant, find the surrounding residues and build the wild-type rotamer-tree
+  for(int ii=0; ii<IntArrayGetLength(&mutantArray); ii+=2){
+    int chainIndex = IntArrayGet(&mutantArray,ii);
+    int resiIndex = IntArrayGet(&mutantArray,ii+1);
+    Residue *pResi1 = ChainGetResidue(StructureGetChain(pStructure, chainIndex), resiIndex);
+    for(int j = 0; j < StructureGetChainCount(pStructure); ++j){
+      Chain* pChain = StructureGetChain(pStructure,j);
+      for(int k=0; k<ChainGetResidueCount(pChain); k++){
+        Residue* pResi2 = ChainGetResidue(pChain,k);
+        if(AtomArrayCalcMinDistance(&pResi1->atoms,&pResi2->atoms)<VDW_DISTANCE_CUTOFF){
+          if(pResi2->designSiteType==Type_ResidueDesignType_Fixed){
+            ProteinSiteBuildWildtypeRotamers(pStructure,j,k,rotlib,atomParams,resiTopos);
+            ProteinSiteAddCrystalRotamer(pStructure,j,k,resiTopos);
+            IntArrayAppend(&rotamersArray,j);
+            IntArrayAppend(&rotamersArray,k);
           }
         }
       }
     }
+  }
 
-    // optimization rotamers sequentially
+  for(int ii=0; ii<IntArrayGetLength(&rotamersArray); ii+=2){
+    ResidueDetach(ChainGetResidue(StructureGetChain(pStructure, IntArrayGet(&rotamersArray, ii)), IntArrayGet(&rotamersArray, ii+1)));
+  }
+
+  // optimization rotamers sequentially
+  if(showProgress){
     printf("EvoEF Building Mutation Model %d, the following sites will be optimized:\n",mutantIndex+1);
     IntArrayShow(&rotamersArray);
     printf("\n");
-    for(int cycle=0; cycle<3; cycle++){
-      printf("optimization cycle %d ...\n",cycle+1);
-      for(int ii=0; ii<IntArrayGetLength(&rotamersArray); ii+=2){
-        int chainIndex = IntArrayGet(&rotamersArray, ii);
-        int resiIndex = IntArrayGet(&rotamersArray, ii+1);
-        //ProteinSiteOptimizeRotamer(pStructure, chainIndex, resiIndex);
-        ProteinSiteOptimizeRotamerLocally(pStructure,chainIndex,resiIndex,1.0);
-      }
+  }
+  EvoEF_PackRotamers(pStructure, &rotamersArray, showProgress);
+  IntArrayDestroy(&mutantArray);
+  IntArrayDestroy(&rotamersArray);
+  //remember to delete rotamers for previous mutant
+  StructureDeleteRotamers(pStructure);
+  return Success;
+}
+
+
+//this function is used to build the structure model of mutations
+int EvoEF_BuildModel(Structure* pStructure, char* mutantfile, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid){
+  StringArray* mutants = NULL;
+  int mutantcount = 0;
+  int result = EvoEF_ReadMutantFile(mutantfile, &mutants, &mutantcount);
+  if(FAILED(result)) return result;
+
+  for(int mutantIndex = 0; mutantIndex < mutantcount; mutantIndex++){
+    if(FAILED(EvoEF_BuildOneMutant(pStructure, &mutants[mutantIndex], rotlib, atomParams, resiTopos, mutantIndex, TRUE))){
+      exit(ValueError);
     }
-    IntArrayDestroy(&mutantArray);
-    IntArrayDestroy(&rotamersArray);
-    //remember to delete rotamers for previous mutant
-    StructureDeleteRotamers(pStructure);
 
     char modelfile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
     if(pdbid!=NULL)
@@ -404,44 +622,649 @@ int EvoEF_BuildModel(Structure* pStructure, char* mutantfile, RotamerLib* rotlib
     fclose(pf);
   }
 
+  for(int mutantIndex = 0; mutantIndex < mutantcount; mutantIndex++) StringArrayDestroy(&mutants[mutantIndex]);
+  free(mutants);
   return Success;
 }
 
 
-int EvoEF_RepairPDB(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid){
-  StructureInitializeDesignSites(pStructure);
-  for(int cycle=0; cycle<1; cycle++){
-    printf("EvoEF Repairing PDB: optimization cycle %d ...\n",cycle+1);
-    for(int i=0; i<StructureGetChainCount(pStructure); ++i){
-      Chain* pChain = StructureGetChain(pStructure, i);
-      for(int j=0; j<ChainGetResidueCount(pChain); j++){
-        Residue* pResi = ChainGetResidue(pChain, j);
-        //skip CYS which may form disulfide bonds
-        if(strcmp(ResidueGetName(pResi),"CYS")==0) continue;
-        if(strcmp(ResidueGetName(pResi),"ASN")==0||strcmp(ResidueGetName(pResi),"GLN")==0||strcmp(ResidueGetName(pResi),"HSD")==0||strcmp(ResidueGetName(pResi),"HSE")==0){
-          printf("We will flip residue %s%d%c to optimize hbond\n", ResidueGetChainName(pResi),ResidueGetPosInChain(pResi),ThreeLetterAAToOneLetterAA(ResidueGetName(pResi)));
-          ProteinSiteAddCrystalRotamer(pStructure,i,j,resiTopos);
-          ProteinSiteBuildFlippedCrystalRotamer(pStructure,i,j,resiTopos);
-          ProteinSiteOptimizeRotamerHBondEnergy(pStructure,i,j);
+// every mutant of a ddG scan is built and scored on its own snapshot of the wild type, which is shared read-only by
+// all tasks. only the residues that a mutant mutates or repacks are copied into the snapshot
+typedef struct _MutantBindingTask{
+  Structure* pStructure;      // 4/8 bytes, wild type
+  StringArray* mutants;       // 4/8 bytes, effective single mutations of every mutant
+  RotamerLib* rotlib;         // 4/8 bytes
+  AtomParamsSet* atomParams;  // 4/8 bytes
+  ResiTopoSet* resiTopos;     // 4/8 bytes
+  double* energyTerms;        // 4/8 bytes, MAX_EVOEF_ENERGY_TERM_NUM per mutant
+  int* results;               // 4/8 bytes, one per mutant
+  int firstMutant;            // 4 bytes, index of the first mutant of the current batch
+} MutantBindingTask;
+
+int MutantBindingTaskRun(void* pArgs, int index, int threadIndex){
+  MutantBindingTask* pTask = (MutantBindingTask*)pArgs;
+  int mutantIndex = pTask->firstMutant + index;
+  double* energyTerms = pTask->energyTerms + MAX_EVOEF_ENERGY_TERM_NUM*mutantIndex;
+  // rejected when the mutant file was read
+  if(FAILED(pTask->results[mutantIndex])) return Success;
+  Structure model;
+  StructureCreateSnapshot(&model, pTask->pStructure);
+  pTask->results[mutantIndex] = EvoEF_BuildOneMutant(&model, &pTask->mutants[mutantIndex], pTask->rotlib, pTask->atomParams, pTask->resiTopos, mutantIndex, FALSE);
+  if(!FAILED(pTask->results[mutantIndex])) EvoEF_ComputeBinding(&model, energyTerms);
+  StructureDestroy(&model);
+  return Success;
+}
+
+// binding ddG of every mutant in the mutant file against the given (repaired) wild-type complex, the parameters,
+// the rotamer library and the wild-type binding energy are computed only once. the mutants are built in batches on
+// the thread pool and the results of a batch are printed in the order of the mutant file. mutations of an amino acid
+// into itself are skipped as in run_evoef.pl
+int EvoEF_ComputeBindingDDG(Structure* pStructure, char* mutantfile, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos){
+  StringArray* mutants = NULL;
+  int mutantcount = 0;
+  int result = EvoEF_ReadMutantFile(mutantfile, &mutants, &mutantcount);
+  if(FAILED(result)) return result;
+
+  double energyTermsWT[MAX_EVOEF_ENERGY_TERM_NUM];
+  EvoEF_ComputeWildtypeBinding(pStructure, energyTermsWT);
+  EnergyOutputWrite("binding", energyTermsWT);
+  printf("wild-type binding energy %8.3f\n", energyTermsWT[0]);
+
+  MutantBindingTask task;
+  task.pStructure = pStructure;
+  task.rotlib = rotlib;
+  task.atomParams = atomParams;
+  task.resiTopos = resiTopos;
+  task.mutants = (StringArray*)malloc(sizeof(StringArray)*mutantcount);
+  task.energyTerms = (double*)malloc(sizeof(double)*MAX_EVOEF_ENERGY_TERM_NUM*mutantcount);
+  task.results = (int*)malloc(sizeof(int)*mutantcount);
+  for(int mutantIndex = 0; mutantIndex < mutantcount; mutantIndex++){
+    StringArrayCreate(&task.mutants[mutantIndex]);
+    task.results[mutantIndex] = Success;
+    for(int i = 0; i < StringArrayGetCount(&mutants[mutantIndex]); i++){
+      char* mutstr = StringArrayGet(&mutants[mutantIndex], i);
+      // a mutation is at most 9 characters long, e.g. QA2222222E, as in the worker requests
+      if(strlen(mutstr) > 9) task.results[mutantIndex] = ValueError;
+      else if(strlen(mutstr) > 0 && mutstr[0] != mutstr[strlen(mutstr)-1]) StringArrayAppend(&task.mutants[mutantIndex], mutstr);
+    }
+  }
+
+  int batchSize = 4*ThreadPoolGetThreadCount();
+  for(task.firstMutant = 0; task.firstMutant < mutantcount; task.firstMutant += batchSize){
+    int batchCount = mutantcount-task.firstMutant < batchSize ? mutantcount-task.firstMutant : batchSize;
+    ThreadPoolRun(batchCount, MutantBindingTaskRun, &task);
+    for(int mutantIndex = task.firstMutant; mutantIndex < task.firstMutant+batchCount; mutantIndex++){
+      double* energyTerms = task.energyTerms + MAX_EVOEF_ENERGY_TERM_NUM*mutantIndex;
+      char mutantName[MAX_LENGTH_ONE_LINE_IN_FILE+1] = "";
+      for(int i = 0; i < StringArrayGetCount(&mutants[mutantIndex]); i++){
+        if(i > 0) strcat(mutantName, ",");
+        strcat(mutantName, StringArrayGet(&mutants[mutantIndex], i));
+      }
+      if(FAILED(task.results[mutantIndex])){
+        printf("mutant %s: failed\n", mutantName);
+        continue;
+      }
+      // a mutant made of mutations into the wild-type amino acids only is not built
+      if(StringArrayGetCount(&task.mutants[mutantIndex]) == 0){
+        for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = energyTermsWT[i];
+      }
+      printf("mutant %s: binding energy %8.3f, ddG %8.3f\n", mutantName, energyTerms[0], energyTerms[0]-energyTermsWT[0]);
+      EnergyOutputSetStructureName(mutantName);
+      EnergyOutputWrite("binding", energyTerms);
+    }
+  }
+
+  for(int mutantIndex = 0; mutantIndex < mutantcount; mutantIndex++){
+    StringArrayDestroy(&mutants[mutantIndex]);
+    StringArrayDestroy(&task.mutants[mutantIndex]);
+  }
+  free(mutants);
+  free(task.mutants);
+  free(task.energyTerms);
+  free(task.results);
+  return Success;
+}
+
+
+// interface sites of a complex: amino acids with an atom within VDW_DISTANCE_CUTOFF of a residue in another chain,
+// appended as chain and residue index pairs in chain order
+int EvoEF_FindInterfaceSites(Structure* pStructure, IntArray* pSites){
+  CellList cellList;
+  IntArray neighbors;
+  CellListCreate(&cellList);
+  IntArrayCreate(&neighbors, 0);
+  CellListBuild(&cellList, pStructure, -1, VDW_DISTANCE_CUTOFF);
+  for(int index = 0; index < CellListGetResidueCount(&cellList); index++){
+    Residue* pResidue = CellListGetResidue(&cellList, index);
+    if(ThreeLetterAAToOneLetterAA(ResidueGetName(pResidue)) == 'X') continue;
+    CellListGetAllNeighbors(&cellList, index, &neighbors);
+    for(int n = 0; n < IntArrayGetLength(&neighbors); n++){
+      int neighbor = IntArrayGet(&neighbors, n);
+      if(CellListGetChainIndex(&cellList, neighbor) == CellListGetChainIndex(&cellList, index)) continue;
+      if(AtomArrayCalcMinDistance(&pResidue->atoms, &CellListGetResidue(&cellList, neighbor)->atoms) < VDW_DISTANCE_CUTOFF){
+        IntArrayAppend(pSites, CellListGetChainIndex(&cellList, index));
+        IntArrayAppend(pSites, CellListGetResidueIndex(&cellList, index));
+        break;
+      }
+    }
+  }
+  IntArrayDestroy(&neighbors);
+  CellListDestroy(&cellList);
+  return Success;
+}
+
+// the sites are named as wild-type amino acid, chain and position, so the mutations of a mutant file are read as
+// sites too. the chain and residue index of every site are appended to pSites, unknown sites are skipped
+int EvoEF_ReadSiteFile(Structure* pStructure, char* sitefile, IntArray* pSites){
+  StringArray* lines = NULL;
+  int linecount = 0;
+  int result = EvoEF_ReadMutantFile(sitefile, &lines, &linecount);
+  if(FAILED(result)) return result;
+  for(int i = 0; i < linecount; i++){
+    for(int j = 0; j < StringArrayGetCount(&lines[i]); j++){
+      char* sitestr = StringArrayGet(&lines[i], j);
+      char aa1, chn;
+      int posInChain;
+      int chainIndex = -1, residueIndex = -1;
+      if(sscanf(sitestr, "%c%c%d", &aa1, &chn, &posInChain) == 3){
+        char chainname[MAX_LENGTH_CHAIN_NAME]; chainname[0] = chn; chainname[1] = '\0';
+        StructureFindChain(pStructure, chainname, &chainIndex);
+        if(chainIndex != -1) ChainFindResidueByPosInChain(StructureGetChain(pStructure, chainIndex), posInChain, &residueIndex);
+      }
+      if(chainIndex == -1 || residueIndex == -1){
+        printf("in file %s function %s() line %d, cannot find site %s\n", __FILE__, __FUNCTION__, __LINE__, sitestr);
+        continue;
+      }
+      IntArrayAppend(pSites, chainIndex);
+      IntArrayAppend(pSites, residueIndex);
+    }
+    StringArrayDestroy(&lines[i]);
+  }
+  free(lines);
+  return Success;
+}
+
+// one task per site of a saturation scan. the neighbor shell of the site and its rotamers are built once on a snapshot
+// of the wild type, every amino acid is then packed against it from the wild-type conformation, so each substitution
+// is built as BuildMutant builds the single mutant. the binding energies are updated from the energy graph of the wild
+// type, only the residues changed by a substitution are re-evaluated
+typedef struct _SaturationScanTask{
+  Structure* pStructure;      // 4/8 bytes, wild type
+  EnergyGraph* pGraph;        // 4/8 bytes, energy graph of the wild type
+  int* sites;                 // 4/8 bytes, chain and residue index of every site
+  RotamerLib* rotlib;         // 4/8 bytes
+  AtomParamsSet* atomParams;  // 4/8 bytes
+  ResiTopoSet* resiTopos;     // 4/8 bytes
+  double* energyTerms;        // 4/8 bytes, MAX_EVOEF_ENERGY_TERM_NUM per site and amino acid
+  int* results;               // 4/8 bytes, one per site and amino acid
+} SaturationScanTask;
+
+int SaturationScanTaskRun(void* pArgs, int index, int threadIndex){
+  SaturationScanTask* pTask = (SaturationScanTask*)pArgs;
+  int siteChain = pTask->sites[2*index];
+  int siteResidue = pTask->sites[2*index+1];
+  Structure model;
+  StructureCreateSnapshot(&model, pTask->pStructure);
+  StructureInitializeDesignSites(&model);
+  Residue* pSite = ChainGetResidue(StructureGetChain(&model, siteChain), siteResidue);
+  char wildtype = ThreeLetterAAToOneLetterAA(ResidueGetName(pSite));
+
+  // the neighbor shell, in the order in which EvoEF_BuildOneMutant() repacks it
+  IntArray rotamersArray;
+  IntArrayCreate(&rotamersArray, 0);
+  IntArrayAppend(&rotamersArray, siteChain);
+  IntArrayAppend(&rotamersArray, siteResidue);
+  for(int j = 0; j < StructureGetChainCount(&model); j++){
+    Chain* pChain = StructureGetChain(&model, j);
+    for(int k = 0; k < ChainGetResidueCount(pChain); k++){
+      if(j == siteChain && k == siteResidue) continue;
+      Residue* pResidue = ChainGetResidue(pChain, k);
+      if(AtomArrayCalcMinDistance(&pSite->atoms, &pResidue->atoms) < VDW_DISTANCE_CUTOFF){
+        ProteinSiteBuildWildtypeRotamers(&model, j, k, pTask->rotlib, pTask->atomParams, pTask->resiTopos);
+        ProteinSiteAddCrystalRotamer(&model, j, k, pTask->resiTopos);
+        IntArrayAppend(&rotamersArray, j);
+        IntArrayAppend(&rotamersArray, k);
+      }
+    }
+  }
+  for(int ii = 0; ii < IntArrayGetLength(&rotamersArray); ii += 2){
+    ResidueDetach(ChainGetResidue(StructureGetChain(&model, IntArrayGet(&rotamersArray, ii)), IntArrayGet(&rotamersArray, ii+1)));
+  }
+
+  for(int aa = 0; aa < SATURATION_AMINO_ACID_NUM; aa++){
+    int resultIndex = SATURATION_AMINO_ACID_NUM*index+aa;
+    double* energyTerms = pTask->energyTerms+MAX_EVOEF_ENERGY_TERM_NUM*resultIndex;
+    if(SATURATION_AMINO_ACIDS[aa] == wildtype){
+      EnergyGraphGetBindingEnergy(pTask->pGraph, energyTerms);
+      pTask->results[resultIndex] = Success;
+      continue;
+    }
+    // the site and the shell start from the wild-type conformation for every amino acid
+    for(int ii = 0; ii < IntArrayGetLength(&rotamersArray); ii += 2){
+      int chainIndex = IntArrayGet(&rotamersArray, ii);
+      int resiIndex = IntArrayGet(&rotamersArray, ii+1);
+      Residue* pResidue = ChainGetResidue(StructureGetChain(&model, chainIndex), resiIndex);
+      Type_ResidueDesignType designSiteType = pResidue->designSiteType;
+      ResidueCopy(pResidue, ChainGetResidue(StructureGetChain(pTask->pStructure, chainIndex), resiIndex));
+      ResidueSetDesignSiteFlag(pResidue, designSiteType);
+    }
+    char mutaatype[MAX_LENGTH_RESIDUE_NAME];
+    OneLetterAAToThreeLetterAA(SATURATION_AMINO_ACIDS[aa], mutaatype);
+    StringArray designType, patchType;
+    StringArrayCreate(&designType);
+    StringArrayCreate(&patchType);
+    StringArrayAppend(&designType, mutaatype); StringArrayAppend(&patchType, "");
+    if(SATURATION_AMINO_ACIDS[aa] == 'H'){StringArrayAppend(&designType, "HSE"); StringArrayAppend(&patchType, "");}
+    ProteinSiteBuildMutatedRotamers(&model, siteChain, siteResidue, pTask->rotlib, pTask->atomParams, pTask->resiTopos, &designType, &patchType);
+    StringArrayDestroy(&designType);
+    StringArrayDestroy(&patchType);
+    EvoEF_PackRotamers(&model, &rotamersArray, FALSE);
+    pTask->results[resultIndex] = EnergyGraphComputeModelBinding(pTask->pGraph, &model, energyTerms, NULL);
+  }
+
+  IntArrayDestroy(&rotamersArray);
+  StructureDeleteRotamers(&model);
+  StructureDestroy(&model);
+  return Success;
+}
+
+// binding ddG of all 20 amino acids at every site against the given (repaired) wild-type complex. the sites are read
+// from the site file as wild-type amino acid, chain and position (e.g. "QA22;"), all interface sites are scanned when
+// no file is given. the sites are scanned in parallel and the ddG matrix is printed with one row per amino acid
+int EvoEF_ScanSaturation(Structure* pStructure, char* sitefile, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos){
+  IntArray sites;
+  IntArrayCreate(&sites, 0);
+  if(sitefile == NULL){
+    EvoEF_FindInterfaceSites(pStructure, &sites);
+  }
+  else{
+    int result = EvoEF_ReadSiteFile(pStructure, sitefile, &sites);
+    if(FAILED(result)){
+      IntArrayDestroy(&sites);
+      return result;
+    }
+  }
+  int siteCount = IntArrayGetLength(&sites)/2;
+  if(siteCount == 0){
+    printf("There is no site to scan\n");
+    IntArrayDestroy(&sites);
+    return DataNotExistError;
+  }
+
+  EnergyGraph graph;
+  EnergyGraphCreate(&graph);
+  EnergyGraphBuild(&graph, pStructure);
+  double energyTermsWT[MAX_EVOEF_ENERGY_TERM_NUM];
+  EnergyGraphGetBindingEnergy(&graph, energyTermsWT);
+  EnergyOutputWrite("binding", energyTermsWT);
+  printf("wild-type binding energy %8.3f, %d sites to scan\n", energyTermsWT[0], siteCount);
+
+  SaturationScanTask task;
+  task.pStructure = pStructure;
+  task.pGraph = &graph;
+  task.sites = (int*)malloc(sizeof(int)*2*siteCount);
+  for(int i = 0; i < 2*siteCount; i++) task.sites[i] = IntArrayGet(&sites, i);
+  task.rotlib = rotlib;
+  task.atomParams = atomParams;
+  task.resiTopos = resiTopos;
+  task.energyTerms = (double*)malloc(sizeof(double)*MAX_EVOEF_ENERGY_TERM_NUM*SATURATION_AMINO_ACID_NUM*siteCount);
+  task.results = (int*)malloc(sizeof(int)*SATURATION_AMINO_ACID_NUM*siteCount);
+  ThreadPoolRun(siteCount, SaturationScanTaskRun, &task);
+
+  char* siteNames = (char*)malloc(sizeof(char)*(MAX_LENGTH_ONE_LINE_IN_FILE+1)*siteCount);
+  for(int s = 0; s < siteCount; s++){
+    Chain* pChain = StructureGetChain(pStructure, task.sites[2*s]);
+    Residue* pResidue = ChainGetResidue(pChain, task.sites[2*s+1]);
+    sprintf(siteNames+(MAX_LENGTH_ONE_LINE_IN_FILE+1)*s, "%c%s%d", ThreeLetterAAToOneLetterAA(ResidueGetName(pResidue)), ChainGetName(pChain), ResidueGetPosInChain(pResidue));
+  }
+  printf("ddG matrix:\n%-4s", "aa");
+  for(int s = 0; s < siteCount; s++) printf(" %8s", siteNames+(MAX_LENGTH_ONE_LINE_IN_FILE+1)*s);
+  printf("\n");
+  for(int aa = 0; aa < SATURATION_AMINO_ACID_NUM; aa++){
+    printf("%-4c", SATURATION_AMINO_ACIDS[aa]);
+    for(int s = 0; s < siteCount; s++){
+      int resultIndex = SATURATION_AMINO_ACID_NUM*s+aa;
+      if(FAILED(task.results[resultIndex])) printf(" %8s", "NA");
+      else printf(" %8.3f", task.energyTerms[MAX_EVOEF_ENERGY_TERM_NUM*resultIndex]-energyTermsWT[0]);
+    }
+    printf("\n");
+  }
+  // the records of the substitutions are written site by site, named as single mutants
+  for(int s = 0; s < siteCount; s++){
+    for(int aa = 0; aa < SATURATION_AMINO_ACID_NUM; aa++){
+      int resultIndex = SATURATION_AMINO_ACID_NUM*s+aa;
+      char* siteName = siteNames+(MAX_LENGTH_ONE_LINE_IN_FILE+1)*s;
+      if(FAILED(task.results[resultIndex]) || siteName[0] == SATURATION_AMINO_ACIDS[aa]) continue;
+      char mutantName[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+      sprintf(mutantName, "%s%c", siteName, SATURATION_AMINO_ACIDS[aa]);
+      EnergyOutputSetStructureName(mutantName);
+      EnergyOutputWrite("binding", task.energyTerms+MAX_EVOEF_ENERGY_TERM_NUM*resultIndex);
+    }
+  }
+
+  free(siteNames);
+  free(task.sites);
+  free(task.energyTerms);
+  free(task.results);
+  EnergyGraphDestroy(&graph);
+  IntArrayDestroy(&sites);
+  return Success;
+}
+
+
+// repair one residue: flip the amide and imidazole groups, rotate the hydroxyl groups and optimize the side chain
+// locally. without candidates the surrounding residues are searched in the whole structure
+int EvoEF_RepairResidue(Structure* pStructure, int chainIndex, int resiIndex, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos, Residue** ppCandidates, int candidateNum){
+  Residue* pResi = ChainGetResidue(StructureGetChain(pStructure, chainIndex), resiIndex);
+  //skip CYS which may form disulfide bonds
+  if(strcmp(ResidueGetName(pResi),"CYS")==0) return Success;
+  if(strcmp(ResidueGetName(pResi),"ASN")==0||strcmp(ResidueGetName(pResi),"GLN")==0||strcmp(ResidueGetName(pResi),"HSD")==0||strcmp(ResidueGetName(pResi),"HSE")==0){
+    ProteinSiteAddCrystalRotamer(pStructure,chainIndex,resiIndex,resiTopos);
+    ProteinSiteBuildFlippedCrystalRotamer(pStructure,chainIndex,resiIndex,resiTopos);
+    ProteinSiteOptimizeRotamerHBondEnergyAmongCandidates(pStructure,chainIndex,resiIndex,ppCandidates,candidateNum);
+  }
+  else if(strcmp(ResidueGetName(pResi),"SER")==0 || strcmp(ResidueGetName(pResi),"THR")==0 || strcmp(ResidueGetName(pResi),"TYR")==0){
+    ProteinSiteAddCrystalRotamer(pStructure,chainIndex,resiIndex,resiTopos);
+    ProteinSiteExpandHydroxylRotamers(pStructure,chainIndex,resiIndex,resiTopos);
+    ProteinSiteOptimizeRotamerHBondEnergyAmongCandidates(pStructure,chainIndex,resiIndex,ppCandidates,candidateNum);
+  }
+  ProteinSiteBuildWildtypeRotamers(pStructure,chainIndex,resiIndex,rotlib,atomParams,resiTopos);
+  ProteinSiteAddCrystalRotamer(pStructure,chainIndex,resiIndex,resiTopos);
+  ProteinSiteExpandHydroxylRotamers(pStructure,chainIndex,resiIndex,resiTopos);
+  ProteinSiteOptimizeRotamerLocallyAmongCandidates(pStructure,chainIndex,resiIndex,1.0,ppCandidates,candidateNum);
+  ProteinSiteDeleteRotamers(pStructure,chainIndex,resiIndex);
+  return Success;
+}
+
+int EvoEF_ShowRepairResidue(Residue* pResi){
+  if(strcmp(ResidueGetName(pResi),"CYS")==0) return Success;
+  if(strcmp(ResidueGetName(pResi),"ASN")==0||strcmp(ResidueGetName(pResi),"GLN")==0||strcmp(ResidueGetName(pResi),"HSD")==0||strcmp(ResidueGetName(pResi),"HSE")==0){
+    printf("We will flip residue %s%d%c to optimize hbond\n", ResidueGetChainName(pResi),ResidueGetPosInChain(pResi),ThreeLetterAAToOneLetterAA(ResidueGetName(pResi)));
+  }
+  else if(strcmp(ResidueGetName(pResi),"SER")==0 || strcmp(ResidueGetName(pResi),"THR")==0 || strcmp(ResidueGetName(pResi),"TYR")==0){
+    printf("We will rotate hydroxyl group of residue %s%d%c to optimize hbond\n", ResidueGetChainName(pResi),ResidueGetPosInChain(pResi),ThreeLetterAAToOneLetterAA(ResidueGetName(pResi)));
+  }
+  printf("We optimize side chain of residue %s%d%c\n", ResidueGetChainName(pResi),ResidueGetPosInChain(pResi),ThreeLetterAAToOneLetterAA(ResidueGetName(pResi)));
+  return Success;
+}
+
+BOOL EvoEF_RepairResidueMoved(Residue* pBefore, Residue* pAfter){
+  if(strcmp(ResidueGetName(pBefore), ResidueGetName(pAfter)) != 0) return TRUE;
+  if(ResidueGetAtomCount(pBefore) != ResidueGetAtomCount(pAfter)) return TRUE;
+  for(int i = 0; i < ResidueGetAtomCount(pBefore); i++){
+    if(XYZDistance(&ResidueGetAtom(pBefore, i)->xyz, &ResidueGetAtom(pAfter, i)->xyz) > REPAIR_CONVERGENCE_DISTANCE) return TRUE;
+  }
+  return FALSE;
+}
+
+// one task per residue of a batch. the residues of a batch are farther apart than the contact cutoff, so a task only
+// reads the residues in contact with its own residue, which no other task of the batch changes
+typedef struct _RepairTask{
+  Structure* pStructure;      // 4/8 bytes
+  RotamerLib* rotlib;         // 4/8 bytes
+  AtomParamsSet* atomParams;  // 4/8 bytes
+  ResiTopoSet* resiTopos;     // 4/8 bytes
+  CellList* pCellList;        // 4/8 bytes, all residues in chain order
+  IntArray* contacts;         // 4/8 bytes, cell list indexes of the residues in contact with every residue
+  int* batch;                 // 4/8 bytes, cell list indexes of the residues of the current batch
+  BOOL* moved;                // 4/8 bytes, one per residue
+} RepairTask;
+
+int RepairTaskRun(void* pArgs, int index, int threadIndex){
+  RepairTask* pTask = (RepairTask*)pArgs;
+  int residue = pTask->batch[index];
+  IntArray* pContacts = &pTask->contacts[residue];
+  Residue** ppCandidates = (Residue**)malloc(sizeof(Residue*)*(IntArrayGetLength(pContacts)+1));
+  for(int k = 0; k < IntArrayGetLength(pContacts); k++){
+    ppCandidates[k] = CellListGetResidue(pTask->pCellList, IntArrayGet(pContacts, k));
+  }
+  // a private copy of the structure header keeps the design site counter of the tasks apart, the design site and the
+  // residue itself belong to this task only
+  Structure structure = *pTask->pStructure;
+  Residue* pResi = CellListGetResidue(pTask->pCellList, residue);
+  Residue original;
+  ResidueCreate(&original);
+  ResidueCopy(&original, pResi);
+  EvoEF_RepairResidue(&structure, CellListGetChainIndex(pTask->pCellList, residue), CellListGetResidueIndex(pTask->pCellList, residue),
+    pTask->rotlib, pTask->atomParams, pTask->resiTopos, ppCandidates, IntArrayGetLength(pContacts));
+  pTask->moved[residue] = EvoEF_RepairResidueMoved(&original, pResi);
+  ResidueDestroy(&original);
+  free(ppCandidates);
+  return Success;
+}
+
+// repair the residues in scope in batches that are optimized concurrently. the contact graph of the residues is colored
+// greedily in chain order and every color is a batch. the cycles are repeated until no residue moves, a cycle after
+// the first one repairs only the residues in scope that moved or have a contact that moved
+int EvoEF_RepairInBatches(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos, BOOL* inScope){
+  CellList cellList;
+  IntArray neighbors;
+  CellListCreate(&cellList);
+  IntArrayCreate(&neighbors, 0);
+  CellListBuild(&cellList, pStructure, -1, VDW_DISTANCE_CUTOFF+REPAIR_CONTACT_MARGIN);
+  int residueNum = CellListGetResidueCount(&cellList);
+  IntArray* contacts = (IntArray*)malloc(sizeof(IntArray)*(residueNum+1));
+  for(int i = 0; i < residueNum; i++) IntArrayCreate(&contacts[i], 0);
+  int* colors = (int*)malloc(sizeof(int)*(residueNum+1));
+  int* usedBy = (int*)malloc(sizeof(int)*(residueNum+1));
+  int* batch = (int*)malloc(sizeof(int)*(residueNum+1));
+  BOOL* active = (BOOL*)malloc(sizeof(BOOL)*(residueNum+1));
+  BOOL* moved = (BOOL*)malloc(sizeof(BOOL)*(residueNum+1));
+  for(int i = 0; i < residueNum; i++) active[i] = inScope[i];
+
+  RepairTask task;
+  task.pStructure = pStructure;
+  task.rotlib = rotlib;
+  task.atomParams = atomParams;
+  task.resiTopos = resiTopos;
+  task.pCellList = &cellList;
+  task.contacts = contacts;
+  task.batch = batch;
+  task.moved = moved;
+
+  for(int cycle = 0; cycle < REPAIR_MAX_CYCLE_NUM; cycle++){
+    // the side chains moved in the last cycle, so the contacts are searched again
+    if(cycle > 0) CellListBuild(&cellList, pStructure, -1, VDW_DISTANCE_CUTOFF+REPAIR_CONTACT_MARGIN);
+    for(int i = 0; i < residueNum; i++){
+      Residue* pResi = CellListGetResidue(&cellList, i);
+      IntArrayResize(&contacts[i], 0);
+      CellListGetAllNeighbors(&cellList, i, &neighbors);
+      for(int n = 0; n < IntArrayGetLength(&neighbors); n++){
+        int neighbor = IntArrayGet(&neighbors, n);
+        if(AtomArrayCalcMinDistance(&pResi->atoms, &CellListGetResidue(&cellList, neighbor)->atoms) < VDW_DISTANCE_CUTOFF+REPAIR_CONTACT_MARGIN){
+          IntArrayAppend(&contacts[i], neighbor);
         }
-        else if(strcmp(ResidueGetName(pResi),"SER")==0 || strcmp(ResidueGetName(pResi),"THR")==0 || strcmp(ResidueGetName(pResi),"TYR")==0){
-          printf("We will rotate hydroxyl group of residue %s%d%c to optimize hbond\n", ResidueGetChainName(pResi),ResidueGetPosInChain(pResi),ThreeLetterAAToOneLetterAA(ResidueGetName(pResi)));
-          ProteinSiteAddCrystalRotamer(pStructure,i,j,resiTopos);
-          ProteinSiteExpandHydroxylRotamers(pStructure,i,j,resiTopos);
-          ProteinSiteOptimizeRotamerHBondEnergy(pStructure,i,j);
+      }
+    }
+    int colorNum = 0;
+    int activeNum = 0;
+    for(int i = 0; i < residueNum; i++) usedBy[i] = -1;
+    for(int i = 0; i < residueNum; i++){
+      colors[i] = -1;
+      if(!active[i]) continue;
+      activeNum++;
+      for(int n = 0; n < IntArrayGetLength(&contacts[i]); n++){
+        int neighbor = IntArrayGet(&contacts[i], n);
+        if(neighbor < i && colors[neighbor] >= 0) usedBy[colors[neighbor]] = i;
+      }
+      int color = 0;
+      while(usedBy[color] == i) color++;
+      colors[i] = color;
+      if(color+1 > colorNum) colorNum = color+1;
+    }
+    printf("EvoEF Repairing PDB: optimization cycle %d, %d residues in %d batches ...\n", cycle+1, activeNum, colorNum);
+
+    for(int i = 0; i < residueNum; i++) moved[i] = FALSE;
+    for(int color = 0; color < colorNum; color++){
+      int batchNum = 0;
+      for(int i = 0; i < residueNum; i++){
+        if(colors[i] != color) continue;
+        batch[batchNum++] = i;
+        EvoEF_ShowRepairResidue(CellListGetResidue(&cellList, i));
+      }
+      ThreadPoolRun(batchNum, RepairTaskRun, &task);
+    }
+
+    int movedNum = 0;
+    for(int i = 0; i < residueNum; i++){
+      active[i] = moved[i];
+      if(moved[i]) movedNum++;
+    }
+    for(int i = 0; i < residueNum; i++){
+      if(!moved[i]) continue;
+      for(int n = 0; n < IntArrayGetLength(&contacts[i]); n++){
+        int neighbor = IntArrayGet(&contacts[i], n);
+        if(inScope[neighbor]) active[neighbor] = TRUE;
+      }
+    }
+    printf("EvoEF Repairing PDB: %d residues moved in cycle %d\n", movedNum, cycle+1);
+    if(movedNum == 0) break;
+  }
+
+  for(int i = 0; i < residueNum; i++) IntArrayDestroy(&contacts[i]);
+  free(contacts);
+  free(colors);
+  free(usedBy);
+  free(batch);
+  free(active);
+  free(moved);
+  IntArrayDestroy(&neighbors);
+  CellListDestroy(&cellList);
+  return Success;
+}
+
+// scopestr is all, interface:<distance> or sites:<mutant file>:<distance>
+int EvoEF_ParseRepairScope(char* scopestr, RepairScope* pScope){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  char* distancestr = strrchr(scopestr, ':');
+  pScope->type = Type_RepairScope_All;
+  pScope->siteFile[0] = '\0';
+  pScope->distance = 0.0;
+  if(strcmp(scopestr, "all") == 0) return Success;
+  if(strncmp(scopestr, "interface:", 10) == 0 && distancestr == scopestr+9){
+    pScope->type = Type_RepairScope_Interface;
+  }
+  else if(strncmp(scopestr, "sites:", 6) == 0 && distancestr > scopestr+6 && distancestr-scopestr-6 <= MAX_LENGTH_ONE_LINE_IN_FILE){
+    pScope->type = Type_RepairScope_Sites;
+    strncpy(pScope->siteFile, scopestr+6, distancestr-scopestr-6);
+    pScope->siteFile[distancestr-scopestr-6] = '\0';
+  }
+  else{
+    sprintf(usrMsg, "in file %s function %s() line %d, unknown repair scope %s, use all, interface:<distance> or sites:<mutant file>:<distance>", __FILE__, __FUNCTION__, __LINE__, scopestr);
+    TraceError(usrMsg, ValueError);
+    return ValueError;
+  }
+  char* end = NULL;
+  pScope->distance = strtod(distancestr+1, &end);
+  if(end == distancestr+1 || *end != '\0' || pScope->distance <= 0.0){
+    sprintf(usrMsg, "in file %s function %s() line %d, the distance of repair scope %s must be a positive number of angstroms", __FILE__, __FUNCTION__, __LINE__, scopestr);
+    TraceError(usrMsg, ValueError);
+    return ValueError;
+  }
+  return Success;
+}
+
+// mark the residues in scope, one flag per residue in chain order. a residue is in scope when one of its atoms is
+// within the distance of an atom of another chain, or of a site. the sites themselves are in scope as well
+int EvoEF_FindRepairScope(Structure* pStructure, RepairScope* pScope, BOOL* inScope){
+  if(pScope->type == Type_RepairScope_All){
+    int index = 0;
+    for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+      for(int j = 0; j < ChainGetResidueCount(StructureGetChain(pStructure, i)); j++) inScope[index++] = TRUE;
+    }
+    return Success;
+  }
+  CellList cellList;
+  CellListCreate(&cellList);
+  CellListBuild(&cellList, pStructure, -1, pScope->distance);
+  int residueNum = CellListGetResidueCount(&cellList);
+  for(int i = 0; i < residueNum; i++) inScope[i] = FALSE;
+
+  // a site is marked in isSite by its cell list index
+  BOOL* isSite = (BOOL*)malloc(sizeof(BOOL)*(residueNum+1));
+  for(int i = 0; i < residueNum; i++) isSite[i] = FALSE;
+  if(pScope->type == Type_RepairScope_Sites){
+    IntArray sites;
+    IntArrayCreate(&sites, 0);
+    int result = EvoEF_ReadSiteFile(pStructure, pScope->siteFile, &sites);
+    if(FAILED(result)){
+      IntArrayDestroy(&sites);
+      free(isSite);
+      CellListDestroy(&cellList);
+      return result;
+    }
+    for(int s = 0; s < IntArrayGetLength(&sites)/2; s++){
+      for(int i = 0; i < residueNum; i++){
+        if(CellListGetChainIndex(&cellList, i) == IntArrayGet(&sites, 2*s) && CellListGetResidueIndex(&cellList, i) == IntArrayGet(&sites, 2*s+1)){
+          isSite[i] = TRUE;
+          inScope[i] = TRUE;
         }
-        if(TRUE){
-          printf("We optimize side chain of residue %s%d%c\n", ResidueGetChainName(pResi),ResidueGetPosInChain(pResi),ThreeLetterAAToOneLetterAA(ResidueGetName(pResi)));
-          ProteinSiteBuildWildtypeRotamers(pStructure,i,j,rotlib,atomParams,resiTopos);
-          ProteinSiteAddCrystalRotamer(pStructure,i,j,resiTopos);
-          ProteinSiteExpandHydroxylRotamers(pStructure,i,j,resiTopos);
-          //ProteinSiteOptimizeRotamer(pStructure,i,j);
-          ProteinSiteOptimizeRotamerLocally(pStructure,i,j, 1.0);
+      }
+    }
+    IntArrayDestroy(&sites);
+  }
+
+  IntArray neighbors;
+  IntArrayCreate(&neighbors, 0);
+  for(int i = 0; i < residueNum; i++){
+    if(inScope[i] && pScope->type == Type_RepairScope_Sites) continue;
+    Residue* pResidue = CellListGetResidue(&cellList, i);
+    CellListGetAllNeighbors(&cellList, i, &neighbors);
+    for(int n = 0; n < IntArrayGetLength(&neighbors); n++){
+      int neighbor = IntArrayGet(&neighbors, n);
+      if(pScope->type == Type_RepairScope_Interface && CellListGetChainIndex(&cellList, neighbor) == CellListGetChainIndex(&cellList, i)) continue;
+      if(pScope->type == Type_RepairScope_Sites && !isSite[neighbor]) continue;
+      if(AtomArrayCalcMinDistance(&pResidue->atoms, &CellListGetResidue(&cellList, neighbor)->atoms) < pScope->distance){
+        inScope[i] = TRUE;
+        break;
+      }
+    }
+  }
+  IntArrayDestroy(&neighbors);
+  free(isSite);
+  CellListDestroy(&cellList);
+  return Success;
+}
+
+int EvoEF_RepairPDB(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid, BOOL inBatches, RepairScope* pScope){
+  int residueNum = 0;
+  for(int i=0; i<StructureGetChainCount(pStructure); ++i) residueNum += ChainGetResidueCount(StructureGetChain(pStructure, i));
+  BOOL* inScope = (BOOL*)malloc(sizeof(BOOL)*(residueNum+1));
+  RepairScope scopeAll;
+  if(pScope == NULL){
+    scopeAll.type = Type_RepairScope_All;
+    scopeAll.siteFile[0] = '\0';
+    scopeAll.distance = 0.0;
+    pScope = &scopeAll;
+  }
+  int result = EvoEF_FindRepairScope(pStructure, pScope, inScope);
+  if(FAILED(result)){
+    free(inScope);
+    return result;
+  }
+  int scopeNum = 0;
+  for(int i = 0; i < residueNum; i++) if(inScope[i]) scopeNum++;
+  if(pScope->type != Type_RepairScope_All) printf("EvoEF Repairing PDB: %d of %d residues in the repair scope\n", scopeNum, residueNum);
+
+  StructureInitializeDesignSites(pStructure);
+  if(inBatches){
+    EvoEF_RepairInBatches(pStructure, rotlib, atomParams, resiTopos, inScope);
+  }
+  else{
+    for(int cycle=0; cycle<1; cycle++){
+      printf("EvoEF Repairing PDB: optimization cycle %d ...\n",cycle+1);
+      int index = 0;
+      for(int i=0; i<StructureGetChainCount(pStructure); ++i){
+        Chain* pChain = StructureGetChain(pStructure, i);
+        for(int j=0; j<ChainGetResidueCount(pChain); j++){
+          if(!inScope[index++]) continue;
+          EvoEF_ShowRepairResidue(ChainGetResidue(pChain, j));
+          EvoEF_RepairResidue(pStructure, i, j, rotlib, atomParams, resiTopos, NULL, 0);
         }
-        ProteinSiteDeleteRotamers(pStructure,i,j);
       }
     }
   }
+  free(inScope);
 
   //output the repaired structure
   char modelfile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
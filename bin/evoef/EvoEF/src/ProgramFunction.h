@@ -22,17 +22,69 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Structure.h"
 #include "EnergyFunction.h"
 #include "EnergyComputation.h"
+#include "EnergyTable.h"
+#include "EnergyGraph.h"
+#include "EnergyMatrix.h"
+#include "BondSeparation.h"
+#include "EnergyOutput.h"
+#include "StructureCache.h"
 
+// all amino acids of a saturation scan, in the order of the rows of the ddG matrix
+#define SATURATION_AMINO_ACIDS      "ACDEFGHIKLMNPQRSTVWY"
+#define SATURATION_AMINO_ACID_NUM   20
+
+// residues closer than the vdw cutoff plus this margin are never repaired in the same batch, so that the side-chain
+// moves within a batch do not bring two of its residues into contact
+#define REPAIR_CONTACT_MARGIN       2.0
+// a batched repair stops when no residue moves farther than this, or after REPAIR_MAX_CYCLE_NUM cycles
+#define REPAIR_CONVERGENCE_DISTANCE 0.01
+#define REPAIR_MAX_CYCLE_NUM        5
+
+// CheckEnergyMatrix: the number of sites and packings, and the largest deviation of an energy change per unit of it
+#define ENERGY_MATRIX_CHECK_SITE_NUM    16
+#define ENERGY_MATRIX_CHECK_PACKING_NUM 8
+#define ENERGY_MATRIX_CHECK_TOLERANCE   1e-6
+
+// the residues repaired by RepairStructure: all of them, those within a distance of another chain, or those within a
+// distance of the sites listed in a mutant file
+typedef enum _Type_RepairScope{
+  Type_RepairScope_All,
+  Type_RepairScope_Interface,
+  Type_RepairScope_Sites
+} Type_RepairScope;
+
+typedef struct _RepairScope{
+  Type_RepairScope type;                        // 4 bytes
+  char siteFile[MAX_LENGTH_ONE_LINE_IN_FILE+1]; // 1025 bytes
+  double distance;                              // 8 bytes
+} RepairScope;
 
 int EvoEF_help();
 int EvoEF_version();
 int EvoEF_interface();
 BOOL CheckCommandName(char* queryname);
 
+int EvoEF_ComputeStructureStability(Structure *pStructure, double *energyTerms);
 int EvoEF_Stability(Structure *pStructure, double *energyTerms);
+int EvoEF_ShowBindingEnergy(double *energyTerms);
 int EvoEF_AnalyseComplex(Structure *pStructure, double *energyTerms);
+int EvoEF_ComputeWildtypeBinding(Structure *pStructure, double *energyTerms);
+int EvoEF_AnalyseInterface(Structure *pStructure, double *energyTerms);
+int EvoEF_ComputeModelBinding(Structure* pStructure, char* modelfile, AtomParamsSet* atomParams, ResiTopoSet* resiTopos);
+int EvoEF_ReadMutantFile(char* mutantfile, StringArray** pMutants, int* pMutantCount);
+int EvoEF_PackRotamers(Structure* pStructure, IntArray* pSites, BOOL showProgress);
+int EvoEF_CheckEnergyMatrix(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos);
+int EvoEF_BuildOneMutant(Structure* pStructure, StringArray* pMutant, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, int mutantIndex, BOOL showProgress);
 int EvoEF_BuildModel(Structure* pStructure, char* mutantfile, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid);
-int EvoEF_RepairPDB(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid);
+int EvoEF_ComputeBindingDDG(Structure* pStructure, char* mutantfile, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos);
+int EvoEF_FindInterfaceSites(Structure* pStructure, IntArray* pSites);
+int EvoEF_ReadSiteFile(Structure* pStructure, char* sitefile, IntArray* pSites);
+int EvoEF_ScanSaturation(Structure* pStructure, char* sitefile, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos);
+int EvoEF_RepairResidue(Structure* pStructure, int chainIndex, int resiIndex, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos, Residue** ppCandidates, int candidateNum);
+int EvoEF_RepairInBatches(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos, BOOL* inScope);
+int EvoEF_ParseRepairScope(char* scopestr, RepairScope* pScope);
+int EvoEF_FindRepairScope(Structure* pStructure, RepairScope* pScope, BOOL* inScope);
+int EvoEF_RepairPDB(Structure* pStructure, RotamerLib* rotlib, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid, BOOL inBatches, RepairScope* pScope);
 int EvoEF_WriteStructureToFile(Structure* pStructure, char* pdbfile);
 int EvoEF_AddHydrogens(Structure* pStructure, char* pdbid);
 int EvoEF_OptimizeHydrogen(Structure* pStructure, AtomParamsSet* atomParams,ResiTopoSet* resiTopos, char* pdbid);
@@ -31,10 +31,20 @@ int ResidueCreate(Residue* pThis){
   BondSetCreate(&pThis->bonds);
   pThis->resiTerm = Type_ResidueIsNotTerminal;
   pThis->nCbIn8A = 0;
+  pThis->isShared = FALSE;
   return Success;
 }
 
 int ResidueDestroy(Residue* pThis){
+  // a shared residue only drops its references, the data is freed with the structure it was shared from
+  if(pThis->isShared){
+    BondSetCreate(&pThis->bonds);
+    AtomArrayCreate(&pThis->atoms);
+    pThis->patches.strings = NULL;
+    pThis->patches.stringCount = pThis->patches.capacity = 0;
+    pThis->isShared = FALSE;
+    return Success;
+  }
   BondSetDestroy(&pThis->bonds);
   AtomArrayDestroy(&pThis->atoms);
   StringArrayDestroy(&pThis->patches);
@@ -57,6 +67,21 @@ int ResidueCopy(Residue* pThis, Residue* pOther){
   return Success;
 }
 
+// gives a shared residue its own copy of the atoms, bonds and patches before it is modified
+int ResidueDetach(Residue* pThis){
+  if(!pThis->isShared) return Success;
+  Residue shared = *pThis;
+  AtomArrayCreate(&pThis->atoms);
+  AtomArrayCopy(&pThis->atoms, &shared.atoms);
+  BondSetCreate(&pThis->bonds);
+  BondSetCopy(&pThis->bonds, &shared.bonds);
+  pThis->patches.strings = NULL;
+  pThis->patches.stringCount = 0;
+  StringArrayCopy(&pThis->patches, &shared.patches);
+  pThis->isShared = FALSE;
+  return Success;
+}
+
 char* ResidueGetName(Residue* pThis){
   return pThis->name;
 }
@@ -173,6 +198,15 @@ Atom* ResidueGetAtomByName(Residue* pThis, char* atomName){
   }
 }
 
+// H-bond partners of an atom of this residue, without string comparison once the atom array is resolved
+Atom* ResidueGetHbDorBAtom(Residue* pThis, Atom* pAtom){
+  return AtomArrayGetHbDorB(&pThis->atoms, pAtom);
+}
+
+Atom* ResidueGetHbB2Atom(Residue* pThis, Atom* pAtom){
+  return AtomArrayGetHbB2(&pThis->atoms, pAtom);
+}
+
 int ResidueFindAtom(Residue* pThis, char* atomName, int* pIndex){
   return AtomArrayFind(&pThis->atoms, atomName, pIndex);
 }
@@ -203,7 +237,8 @@ int ResidueInsertAtom(Residue* pThis, int newIndex, Atom* pNewAtom){
     return AtomArrayInsert(&pThis->atoms, newIndex, pNewAtom);
   }
   else{
-    return AtomCopy(ResidueGetAtom(pThis, index), pNewAtom);
+    AtomCopy(ResidueGetAtom(pThis, index), pNewAtom);
+    return AtomArrayResolveHBondPartners(&pThis->atoms);
   }
 }
 
@@ -214,7 +249,8 @@ int ResidueAddAtom(Residue* pThis, Atom* pNewAtom){
     return AtomArrayAppend(&pThis->atoms, pNewAtom);
   }else
   {
-    return AtomCopy(ResidueGetAtom(pThis, index), pNewAtom);
+    AtomCopy(ResidueGetAtom(pThis, index), pNewAtom);
+    return AtomArrayResolveHBondPartners(&pThis->atoms);
   }
 }
 
@@ -253,7 +289,8 @@ int ResidueAddAtomsFromAtomParams(Residue* pThis, AtomParamsSet* pAtomParams){
     }
     AtomDestroy(&newAtom);
   }
-  return Success;
+  // existing atoms were overwritten by the parameters in place
+  return AtomArrayResolveHBondPartners(&pThis->atoms);
 }
 
 int ResidueDeleteAtom(Residue* pThis, char* atomName){
@@ -77,11 +77,13 @@ typedef struct _Residue{
   Type_ResidueIsTerminal resiTerm;         //4 bytes
   Type_ResidueDesignType designSiteType;   //4 bytes
   int optrotindex;                         //4 bytes
+  BOOL isShared;                           //1 byte, atoms, bonds and patches belong to the structure of a snapshot
 } Residue;
 
 int ResidueCreate(Residue* pThis);
 int ResidueDestroy(Residue* pThis);
 int ResidueCopy(Residue* pThis, Residue* pOther);
+int ResidueDetach(Residue* pThis);
 char* ResidueGetName(Residue* pThis);
 int ResidueSetName(Residue* pThis, char* newName);
 char* ResidueGetChainName(Residue* pThis);
@@ -94,6 +96,8 @@ int ResidueGetPolarity(Residue* pThis, Type_ResiduePolarity* pPolarity);
 int ResidueGetAtomCount(Residue* pThis);
 Atom* ResidueGetAtom(Residue* pThis, int index);
 Atom* ResidueGetAtomByName(Residue* pThis, char* atomName);
+Atom* ResidueGetHbDorBAtom(Residue* pThis, Atom* pAtom);
+Atom* ResidueGetHbB2Atom(Residue* pThis, Atom* pAtom);
 int ResidueFindAtom(Residue* pThis, char* atomName, int* pIndex);
 int ResidueGetAtomXYZ(Residue* pThis, char* atomName, XYZ* pXYZ);
 AtomArray* ResidueGetAllAtoms(Residue* pThis);
@@ -0,0 +1,123 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "ResiduePack.h"
+#include <stdlib.h>
+
+int ResiduePackCreate(ResiduePack* pThis){
+  pThis->pResidue = NULL;
+  pThis->X = pThis->Y = pThis->Z = NULL;
+  pThis->radius = pThis->epsilon = pThis->charge = NULL;
+  pThis->volume = pThis->lamda = pThis->freeDG = NULL;
+  pThis->energyType = NULL;
+  pThis->isPolar = pThis->isHydrogen = pThis->isBBAtom = NULL;
+  pThis->isHBatomH = pThis->isHBatomA = NULL;
+  pThis->atomNum = 0;
+  pThis->capacity = 0;
+  return Success;
+}
+
+int ResiduePackDestroy(ResiduePack* pThis){
+  free(pThis->X);
+  free(pThis->Y);
+  free(pThis->Z);
+  free(pThis->radius);
+  free(pThis->epsilon);
+  free(pThis->charge);
+  free(pThis->volume);
+  free(pThis->lamda);
+  free(pThis->freeDG);
+  free(pThis->energyType);
+  free(pThis->isPolar);
+  free(pThis->isHydrogen);
+  free(pThis->isBBAtom);
+  free(pThis->isHBatomH);
+  free(pThis->isHBatomA);
+  ResiduePackCreate(pThis);
+  return Success;
+}
+
+int ResiduePackBuild(ResiduePack* pThis, Residue* pResidue){
+  int atomNum = ResidueGetAtomCount(pResidue);
+  if(atomNum > pThis->capacity){
+    ResiduePackDestroy(pThis);
+    pThis->X = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->Y = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->Z = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->radius = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->epsilon = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->charge = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->volume = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->lamda = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->freeDG = (EvoReal*)malloc(sizeof(EvoReal)*atomNum);
+    pThis->energyType = (int*)malloc(sizeof(int)*atomNum);
+    pThis->isPolar = (BOOL*)malloc(sizeof(BOOL)*atomNum);
+    pThis->isHydrogen = (BOOL*)malloc(sizeof(BOOL)*atomNum);
+    pThis->isBBAtom = (BOOL*)malloc(sizeof(BOOL)*atomNum);
+    pThis->isHBatomH = (BOOL*)malloc(sizeof(BOOL)*atomNum);
+    pThis->isHBatomA = (BOOL*)malloc(sizeof(BOOL)*atomNum);
+    pThis->capacity = atomNum;
+  }
+  pThis->pResidue = pResidue;
+  pThis->atomNum = atomNum;
+  for(int i = 0; i < atomNum; i++){
+    Atom* pAtom = ResidueGetAtom(pResidue, i);
+    pThis->X[i] = pAtom->xyz.X;
+    pThis->Y[i] = pAtom->xyz.Y;
+    pThis->Z[i] = pAtom->xyz.Z;
+    pThis->radius[i] = pAtom->CHARMM_radius;
+    pThis->epsilon[i] = pAtom->CHARMM_epsilon;
+    pThis->charge[i] = pAtom->CHARMM_charge;
+    pThis->volume[i] = pAtom->EEF1_volume;
+    pThis->lamda[i] = pAtom->EEF1_lamda_;
+    pThis->freeDG[i] = pAtom->EEF1_freeDG;
+    pThis->energyType[i] = pAtom->energyType;
+    pThis->isPolar[i] = (pAtom->polarity == Type_AtomPolarity_P || pAtom->polarity == Type_AtomPolarity_C) ? TRUE : FALSE;
+    pThis->isHydrogen[i] = AtomIsHydrogen(pAtom);
+    pThis->isBBAtom[i] = pAtom->isBBAtom;
+    pThis->isHBatomH[i] = pAtom->isHBatomH;
+    pThis->isHBatomA[i] = pAtom->isHBatomA;
+  }
+  return Success;
+}
+
+int ResiduePackGetAtomCount(ResiduePack* pThis){
+  return pThis->atomNum;
+}
+
+Residue* ResiduePackGetResidue(ResiduePack* pThis){
+  return pThis->pResidue;
+}
+
+// packs of several residues that do not move while they are used, e.g. the fixed residues around a design site
+int ResiduePackArrayBuild(ResiduePack** ppPacks, Residue** ppResidues, int residueNum){
+  ResiduePack* pPacks = (ResiduePack*)malloc(sizeof(ResiduePack)*(residueNum+1));
+  for(int i = 0; i < residueNum; i++){
+    ResiduePackCreate(&pPacks[i]);
+    ResiduePackBuild(&pPacks[i], ppResidues[i]);
+  }
+  *ppPacks = pPacks;
+  return Success;
+}
+
+int ResiduePackArrayDestroy(ResiduePack* pPacks, int residueNum){
+  if(pPacks == NULL) return Success;
+  for(int i = 0; i < residueNum; i++) ResiduePackDestroy(&pPacks[i]);
+  free(pPacks);
+  return Success;
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef RESIDUE_PACK_H
+#define RESIDUE_PACK_H
+
+#include "Residue.h"
+
+// number of atoms screened at once by the packed energy kernel
+#define RESIDUE_PACK_BLOCK_SIZE    64
+
+// structure-of-arrays copy of the atom data used by the non-hbond energy terms,
+// it must be rebuilt whenever the coordinates of the residue change
+typedef struct _ResiduePack{
+  Residue* pResidue;     // 4/8 bytes
+  EvoReal* X;            // 4/8 bytes
+  EvoReal* Y;            // 4/8 bytes
+  EvoReal* Z;            // 4/8 bytes
+  EvoReal* radius;       // 4/8 bytes, CHARMM radius
+  EvoReal* epsilon;      // 4/8 bytes, CHARMM epsilon
+  EvoReal* charge;       // 4/8 bytes, CHARMM charge
+  EvoReal* volume;       // 4/8 bytes, EEF1 volume
+  EvoReal* lamda;        // 4/8 bytes, EEF1 lamda
+  EvoReal* freeDG;       // 4/8 bytes, EEF1 free dG
+  int* energyType;       // 4/8 bytes, index into the energy tables
+  BOOL* isPolar;         // 4/8 bytes, polar or charged atoms contribute to deslvP
+  BOOL* isHydrogen;      // 4/8 bytes
+  BOOL* isBBAtom;        // 4/8 bytes
+  BOOL* isHBatomH;       // 4/8 bytes
+  BOOL* isHBatomA;       // 4/8 bytes
+  int atomNum;           // 4 bytes
+  int capacity;          // 4 bytes
+} ResiduePack;
+
+int ResiduePackCreate(ResiduePack* pThis);
+int ResiduePackDestroy(ResiduePack* pThis);
+int ResiduePackBuild(ResiduePack* pThis, Residue* pResidue);
+int ResiduePackGetAtomCount(ResiduePack* pThis);
+Residue* ResiduePackGetResidue(ResiduePack* pThis);
+int ResiduePackArrayBuild(ResiduePack** ppPacks, Residue** ppResidues, int residueNum);
+int ResiduePackArrayDestroy(ResiduePack* pPacks, int residueNum);
+
+#endif // RESIDUE_PACK_H
@@ -319,6 +319,7 @@ int ResidueTopologyCreate(ResidueTopology* pThis){
   BondSetCreate(&pThis->bonds);
   pThis->icCount = 0;
   pThis->ics = NULL;
+  pThis->isPatch = FALSE;
   return Success;
 }
 
@@ -351,6 +352,7 @@ int ResidueTopologyCreateFromFileReader(ResidueTopology* pThis, FileReader* pFil
           return errorCode;
         }
         residueNameAlreadySet = TRUE;
+        pThis->isPatch = strcmp(keyword, "PRES")==0;
       }
     }
     else if(strcmp(keyword, "ATOM")==0){
@@ -447,6 +449,7 @@ int ResidueTopologyCopy(ResidueTopology* pThis, ResidueTopology* pOther){
   StringArrayCopy(&pThis->deletes, &pOther->deletes);
   BondSetCopy(&pThis->bonds, &pOther->bonds);
   pThis->icCount = pOther->icCount;
+  pThis->isPatch = pOther->isPatch;
   pThis->ics = (CharmmIC*)malloc(sizeof(CharmmIC)*pThis->icCount);
   for(int i=0;i<pThis->icCount;i++){
     CharmmICCreate(&pThis->ics[i]);
@@ -483,6 +486,10 @@ BondSet* ResidueTopologyGetBonds(ResidueTopology* pThis){
   return &pThis->bonds;
 }
 
+BOOL ResidueTopologyIsPatch(ResidueTopology* pThis){
+  return pThis->isPatch;
+}
+
 int ResidueTopologyGetCharmmICCount(ResidueTopology* pThis){
   return pThis->icCount;
 }
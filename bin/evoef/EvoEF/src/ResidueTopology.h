@@ -90,6 +90,7 @@ typedef struct _ResidueTopology{
   CharmmIC* ics;                               //4-8 bytes
   char residueName[MAX_LENGTH_RESIDUE_NAME+1]; //6 bytes
   int icCount;                                 //4 bytes
+  BOOL isPatch;                                //1 byte, declared by PRES
 } ResidueTopology;
 
 int ResidueTopologyCreate(ResidueTopology* pThis);
@@ -103,6 +104,7 @@ int ResidueTopologySetName(ResidueTopology* pThis, char* newName);
 StringArray* ResidueTopologyGetAtoms(ResidueTopology* pThis);
 StringArray* ResidueTopologyGetDeletes(ResidueTopology* pThis);
 BondSet* ResidueTopologyGetBonds(ResidueTopology* pThis);
+BOOL ResidueTopologyIsPatch(ResidueTopology* pThis);
 
 int ResidueTopologyGetCharmmICCount(ResidueTopology* pThis);
 int ResidueTopologyGetCharmmIC(ResidueTopology* pThis, int index, CharmmIC* pDestIC);
@@ -17,6 +17,7 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 ********************************************************************************************************************************/
 
 #include "Rotamer.h"
+#include "Profiler.h"
 #include <string.h>
 #include <ctype.h>
 
@@ -55,12 +56,14 @@ Type_ProteinAtomOrder Type_ProteinAtomOrder_JudgedByAtomName(char* atomName){
 }
 
 int RotamerLibCreate(RotamerLib* pThis,char* rotlibFile){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_ParameterLoad);
   FileReader file;
   int result = FileReaderCreate(&file, rotlibFile);
   if(FAILED(result)){
     char errMsg[MAX_LENGTH_ONE_LINE_IN_FILE+1];
     sprintf(errMsg,"in file %s function %s line %d, cannot open rotamer library file %s", __FILE__,__FUNCTION__,__LINE__,rotlibFile);
     TraceError(errMsg,result);
+    ProfilerEnd(Type_ProfilePhase_ParameterLoad, profileStart);
     return result;
   }
 
@@ -78,6 +81,7 @@ int RotamerLibCreate(RotamerLib* pThis,char* rotlibFile){
       int result = FormatError;
       sprintf(errMsg,"In file %s function %s line %d,when reading file %s, Residue name %s is too long:\n%s",__FILE__,__FUNCTION__,__LINE__,rotlibFile,resiTypeName,line);
       TraceError(errMsg,result);
+      ProfilerEnd(Type_ProfilePhase_ParameterLoad, profileStart);
       return result;
     }
     int pos;
@@ -123,6 +127,7 @@ int RotamerLibCreate(RotamerLib* pThis,char* rotlibFile){
   }
 
   FileReaderDestroy(&file);
+  ProfilerEnd(Type_ProfilePhase_ParameterLoad, profileStart);
   return Success;
 }
 int RotamerLibDestroy(RotamerLib* pThis){
@@ -215,7 +220,16 @@ int RotamerCopy(Rotamer* pThis,Rotamer* pOther){
   strcpy(pThis->chainName,pOther->chainName);
   pThis->posInChain = pOther->posInChain;
   AtomArrayCopy(&pThis->atoms,&pOther->atoms);
-  XYZArrayCopy(&pThis->xyzs,&pOther->xyzs);
+  if(AtomArrayGetCount(&pOther->atoms) > 0 && AtomArrayGetCount(&pOther->atoms) != XYZArrayGetLength(&pOther->xyzs)){
+    // a restored rotamer of a set keeps only its side-chain coordinates, the copy gets one coordinate per atom
+    XYZArrayResize(&pThis->xyzs,AtomArrayGetCount(&pOther->atoms));
+    for(int i=0;i<AtomArrayGetCount(&pOther->atoms);i++){
+      XYZArraySet(&pThis->xyzs,i,&AtomArrayGet(&pOther->atoms,i)->xyz);
+    }
+  }
+  else{
+    XYZArrayCopy(&pThis->xyzs,&pOther->xyzs);
+  }
   BondSetCopy(&pThis->bonds,&pOther->bonds);
   return Success;
 }
@@ -336,6 +350,12 @@ BondSet* RotamerGetBonds(Rotamer* pThis){
   return &pThis->bonds;
 }
 
+// the backbone atoms and CB are placed identically for all the rotamers of one type at one site, so the
+// rotamers of a set leave them to the representative
+BOOL RotamerIsSharedAtom(Atom* pAtom){
+  return (pAtom->isBBAtom || strcmp(AtomGetName(pAtom),"CB")==0) ? TRUE : FALSE;
+}
+
 int RotamerExtract(Rotamer* pThis){
   AtomArrayDestroy(&pThis->atoms);
   AtomArrayCreate(&pThis->atoms);
@@ -347,7 +367,7 @@ int RotamerExtract(Rotamer* pThis){
 int RotamerRestore(Rotamer* pThis,RotamerSet* pRotamerSet){
   int result;
   char errMsg[MAX_LENGTH_ERR_MSG+1];
-  if( AtomArrayGetCount(&pThis->atoms) == XYZArrayGetLength(&pThis->xyzs) ){
+  if( AtomArrayGetCount(&pThis->atoms) > 0 ){
     return Success;
   }
   Rotamer* pRepresentative = NULL;
@@ -366,16 +386,44 @@ int RotamerRestore(Rotamer* pThis,RotamerSet* pRotamerSet){
   // Restore atoms and bonds
   AtomArrayCopy(&pThis->atoms,&pRepresentative->atoms);
   BondSetCopy(&pThis->bonds,&pRepresentative->bonds);
-  if( AtomArrayGetCount(&pThis->atoms) != XYZArrayGetLength(&pThis->xyzs)){
+  return RotamerPlaceAtoms(pThis,pRepresentative,&pThis->atoms);
+}
+
+// places an extracted rotamer in pAtoms, which holds the atoms of its representative in the same order. the rotamer
+// and the representative are only read, so several threads may place the rotamers of one set at a time
+int RotamerPlaceAtoms(Rotamer* pThis,Rotamer* pRepresentative,AtomArray* pAtoms){
+  int result;
+  char errMsg[MAX_LENGTH_ERR_MSG+1];
+  int atomCount = AtomArrayGetCount(pAtoms);
+  if( XYZArrayGetLength(&pThis->xyzs) == atomCount ){
+    // Copy atom XYZ from Xyzs
+    for(int i=0;i<atomCount;i++){
+      AtomArrayGet(pAtoms,i)->xyz = *XYZArrayGet(&pThis->xyzs,i);
+    }
+    return Success;
+  }
+  // Xyzs holds the side-chain atoms only, the shared atoms are placed as in the representative
+  int sideChainIndex = 0;
+  for(int i=0;i<atomCount;i++){
+    Atom* pAtom = AtomArrayGet(pAtoms,i);
+    if(RotamerIsSharedAtom(pAtom)){
+      pAtom->xyz = *XYZArrayGet(&pRepresentative->xyzs,i);
+    }
+    else if(sideChainIndex < XYZArrayGetLength(&pThis->xyzs)){
+      pAtom->xyz = *XYZArrayGet(&pThis->xyzs,sideChainIndex);
+      sideChainIndex++;
+    }
+    else{
+      sideChainIndex = -1;
+      break;
+    }
+  }
+  if( sideChainIndex != XYZArrayGetLength(&pThis->xyzs) ){
     result = ValueError;
-    sprintf(errMsg,"In file %s function %s line %d, atom count of Rotamer (%d) does not equal to the atom count of the representative Rotamer(%d)\n",__FILE__,__FUNCTION__,__LINE__,XYZArrayGetLength(&pThis->xyzs),AtomArrayGetCount(&pThis->atoms));
+    sprintf(errMsg,"In file %s function %s line %d, atom count of Rotamer (%d) does not equal to the atom count of the representative Rotamer(%d)\n",__FILE__,__FUNCTION__,__LINE__,XYZArrayGetLength(&pThis->xyzs),atomCount);
     TraceError(errMsg,result);
     return result;
   }
-  // Copy atom XYZ from Xyzs
-  for(int i=0;i<AtomArrayGetCount(&pThis->atoms);i++){
-    AtomArrayGet(&pThis->atoms,i)->xyz = *XYZArrayGet(&pThis->xyzs,i);
-  }
 
   return Success;
 }
@@ -1104,14 +1152,47 @@ Rotamer* RotamerSetGetRepresentativeByIndex(RotamerSet* pThis,int index){
 
 
 int RotamerSetAdd(RotamerSet* pThis,Rotamer* pNewRotamer){
+  if(RotamerSetGetRepresentative(pThis,pNewRotamer->type) == NULL){
+    (pThis->representativeCount)++;
+    pThis->representatives = (Rotamer*)realloc(pThis->representatives,sizeof(Rotamer)* pThis->representativeCount);
+    RotamerCreate(&pThis->representatives[pThis->representativeCount-1]);
+    RotamerCopy(&pThis->representatives[pThis->representativeCount-1],pNewRotamer);
+  }
+  Rotamer* pRepresentative = RotamerSetGetRepresentative(pThis,pNewRotamer->type);
   Rotamer* pNewlyAddedRotInTheSet = &pThis->rotamers[pThis->count];
 
-  // For the newly added rotamer, record only the atom coordinates
-  RotamerCopy(pNewlyAddedRotInTheSet,pNewRotamer);
-  AtomArrayDestroy(&pNewlyAddedRotInTheSet->atoms);
-  AtomArrayCreate(&pNewlyAddedRotInTheSet->atoms);
-  BondSetDestroy(&pNewlyAddedRotInTheSet->bonds);
-  BondSetCreate(&pNewlyAddedRotInTheSet->bonds);
+  // For the newly added rotamer, record only the atom coordinates, the atoms and bonds are kept by the representative
+  strcpy(pNewlyAddedRotInTheSet->type,pNewRotamer->type);
+  strcpy(pNewlyAddedRotInTheSet->chainName,pNewRotamer->chainName);
+  pNewlyAddedRotInTheSet->posInChain = pNewRotamer->posInChain;
+  int atomCount = AtomArrayGetCount(&pRepresentative->atoms);
+  BOOL sideChainOnly = XYZArrayGetLength(&pNewRotamer->xyzs) == atomCount ? TRUE : FALSE;
+  int sideChainAtomCount = 0;
+  for(int i=0;i<atomCount && sideChainOnly;i++){
+    if(!RotamerIsSharedAtom(AtomArrayGet(&pRepresentative->atoms,i))){
+      sideChainAtomCount++;
+      continue;
+    }
+    XYZ* pXYZ = XYZArrayGet(&pNewRotamer->xyzs,i);
+    XYZ* pSharedXYZ = XYZArrayGet(&pRepresentative->xyzs,i);
+    if(pXYZ->X != pSharedXYZ->X || pXYZ->Y != pSharedXYZ->Y || pXYZ->Z != pSharedXYZ->Z){
+      sideChainOnly = FALSE;
+    }
+  }
+  if(sideChainOnly){
+    XYZArrayResize(&pNewlyAddedRotInTheSet->xyzs,sideChainAtomCount);
+    sideChainAtomCount = 0;
+    for(int i=0;i<atomCount;i++){
+      if(!RotamerIsSharedAtom(AtomArrayGet(&pRepresentative->atoms,i))){
+        XYZArraySet(&pNewlyAddedRotInTheSet->xyzs,sideChainAtomCount,XYZArrayGet(&pNewRotamer->xyzs,i));
+        sideChainAtomCount++;
+      }
+    }
+  }
+  else{
+    // the shared atoms are placed differently from the representative, keep all the coordinates
+    XYZArrayCopy(&pNewlyAddedRotInTheSet->xyzs,&pNewRotamer->xyzs);
+  }
 
   (pThis->count)++;
   if(pThis->count == pThis->capacity){
@@ -1122,13 +1203,177 @@ int RotamerSetAdd(RotamerSet* pThis,Rotamer* pNewRotamer){
     pThis->capacity*=2;
   }
 
-  if(RotamerSetGetRepresentative(pThis,pNewRotamer->type) == NULL){
-    (pThis->representativeCount)++;
-    pThis->representatives = (Rotamer*)realloc(pThis->representatives,sizeof(Rotamer)* pThis->representativeCount);
-    RotamerCreate(&pThis->representatives[pThis->representativeCount-1]);
-    RotamerCopy(&pThis->representatives[pThis->representativeCount-1],pNewRotamer);
+  return Success;
+}
+
+
+int RotamerBuildProgramCreate(RotamerBuildProgram* pThis){
+  pThis->steps = NULL;
+  pThis->stepCount = 0;
+  pThis->atomCount = 0;
+  pThis->torsionCount = 0;
+  return Success;
+}
+
+int RotamerBuildProgramDestroy(RotamerBuildProgram* pThis){
+  free(pThis->steps);
+  return RotamerBuildProgramCreate(pThis);
+}
+
+// compiles the steps of RotamerOfProteinCalcXYZ() for the rotamers of the template's type that follow the template,
+// i.e. the atoms of the torsions first, then the other side-chain atoms in the order ResidueCalcAllAtomXYZ() finds
+// them. the backbone atoms and CB are kept from the template. DataNotExistError is returned without a trace when an
+// atom cannot be placed this way, the caller then builds the rotamers one by one as before
+int RotamerBuildProgramCompile(RotamerBuildProgram* pThis, Rotamer* pTemplate, Residue* pResi, char* patchName, int torsionCount, ResiTopoSet* resiTopos){
+  RotamerBuildProgramDestroy(pThis);
+  int atomCount = AtomArrayGetCount(&pTemplate->atoms);
+  int topoIndex, patchIndex = -1;
+  if(FAILED(ResiTopoCollectionGetIndex(resiTopos, RotamerGetType(pTemplate), &topoIndex))) return DataNotExistError;
+  if(patchName != NULL && strcmp(patchName, "") != 0 && FAILED(ResiTopoCollectionGetIndex(resiTopos, patchName, &patchIndex))) return DataNotExistError;
+  ResidueTopology* pTopo = &resiTopos->topos[topoIndex];
+  pThis->atomCount = atomCount;
+  pThis->torsionCount = torsionCount > 5 ? 5 : torsionCount;
+  // every atom is placed at most once after the torsion atoms and the two HT atoms of an N-terminal proline
+  pThis->steps = (RotamerBuildStep*)malloc(sizeof(RotamerBuildStep)*(pThis->torsionCount+2+atomCount));
+  BOOL* valid = (BOOL*)malloc(sizeof(BOOL)*(atomCount+1));
+  for(int i=0; i<atomCount; i++){
+    Atom* pAtom = AtomArrayGet(&pTemplate->atoms, i);
+    valid[i] = (pAtom->isBBAtom || strcmp(pAtom->name, "CB") == 0) && pAtom->isXyzValid;
+  }
+
+  int result = Success;
+  // the atoms directly determined by the torsions
+  for(int torsionIndex=0; torsionIndex<pThis->torsionCount && !FAILED(result); torsionIndex++){
+    CharmmIC* pIC = NULL;
+    for(int icIndex=0; icIndex<pTopo->icCount; icIndex++){
+      if(Type_ProteinAtomOrder_JudgedByAtomName(CharmmICGetAtomB(&pTopo->ics[icIndex])) == Type_ProteinAtomOrder_FromInt(torsionIndex) &&
+        Type_ProteinAtomOrder_JudgedByAtomName(CharmmICGetAtomC(&pTopo->ics[icIndex])) == Type_ProteinAtomOrder_FromInt(torsionIndex+1)){
+        pIC = &pTopo->ics[icIndex];
+        break;
+      }
+    }
+    RotamerBuildStep* pStep = &pThis->steps[pThis->stepCount];
+    result = DataNotExistError;
+    if(pIC == NULL) break;
+    for(int i=0; i<4; i++){
+      if(FAILED(AtomArrayFind(&pTemplate->atoms, pIC->atomNames[i], &pStep->atomIndices[i]))) break;
+      if(i < 3 && !valid[pStep->atomIndices[i]]) break;
+      if(i == 3) result = Success;
+    }
+    if(FAILED(result)) break;
+    memcpy(pStep->icParam, pIC->icParam, sizeof(pStep->icParam));
+    pStep->torsionIndex = torsionIndex;
+    pStep->torsionFlipped = strcmp(RotamerGetType(pTemplate), "TRP") == 0 && torsionIndex == 1;
+    valid[pStep->atomIndices[3]] = TRUE;
+    pThis->stepCount++;
+  }
+
+  // the hydrogens of an N-terminal proline
+  if(!FAILED(result) && strcmp(RotamerGetType(pTemplate), "PRO") == 0 && pResi->resiTerm == Type_ResidueIsNter){
+    char* hydrogens[2] = {"HT1", "HT2"};
+    for(int h=0; h<2 && !FAILED(result); h++){
+      RotamerBuildStep* pStep = &pThis->steps[pThis->stepCount];
+      if(FAILED(AtomArrayFind(&pTemplate->atoms, "CA", &pStep->atomIndices[0])) || FAILED(AtomArrayFind(&pTemplate->atoms, "CD", &pStep->atomIndices[1])) ||
+        FAILED(AtomArrayFind(&pTemplate->atoms, "N", &pStep->atomIndices[2])) || FAILED(AtomArrayFind(&pTemplate->atoms, hydrogens[h], &pStep->atomIndices[3]))){
+        result = DataNotExistError;
+        break;
+      }
+      pStep->icParam[0] = 0.0; pStep->icParam[1] = 0.0; pStep->icParam[2] = DegToRad(h == 0 ? 120.0 : -120.0); pStep->icParam[3] = DegToRad(109.5); pStep->icParam[4] = 1.04;
+      pStep->torsionIndex = -1;
+      pStep->torsionFlipped = FALSE;
+      valid[pStep->atomIndices[3]] = TRUE;
+      pThis->stepCount++;
+    }
   }
-  
+
+  // the other atoms, the patch ICs take precedence over the ICs of the residue
+  BOOL done = FAILED(result);
+  while(!done){
+    done = TRUE;
+    for(int i=0; i<atomCount; i++){
+      if(valid[i]) continue;
+      char* atomName = AtomGetName(AtomArrayGet(&pTemplate->atoms, i));
+      int icIndex;
+      CharmmIC* pIC = NULL;
+      if(patchIndex != -1 && !FAILED(ResidueTopologyFindCharmmICIndex(&resiTopos->topos[patchIndex], atomName, &icIndex))){
+        pIC = &resiTopos->topos[patchIndex].ics[icIndex];
+      }
+      else if(!FAILED(ResidueTopologyFindCharmmICIndex(pTopo, atomName, &icIndex))){
+        pIC = &pTopo->ics[icIndex];
+      }
+      if(pIC == NULL) continue;
+      RotamerBuildStep* pStep = &pThis->steps[pThis->stepCount];
+      BOOL placeable = TRUE;
+      for(int j=0; j<3 && placeable; j++){
+        // atoms of the neighbor residues are not available to a rotamer
+        placeable = pIC->atomNames[j][0] != '-' && pIC->atomNames[j][0] != '+' &&
+          !FAILED(AtomArrayFind(&pTemplate->atoms, pIC->atomNames[j], &pStep->atomIndices[j])) && valid[pStep->atomIndices[j]];
+      }
+      if(!placeable) continue;
+      pStep->atomIndices[3] = i;
+      memcpy(pStep->icParam, pIC->icParam, sizeof(pStep->icParam));
+      pStep->torsionIndex = -1;
+      pStep->torsionFlipped = FALSE;
+      valid[i] = TRUE;
+      pThis->stepCount++;
+      done = FALSE;
+    }
+  }
+  for(int i=0; i<atomCount && !FAILED(result); i++){
+    if(!valid[i]) result = DataNotExistError;
+  }
+  free(valid);
+  if(FAILED(result)) RotamerBuildProgramDestroy(pThis);
+  return result;
+}
+
+// builds the rotamers with the given torsions from the template and adds them to the set. the coordinates of all
+// rotamers are kept as one block of X, Y and Z per atom, and every step places its atom in all rotamers at once
+int RotamerBuildProgramRun(RotamerBuildProgram* pThis, Rotamer* pTemplate, DoubleArray* torsions, int rotamerCount, RotamerSet* pRotamerSet){
+  if(rotamerCount <= 0) return Success;
+  int blockSize = 3*rotamerCount;
+  double* coords = (double*)malloc(sizeof(double)*blockSize*pThis->atomCount);
+  double* torsionCos = (double*)malloc(sizeof(double)*rotamerCount);
+  double* torsionSin = (double*)malloc(sizeof(double)*rotamerCount);
+  for(int i=0; i<pThis->atomCount; i++){
+    XYZ* pXYZ = &AtomArrayGet(&pTemplate->atoms, i)->xyz;
+    double* block = coords+i*blockSize;
+    for(int r=0; r<rotamerCount; r++){
+      block[r] = pXYZ->X;
+      block[rotamerCount+r] = pXYZ->Y;
+      block[2*rotamerCount+r] = pXYZ->Z;
+    }
+  }
+  for(int s=0; s<pThis->stepCount; s++){
+    RotamerBuildStep* pStep = &pThis->steps[s];
+    for(int r=0; r<rotamerCount; r++){
+      double torsion = pStep->icParam[2];
+      if(pStep->torsionIndex != -1){
+        torsion = DoubleArrayGet(&torsions[r], pStep->torsionIndex);
+        if(pStep->torsionFlipped){
+          torsion += PI;
+          if(torsion > PI) torsion -= 2.0*PI;
+        }
+      }
+      torsionCos[r] = cos(torsion);
+      torsionSin[r] = sin(torsion);
+    }
+    GetFourthAtoms(rotamerCount, coords+pStep->atomIndices[0]*blockSize, coords+pStep->atomIndices[1]*blockSize,
+      coords+pStep->atomIndices[2]*blockSize, pStep->icParam[4], pStep->icParam[3], torsionCos, torsionSin, coords+pStep->atomIndices[3]*blockSize);
+  }
+  for(int r=0; r<rotamerCount; r++){
+    for(int i=0; i<pThis->atomCount; i++){
+      double* block = coords+i*blockSize;
+      XYZ* pXYZ = XYZArrayGet(&pTemplate->xyzs, i);
+      pXYZ->X = block[r];
+      pXYZ->Y = block[rotamerCount+r];
+      pXYZ->Z = block[2*rotamerCount+r];
+    }
+    RotamerSetAdd(pRotamerSet, pTemplate);
+  }
+  free(coords);
+  free(torsionCos);
+  free(torsionSin);
   return Success;
 }
 
@@ -1156,19 +1401,35 @@ int RotamerSetOfProteinGenerate(RotamerSet* pThis, Residue* pResi, StringArray*
     }
     RotamerSetAdd(pThis,&newRot);
 
-    // for the other rotamers, just calculate the coordinates, don't have to deal with atoms and bonds again
+    // the other rotamers are built together by the program compiled from the first one if they all have the same
+    // number of torsions
+    int libIndex;
+    StringArrayFind(&rotlib->residueTypeNames,typeName,&libIndex);
+    BOOL sameTorsionCount = TRUE;
     for(int rotamerIndex=1; rotamerIndex<rotamerCount; ++rotamerIndex){
-      RotamerLibGet(rotlib,typeName,rotamerIndex,&torsions);
-      // set the coordinates of side-chain atoms to be false
-      for(int i = 0; i <RotamerGetAtomCount(&newRot); i++){
-        Atom* pAtom = RotamerGetAtom(&newRot, i);
-        if(pAtom->isBBAtom == FALSE && strcmp(pAtom->name, "CB") != 0){
-          pAtom->isXyzValid=FALSE;
+      if(DoubleArrayGetLength(&rotlib->torsions[libIndex][rotamerIndex]) != DoubleArrayGetLength(&torsions)) sameTorsionCount = FALSE;
+    }
+    RotamerBuildProgram program;
+    RotamerBuildProgramCreate(&program);
+    if(rotamerCount > 1 && sameTorsionCount && !FAILED(RotamerBuildProgramCompile(&program,&newRot,pResi,patchName,DoubleArrayGetLength(&torsions),resiTopo))){
+      RotamerBuildProgramRun(&program,&newRot,&rotlib->torsions[libIndex][1],rotamerCount-1,pThis);
+    }
+    else{
+      // for the other rotamers, just calculate the coordinates, don't have to deal with atoms and bonds again
+      for(int rotamerIndex=1; rotamerIndex<rotamerCount; ++rotamerIndex){
+        RotamerLibGet(rotlib,typeName,rotamerIndex,&torsions);
+        // set the coordinates of side-chain atoms to be false
+        for(int i = 0; i <RotamerGetAtomCount(&newRot); i++){
+          Atom* pAtom = RotamerGetAtom(&newRot, i);
+          if(pAtom->isBBAtom == FALSE && strcmp(pAtom->name, "CB") != 0){
+            pAtom->isXyzValid=FALSE;
+          }
         }
+        RotamerOfProteinCalcXYZ(&newRot, pResi, patchName, &torsions, resiTopo);
+        RotamerSetAdd(pThis, &newRot);
       }
-      RotamerOfProteinCalcXYZ(&newRot, pResi, patchName, &torsions, resiTopo);
-      RotamerSetAdd(pThis, &newRot);
     }
+    RotamerBuildProgramDestroy(&program);
     RotamerDestroy(&newRot);
     DoubleArrayDestroy(&torsions);
     
@@ -36,6 +36,9 @@ int RotamerLibShow(RotamerLib* pThis);
 int RotamerLibTester(char* rotlibFile);
 
 
+// a rotamer stored in a RotamerSet is extracted: its atoms and bonds are left to the representative of its type
+// and xyzs holds only the coordinates of the atoms that are not shared by the rotamers of the type (see
+// RotamerIsSharedAtom()), RotamerRestore() rebuilds the full rotamer
 typedef struct _Rotamer{
   AtomArray atoms;                         //8-12 bytes
   BondSet bonds;                           //8-12 bytes
@@ -105,8 +108,32 @@ int RotamerSetAdd(RotamerSet* pThis,Rotamer* pNewRotamer);
 int RotamerSetOfProteinGenerate(RotamerSet* pThis,Residue* pResi, StringArray* designTypes, StringArray* patchTypes, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopo);
 int RotamerSetShow(RotamerSet* pThis,FILE* pFile);
 
+// one step of a side-chain build program, atom D of the rotamer is placed from its atoms A, B and C
+typedef struct _RotamerBuildStep{
+  int atomIndices[4];     // 16 bytes, indices of atoms A, B, C and D in the rotamer
+  double icParam[5];      // 40 bytes, parameters of the CharmmIC of atom D
+  int torsionIndex;       // 4 bytes, index of the rotamer torsion used as Phi(ABCD), -1 for the torsion of the IC
+  BOOL torsionFlipped;    // 1 byte, the rotamer torsion is turned by 180 degrees (X2 of TRP)
+} RotamerBuildStep;
+
+// the coordinate calculation of RotamerOfProteinCalcXYZ() compiled into atom indices for one rotamer type on one
+// residue, so the other rotamers of the type are built without looking up topologies and atom names
+typedef struct _RotamerBuildProgram{
+  RotamerBuildStep* steps; // 4/8 bytes
+  int stepCount;           // 4 bytes
+  int atomCount;           // 4 bytes
+  int torsionCount;        // 4 bytes
+} RotamerBuildProgram;
+
+int RotamerBuildProgramCreate(RotamerBuildProgram* pThis);
+int RotamerBuildProgramDestroy(RotamerBuildProgram* pThis);
+int RotamerBuildProgramCompile(RotamerBuildProgram* pThis, Rotamer* pTemplate, Residue* pResi, char* patchName, int torsionCount, ResiTopoSet* resiTopos);
+int RotamerBuildProgramRun(RotamerBuildProgram* pThis, Rotamer* pTemplate, DoubleArray* torsions, int rotamerCount, RotamerSet* pRotamerSet);
+
+BOOL RotamerIsSharedAtom(Atom* pAtom);
 int RotamerExtract(Rotamer* pThis);
 int RotamerRestore(Rotamer* pThis,RotamerSet* pRotamerSet);
+int RotamerPlaceAtoms(Rotamer* pThis,Rotamer* pRepresentative,AtomArray* pAtoms);
 int RotamerSetGetRepresentativeCount(RotamerSet* pThis);
 Rotamer* RotamerSetGetRepresentativeByIndex(RotamerSet* pThis,int index);
 int RotamerShowBondInformation(Rotamer* pThis);
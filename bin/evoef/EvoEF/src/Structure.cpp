@@ -18,6 +18,7 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Structure.h"
 #include "EnergyFunction.h"
+#include "Profiler.h"
 #include <string.h>
 
 int StructureCreate(Structure* pThis){
@@ -39,6 +40,30 @@ int StructureDestroy(Structure* pThis){
   return Success;
 }
 
+// the snapshot has its own chains and residue headers, but the atoms, bonds and patches of all residues are shared
+// with pOther until ResidueDetach() is called on a residue. pOther must not change or be destroyed while the snapshot
+// lives, and only residues that were detached may be modified in the snapshot
+int StructureCreateSnapshot(Structure* pThis, Structure* pOther){
+  StructureCreate(pThis);
+  strcpy(pThis->name, pOther->name);
+  pThis->chainNum = pOther->chainNum;
+  pThis->chains = (Chain*)malloc(sizeof(Chain)*pThis->chainNum);
+  for(int i = 0; i < pThis->chainNum; i++){
+    Chain* pChain = &pThis->chains[i];
+    Chain* pOtherChain = &pOther->chains[i];
+    ChainCreate(pChain);
+    ChainSetName(pChain, pOtherChain->name);
+    ChainSetType(pChain, pOtherChain->type);
+    pChain->residueNum = pOtherChain->residueNum;
+    pChain->residues = (Residue*)malloc(sizeof(Residue)*pChain->residueNum);
+    memcpy(pChain->residues, pOtherChain->residues, sizeof(Residue)*pChain->residueNum);
+    for(int j = 0; j < pChain->residueNum; j++){
+      pChain->residues[j].isShared = TRUE;
+    }
+  }
+  return Success;
+}
+
 char* StructureGetName(Structure* pThis){
   return pThis->name;
 }
@@ -129,6 +154,7 @@ int StructureDeleteChain(Structure* pThis, char* chainName){
 }
 
 int StructureShowInPDBFormat(Structure* pThis, BOOL showHydrogen, FILE* pFile){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_PdbWrite);
   int atomIndex=1;
   for(int i=0;i<StructureGetChainCount(pThis);i++){
     Chain* pChain = StructureGetChain(pThis, i);
@@ -138,6 +164,7 @@ int StructureShowInPDBFormat(Structure* pThis, BOOL showHydrogen, FILE* pFile){
       atomIndex += ResidueGetAtomCount(pResi);
     }
   }
+  ProfilerEnd(Type_ProfilePhase_PdbWrite, profileStart);
   return Success;
 }
 
@@ -163,6 +190,7 @@ int StructureInitialize(Structure* pStructure, char* pdbFile, AtomParamsSet* pAt
   int chainCounter = -1;
   BOOL firstResidueInChain = TRUE;
 
+  double profileStart = ProfilerBegin(Type_ProfilePhase_PdbParse);
   FileReader file;
   if(FAILED(FileReaderCreate(&file, pdbFile))){
     char usrMsg[MAX_LENGTH_ERR_MSG+1];
@@ -238,7 +266,10 @@ int StructureInitialize(Structure* pStructure, char* pdbFile, AtomParamsSet* pAt
     }
   }
 
+  ProfilerEnd(Type_ProfilePhase_PdbParse, profileStart);
+
   // make patches to residues if needed and calculate all atom residues
+  profileStart = ProfilerBegin(Type_ProfilePhase_TopologyBuild);
   for(int i = 0; i < StructureGetChainCount(pStructure); i++){
     Chain *pChain = StructureGetChain(pStructure,i);
     Residue *pFirsResidueInChain = ChainGetResidue(pChain,0);
@@ -250,6 +281,7 @@ int StructureInitialize(Structure* pStructure, char* pdbFile, AtomParamsSet* pAt
     }
     ChainCalcAllAtomXYZ(pChain, pTopos);
   }
+  ProfilerEnd(Type_ProfilePhase_TopologyBuild, profileStart);
 
   FileReaderDestroy(&file);
   return Success;
@@ -258,8 +290,7 @@ int StructureInitialize(Structure* pStructure, char* pdbFile, AtomParamsSet* pAt
 
 
 int StructureConfig(Structure *pStructure, char* pdbFile, AtomParamsSet* pAtomParams, ResiTopoSet* pResiTopos){
-  StructureInitialize(pStructure, pdbFile, pAtomParams, pResiTopos);
-  return Success;
+  return StructureInitialize(pStructure, pdbFile, pAtomParams, pResiTopos);
 }
 
 
@@ -480,6 +511,7 @@ int StructureCheckNeighbouringBondType(Structure *pStructure){
 // functions used to deal with sidechain rotamers, sidechain repacking and protein design
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
 int ProteinSiteBuildAllRotamers(Structure* pThis, int chainIndex, int resiIndex, RotamerLib* rotlib,AtomParamsSet* atomParams,ResiTopoSet* resiTopos){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerGeneration);
   int result = Success;
   if(pThis->designSites[chainIndex][resiIndex]!=NULL){
     ProteinSiteDeleteRotamers(pThis,chainIndex,resiIndex);
@@ -522,10 +554,12 @@ int ProteinSiteBuildAllRotamers(Structure* pThis, int chainIndex, int resiIndex,
   StringArrayDestroy(&patchTypes);
   StringArrayDestroy(&designTypes);
 
+  ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
   return result;
 }
 
 int ProteinSiteBuildMutatedRotamers(Structure* pThis, int chainIndex, int resiIndex, RotamerLib* rotlib,AtomParamsSet* atomParams,ResiTopoSet* resiTopos, StringArray *pDesignTypes, StringArray *pPatchTypes){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerGeneration);
   int result = Success;
   if(pThis->designSites[chainIndex][resiIndex]!=NULL){
     ProteinSiteDeleteRotamers(pThis,chainIndex,resiIndex);
@@ -545,10 +579,12 @@ int ProteinSiteBuildMutatedRotamers(Structure* pThis, int chainIndex, int resiIn
   //StringArrayDestroy(&patchTypes);
   //StringArrayDestroy(&designTypes);
 
+  ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
   return result;
 }
 
 int ProteinSiteBuildWildtypeRotamers(Structure* pThis, int chainIndex, int resiIndex, RotamerLib* rotlib, AtomParamsSet* atomParams, ResiTopoSet* resiTopos){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerGeneration);
   int result = Success;
   if(pThis->designSites[chainIndex][resiIndex]!=NULL){
     ProteinSiteDeleteRotamers(pThis,chainIndex,resiIndex);
@@ -587,12 +623,14 @@ int ProteinSiteBuildWildtypeRotamers(Structure* pThis, int chainIndex, int resiI
   StringArrayDestroy(&patchTypes);
   StringArrayDestroy(&designTypes);
 
+  ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
   return result;
 }
 
 int ProteinSiteDeleteRotamers(Structure* pThis, int chainIndex, int resiIndex){
   if(pThis->designSites[chainIndex][resiIndex]!=NULL){
     DesignSiteDestroy(pThis->designSites[chainIndex][resiIndex]);
+    free(pThis->designSites[chainIndex][resiIndex]);
     pThis->designSites[chainIndex][resiIndex]=NULL;
   }
   (pThis->designSiteCount)--;
@@ -619,6 +657,7 @@ int ProteinSiteWriteRotamers(Structure *pStructure, int chainIndex, int resiInde
 
 // this function can be used to build crystal rotamers for every amino acid type
 int ProteinSiteAddCrystalRotamer(Structure* pThis, int chainIndex, int resiIndex, ResiTopoSet *pResiTopos){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerGeneration);
   Chain* pDestChain = StructureGetChain(pThis, chainIndex);
   Residue* pDesignResi = ChainGetResidue(pDestChain, resiIndex);
   if(pDestChain->type == Type_Chain_Protein){
@@ -739,17 +778,20 @@ int ProteinSiteAddCrystalRotamer(Structure* pThis, int chainIndex, int resiIndex
     }
   }
 
+  ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
   return Success;
 }
 
 //this function is used for build flipped rotamers for ASN/GLN/HIS, note that this function is based on the above function
 //ProteinSiteBuildCrystalRotamer(), first build crystal rotamer then flip
 int ProteinSiteBuildFlippedCrystalRotamer(Structure* pStructure, int chainIndex, int resiIndex, ResiTopoSet *pResiTopos){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerGeneration);
   Chain *pDestChain = StructureGetChain(pStructure,chainIndex);
   Residue* pDesignResi = ChainGetResidue(pDestChain, resiIndex);
   if(pDestChain->type == Type_Chain_Protein){
     if(strcmp(ResidueGetName(pDesignResi),"ASN")!=0 && strcmp(ResidueGetName(pDesignResi),"GLN")!=0 &&
       strcmp(ResidueGetName(pDesignResi),"HSD")!=0 && strcmp(ResidueGetName(pDesignResi),"HSE")!=0){
+        ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
         return Success;
     }
 
@@ -911,11 +953,13 @@ int ProteinSiteBuildFlippedCrystalRotamer(Structure* pStructure, int chainIndex,
     }
   }
 
+  ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
   return Success;
 }
 
 
 int ProteinSiteExpandHydroxylRotamers(Structure *pStructure, int chainIndex, int resiIndex, ResiTopoSet *pTopos){
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerGeneration);
   Chain* pChain=StructureGetChain(pStructure,chainIndex);
   if(pChain->type==Type_Chain_Protein){
     DesignSite *pDesignSite = StructureGetDesignSite(pStructure, chainIndex,resiIndex);
@@ -1059,6 +1103,7 @@ int ProteinSiteExpandHydroxylRotamers(Structure *pStructure, int chainIndex, int
     ResidueTopologyDestroy(&tops);
     CharmmICDestroy(&ics);
   }
+	ProfilerEnd(Type_ProfilePhase_RotamerGeneration, profileStart);
 	return Success;
 }
 
@@ -1111,6 +1156,7 @@ int StructureDeleteRotamers(Structure* pThis){
     for(int j = 0; j < resiNumChainI; j++){
       if(pThis->designSites[i][j] != NULL){
         DesignSiteDestroy(pThis->designSites[i][j]);
+        free(pThis->designSites[i][j]);
         pThis->designSites[i][j] = NULL;
       }
     }
@@ -1152,6 +1198,11 @@ int StructureComputeResidueInteractionWithFixedSurroundingResidues(Structure *pS
       }
     }
   }
+  ResiduePack* surroundingPacks = NULL;
+  ResiduePackArrayBuild(&surroundingPacks, ppSurroundingResidues, surroundingResiNum);
+  ResiduePack residuePack;
+  ResiduePackCreate(&residuePack);
+  ResiduePackBuild(&residuePack, pResIR);
   // calculate energy between residue IR and other residues
   ResidueReferenceEnergy(pResIR,energyTerms);
   EVOEF_EnergyResidueSelfEnergy(pResIR, ratio1,energyTerms);
@@ -1167,10 +1218,18 @@ int StructureComputeResidueInteractionWithFixedSurroundingResidues(Structure *pS
     }
     else{
       if(strcmp(pResIR->chainName, pResIS->chainName) == 0){
+#if ENERGY_USE_PACKED_KERNEL
+        EVOEF_EnergyPackedResidueAndOtherResidue(&residuePack,&surroundingPacks[is],ratio12,TRUE,energyTerms);
+#else
         EVOEF_EnergyResidueAndOtherResidueSameChain(pResIR,pResIS,ratio12,energyTerms);
+#endif
       }
       else{
+#if ENERGY_USE_PACKED_KERNEL
+        EVOEF_EnergyPackedResidueAndOtherResidue(&residuePack,&surroundingPacks[is],ratio12,FALSE,energyTerms);
+#else
         EVOEF_EnergyResidueAndOtherResidueDifferentChain(pResIR,pResIS,ratio12,energyTerms);
+#endif
       }
     }
   }
@@ -1249,6 +1308,9 @@ int StructureComputeResidueInteractionWithFixedSurroundingResidues(Structure *pS
     printf("Total                 =            %8.2f\n\n", energyTerms[0]);
   }
 
+  ResiduePackArrayDestroy(surroundingPacks, surroundingResiNum);
+  ResiduePackDestroy(&residuePack);
+  free(ppSurroundingResidues);
   return Success;
 }
 
@@ -1256,6 +1318,7 @@ int StructureComputeResidueInteractionWithFixedSurroundingResidues(Structure *pS
 int ProteinSiteOptimizeRotamer(Structure *pStructure, int chainIndex, int resiIndex){
   DesignSite *pDesignSite = StructureGetDesignSite(pStructure,chainIndex,resiIndex);
   if(pDesignSite==NULL) return Success;
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
   RotamerSet *pRotSet = DesignSiteGetRotamers(pDesignSite);
   Residue *pDesign = pDesignSite->pResidue;
   double *energyArrayOfRotamers = (double *)malloc(sizeof(double)*RotamerSetGetCount(pRotSet));
@@ -1279,6 +1342,11 @@ int ProteinSiteOptimizeRotamer(Structure *pStructure, int chainIndex, int resiIn
     }
   }
 
+  ResiduePack* surroundingPacks = NULL;
+  ResiduePackArrayBuild(&surroundingPacks, ppSurroundingResidues, surroundingResiNum);
+  ResiduePack rotamerPack;
+  ResiduePackCreate(&rotamerPack);
+
   // step 2: calculate the energy between the rotamers of the design site
   double minEnergy = 1000.0;
   int minEnergyRotIndex = -1;
@@ -1300,6 +1368,7 @@ int ProteinSiteOptimizeRotamer(Structure *pStructure, int chainIndex, int resiIn
     ResidueSetName(&tempResidue, pRotIR->type);
     AtomArrayCopy(&tempResidue.atoms, &pRotIR->atoms);
     BondSetCopy(&tempResidue.bonds, &pRotIR->bonds);
+    ResiduePackBuild(&rotamerPack, &tempResidue);
     double ratio1 = CalcResidueBuriedRatio(&tempResidue);
     ResidueReferenceEnergy(&tempResidue,energyTerms);
     EVOEF_EnergyResidueSelfEnergy(&tempResidue,ratio1, energyTerms);
@@ -1315,10 +1384,18 @@ int ProteinSiteOptimizeRotamer(Structure *pStructure, int chainIndex, int resiIn
       }
       else{
         if(strcmp(ResidueGetChainName(&tempResidue),ResidueGetChainName(pResIS))==0){
+#if ENERGY_USE_PACKED_KERNEL
+          EVOEF_EnergyPackedResidueAndOtherResidue(&rotamerPack,&surroundingPacks[is],ratio12,TRUE,energyTerms);
+#else
           EVOEF_EnergyResidueAndOtherResidueSameChain(&tempResidue,pResIS,ratio12,energyTerms);
+#endif
         }
         else{
+#if ENERGY_USE_PACKED_KERNEL
+          EVOEF_EnergyPackedResidueAndOtherResidue(&rotamerPack,&surroundingPacks[is],ratio12,FALSE,energyTerms);
+#else
           EVOEF_EnergyResidueAndOtherResidueDifferentChain(&tempResidue,pResIS,ratio12,energyTerms);
+#endif
         }
       }
     }
@@ -1452,15 +1529,62 @@ int ProteinSiteOptimizeRotamer(Structure *pStructure, int chainIndex, int resiIn
     free(ppSurroundingResidues);
     ppSurroundingResidues = NULL;
   }
+  ResiduePackArrayDestroy(surroundingPacks, surroundingResiNum);
+  ResiduePackDestroy(&rotamerPack);
   StringArrayDestroy(&rotTypes);
 
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
+  return Success;
+}
+
+
+// collect the residues within VDW_DISTANCE_CUTOFF of the design residue, in chain order. without candidates the whole
+// structure is searched, otherwise only the candidates, which must be given in chain order as well
+int ProteinSiteFindSurroundingResidues(Structure *pStructure, Residue *pDesign, Residue **ppCandidates, int candidateNum, Residue ***pppSurroundingResidues, int *pSurroundingResiNum){
+  int surroundingResiNum = 0;
+  Residue **ppSurroundingResidues = NULL;
+  if(ppCandidates == NULL){
+    candidateNum = 0;
+    for(int i = 0; i < pStructure->chainNum; i++) candidateNum += pStructure->chains[i].residueNum;
+  }
+  int chainIndex = 0, resiIndex = 0;
+  for(int k = 0; k < candidateNum; k++){
+    Residue *pResi2 = NULL;
+    if(ppCandidates != NULL){
+      pResi2 = ppCandidates[k];
+    }
+    else{
+      while(resiIndex >= pStructure->chains[chainIndex].residueNum){
+        chainIndex++;
+        resiIndex = 0;
+      }
+      pResi2 = pStructure->chains[chainIndex].residues + resiIndex;
+      resiIndex++;
+    }
+    if(strcmp(pDesign->name, pResi2->name) == 0 && pDesign->posInChain == pResi2->posInChain){
+      continue;
+    }
+    else if(AtomArrayCalcMinDistance(&pDesign->atoms, &pResi2->atoms)<VDW_DISTANCE_CUTOFF){
+      surroundingResiNum++;
+      ppSurroundingResidues = (Residue **)realloc(ppSurroundingResidues, sizeof(Residue*)*surroundingResiNum);
+      ppSurroundingResidues[surroundingResiNum-1] = pResi2;
+    }
+  }
+  *pppSurroundingResidues = ppSurroundingResidues;
+  *pSurroundingResiNum = surroundingResiNum;
   return Success;
 }
 
 
 int ProteinSiteOptimizeRotamerLocally(Structure *pStructure, int chainIndex, int resiIndex, double rmsdcutoff){
+  return ProteinSiteOptimizeRotamerLocallyAmongCandidates(pStructure, chainIndex, resiIndex, rmsdcutoff, NULL, 0);
+}
+
+// the surrounding residues are searched among the candidates only, see ProteinSiteFindSurroundingResidues()
+int ProteinSiteOptimizeRotamerLocallyAmongCandidates(Structure *pStructure, int chainIndex, int resiIndex, double rmsdcutoff, Residue **ppCandidates, int candidateNum){
   DesignSite *pDesignSite = StructureGetDesignSite(pStructure,chainIndex,resiIndex);
   if(pDesignSite==NULL) return Success;
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
   RotamerSet *pRotSet = DesignSiteGetRotamers(pDesignSite);
   Residue *pDesign = pDesignSite->pResidue;
   double *energyArrayOfRotamers = (double *)malloc(sizeof(double)*RotamerSetGetCount(pRotSet));
@@ -1469,25 +1593,17 @@ int ProteinSiteOptimizeRotamerLocally(Structure *pStructure, int chainIndex, int
   //step 1: find out residues within 6 angstroms to the design site of interest;
   int surroundingResiNum = 0;
   Residue **ppSurroundingResidues = NULL;
-  for(int i = 0; i < pStructure->chainNum; i++){
-    Chain *pChainI = pStructure->chains + i;
-    for(int j = 0; j < pChainI->residueNum; j++){
-      Residue *pResi2 = pChainI->residues + j;
-      if(strcmp(pDesign->name, pResi2->name) == 0 && pDesign->posInChain == pResi2->posInChain){
-        continue;
-      }
-      else if(AtomArrayCalcMinDistance(&pDesign->atoms, &pResi2->atoms)<VDW_DISTANCE_CUTOFF){
-        surroundingResiNum++;
-        ppSurroundingResidues = (Residue **)realloc(ppSurroundingResidues, sizeof(Residue*)*surroundingResiNum);
-        ppSurroundingResidues[surroundingResiNum-1] = pResi2;
-      }
-    }
-  }
+  ProteinSiteFindSurroundingResidues(pStructure, pDesign, ppCandidates, candidateNum, &ppSurroundingResidues, &surroundingResiNum);
 
   Residue original;
   ResidueCreate(&original);
   ResidueCopy(&original,pDesign);
 
+  ResiduePack* surroundingPacks = NULL;
+  ResiduePackArrayBuild(&surroundingPacks, ppSurroundingResidues, surroundingResiNum);
+  ResiduePack rotamerPack;
+  ResiduePackCreate(&rotamerPack);
+
   // step 2: calculate the energy between the rotamers of the design site
   double minEnergy = 1000.0;
   int minEnergyRotIndex = -1;
@@ -1514,6 +1630,7 @@ int ProteinSiteOptimizeRotamerLocally(Structure *pStructure, int chainIndex, int
       ResidueDestroy(&tempResidue);
       continue;
     }
+    ResiduePackBuild(&rotamerPack, &tempResidue);
     double ratio1 = CalcResidueBuriedRatio(&tempResidue);
     ResidueReferenceEnergy(&tempResidue,energyTerms);
     EVOEF_EnergyResidueSelfEnergy(&tempResidue,ratio1, energyTerms);
@@ -1529,10 +1646,18 @@ int ProteinSiteOptimizeRotamerLocally(Structure *pStructure, int chainIndex, int
       }
       else{
         if(strcmp(tempResidue.chainName, pResIS->chainName)==0){
+#if ENERGY_USE_PACKED_KERNEL
+          EVOEF_EnergyPackedResidueAndOtherResidue(&rotamerPack,&surroundingPacks[is],ratio12,TRUE,energyTerms);
+#else
           EVOEF_EnergyResidueAndOtherResidueSameChain(&tempResidue,pResIS,ratio12,energyTerms);
+#endif
         }
         else{
+#if ENERGY_USE_PACKED_KERNEL
+          EVOEF_EnergyPackedResidueAndOtherResidue(&rotamerPack,&surroundingPacks[is],ratio12,FALSE,energyTerms);
+#else
           EVOEF_EnergyResidueAndOtherResidueDifferentChain(&tempResidue,pResIS,ratio12,energyTerms);
+#endif
         }
       }
     }
@@ -1664,17 +1789,25 @@ int ProteinSiteOptimizeRotamerLocally(Structure *pStructure, int chainIndex, int
     free(ppSurroundingResidues);
     ppSurroundingResidues = NULL;
   }
+  ResiduePackArrayDestroy(surroundingPacks, surroundingResiNum);
+  ResiduePackDestroy(&rotamerPack);
   StringArrayDestroy(&rotTypes);
   ResidueDestroy(&original);
 
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
   return Success;
 }
 
 
 
 int ProteinSiteOptimizeRotamerHBondEnergy(Structure *pStructure, int chainIndex, int resiIndex){
+  return ProteinSiteOptimizeRotamerHBondEnergyAmongCandidates(pStructure, chainIndex, resiIndex, NULL, 0);
+}
+
+int ProteinSiteOptimizeRotamerHBondEnergyAmongCandidates(Structure *pStructure, int chainIndex, int resiIndex, Residue **ppCandidates, int candidateNum){
   DesignSite *pDesignSite = StructureGetDesignSite(pStructure,chainIndex,resiIndex);
   if(pDesignSite==NULL) return Success;
+  double profileStart = ProfilerBegin(Type_ProfilePhase_RotamerOptimization);
   RotamerSet *pRotSet = DesignSiteGetRotamers(pDesignSite);
   Residue *pDesign = pDesignSite->pResidue;
   double *energyArrayOfRotamers = (double *)malloc(sizeof(double)*RotamerSetGetCount(pRotSet));
@@ -1683,20 +1816,12 @@ int ProteinSiteOptimizeRotamerHBondEnergy(Structure *pStructure, int chainIndex,
   //step 1: find out residues within 5 angstroms to the design site of interest;
   int surroundingResiNum = 0;
   Residue **ppSurroundingResidues = NULL;
-  for(int i = 0; i < pStructure->chainNum; i++){
-    Chain *pChainI = pStructure->chains + i;
-    for(int j = 0; j < pChainI->residueNum; j++){
-      Residue *pResi2 = pChainI->residues + j;
-      if(strcmp(pDesign->name, pResi2->name) == 0 && pDesign->posInChain == pResi2->posInChain){
-        continue;
-      }
-      else if(AtomArrayCalcMinDistance(&pDesign->atoms, &pResi2->atoms)<VDW_DISTANCE_CUTOFF){
-        surroundingResiNum++;
-        ppSurroundingResidues = (Residue **)realloc(ppSurroundingResidues, sizeof(Residue*)*surroundingResiNum);
-        ppSurroundingResidues[surroundingResiNum-1] = pResi2;
-      }
-    }
-  }
+  ProteinSiteFindSurroundingResidues(pStructure, pDesign, ppCandidates, candidateNum, &ppSurroundingResidues, &surroundingResiNum);
+
+  ResiduePack* surroundingPacks = NULL;
+  ResiduePackArrayBuild(&surroundingPacks, ppSurroundingResidues, surroundingResiNum);
+  ResiduePack rotamerPack;
+  ResiduePackCreate(&rotamerPack);
 
   // step 2: calculate the energy between the rotamers of the design site
   double minEnergy = 1000.0;
@@ -1719,6 +1844,7 @@ int ProteinSiteOptimizeRotamerHBondEnergy(Structure *pStructure, int chainIndex,
     ResidueSetName(&tempResidue, pRotIR->type);
     AtomArrayCopy(&tempResidue.atoms, &pRotIR->atoms);
     BondSetCopy(&tempResidue.bonds, &pRotIR->bonds);
+    ResiduePackBuild(&rotamerPack, &tempResidue);
     double ratio1 = CalcResidueBuriedRatio(&tempResidue);
     ResidueReferenceEnergy(&tempResidue,energyTerms);
     EVOEF_EnergyResidueSelfEnergy(&tempResidue,ratio1, energyTerms);
@@ -1734,10 +1860,18 @@ int ProteinSiteOptimizeRotamerHBondEnergy(Structure *pStructure, int chainIndex,
       }
       else{
         if(strcmp(tempResidue.chainName, pResIS->chainName)==0){
+#if ENERGY_USE_PACKED_KERNEL
+          EVOEF_EnergyPackedResidueAndOtherResidue(&rotamerPack,&surroundingPacks[is],ratio12,TRUE,energyTerms);
+#else
           EVOEF_EnergyResidueAndOtherResidueSameChain(&tempResidue,pResIS,ratio12,energyTerms);
+#endif
         }
         else{
+#if ENERGY_USE_PACKED_KERNEL
+          EVOEF_EnergyPackedResidueAndOtherResidue(&rotamerPack,&surroundingPacks[is],ratio12,FALSE,energyTerms);
+#else
           EVOEF_EnergyResidueAndOtherResidueDifferentChain(&tempResidue,pResIS,ratio12,energyTerms);
+#endif
         }
       }
     }
@@ -1874,8 +2008,11 @@ int ProteinSiteOptimizeRotamerHBondEnergy(Structure *pStructure, int chainIndex,
     free(ppSurroundingResidues);
     ppSurroundingResidues = NULL;
   }
+  ResiduePackArrayDestroy(surroundingPacks, surroundingResiNum);
+  ResiduePackDestroy(&rotamerPack);
   StringArrayDestroy(&rotTypes);
 
+  ProfilerEnd(Type_ProfilePhase_RotamerOptimization, profileStart);
   return Success;
 }
 
@@ -39,6 +39,7 @@ typedef struct _Structure{
 
 int StructureCreate(Structure* pThis);
 int StructureDestroy(Structure* pThis);
+int StructureCreateSnapshot(Structure* pThis, Structure* pOther);
 char* StructureGetName(Structure* pThis);
 int StructureSetName(Structure* pThis, char* newName);
 int StructureGetChainCount(Structure* pThis);
@@ -80,4 +81,7 @@ int ProteinSiteBuildFlippedCrystalRotamer(Structure* pStructure, int chainIndex,
 int StructureDeleteRotamers(Structure* pThis);
 int ProteinSiteOptimizeRotamerHBondEnergy(Structure *pStructure, int chainIndex, int resiIndex);
 int ProteinSiteOptimizeRotamerLocally(Structure *pStructure, int chainIndex, int resiIndex, double rmsdcutoff);
+int ProteinSiteFindSurroundingResidues(Structure *pStructure, Residue *pDesign, Residue **ppCandidates, int candidateNum, Residue ***pppSurroundingResidues, int *pSurroundingResiNum);
+int ProteinSiteOptimizeRotamerHBondEnergyAmongCandidates(Structure *pStructure, int chainIndex, int resiIndex, Residue **ppCandidates, int candidateNum);
+int ProteinSiteOptimizeRotamerLocallyAmongCandidates(Structure *pStructure, int chainIndex, int resiIndex, double rmsdcutoff, Residue **ppCandidates, int candidateNum);
 #endif // STRUCTURE_H
@@ -0,0 +1,241 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "StructureBinary.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+int StructureBinaryWrite(Structure* pStructure, char* fileName){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  StructureBinaryHeader header;
+  memset(&header, 0, sizeof(StructureBinaryHeader));
+  strcpy(header.magic, STRUCTURE_BINARY_MAGIC);
+  header.version = STRUCTURE_BINARY_VERSION;
+  header.atomSize = sizeof(Atom);
+  header.bondSize = sizeof(Bond);
+  header.chainNum = StructureGetChainCount(pStructure);
+  strcpy(header.name, pStructure->name);
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    header.residueNum += ChainGetResidueCount(pChain);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      Residue* pResidue = ChainGetResidue(pChain, j);
+      header.atomNum += pResidue->atoms.atomNum;
+      header.bondNum += pResidue->bonds.count;
+      for(int k = 0; k < pResidue->patches.stringCount; k++) header.patchLength += (int)strlen(pResidue->patches.strings[k])+1;
+    }
+  }
+
+  FILE* pFile = fopen(fileName, "wb");
+  if(pFile == NULL){
+    sprintf(usrMsg, "in file %s function %s() line %d, cannot write file %s", __FILE__, __FUNCTION__, __LINE__, fileName);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  fwrite(&header, sizeof(StructureBinaryHeader), 1, pFile);
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    StructureBinaryChain chain;
+    memset(&chain, 0, sizeof(StructureBinaryChain));
+    strcpy(chain.name, pChain->name);
+    chain.type = pChain->type;
+    chain.residueNum = pChain->residueNum;
+    fwrite(&chain, sizeof(StructureBinaryChain), 1, pFile);
+  }
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      Residue* pResidue = ChainGetResidue(pChain, j);
+      StructureBinaryResidue residue;
+      memset(&residue, 0, sizeof(StructureBinaryResidue));
+      strcpy(residue.name, pResidue->name);
+      strcpy(residue.chainName, pResidue->chainName);
+      residue.posInChain = pResidue->posInChain;
+      residue.nCbIn8A = pResidue->nCbIn8A;
+      residue.resiTerm = pResidue->resiTerm;
+      residue.atomNum = pResidue->atoms.atomNum;
+      residue.bondNum = pResidue->bonds.count;
+      residue.patchNum = pResidue->patches.stringCount;
+      fwrite(&residue, sizeof(StructureBinaryResidue), 1, pFile);
+    }
+  }
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      Residue* pResidue = ChainGetResidue(pChain, j);
+      fwrite(pResidue->atoms.atoms, sizeof(Atom), pResidue->atoms.atomNum, pFile);
+    }
+  }
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      Residue* pResidue = ChainGetResidue(pChain, j);
+      fwrite(pResidue->bonds.bonds, sizeof(Bond), pResidue->bonds.count, pFile);
+    }
+  }
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      Residue* pResidue = ChainGetResidue(pChain, j);
+      for(int k = 0; k < pResidue->patches.stringCount; k++){
+        fwrite(pResidue->patches.strings[k], 1, strlen(pResidue->patches.strings[k])+1, pFile);
+      }
+    }
+  }
+  if(ferror(pFile) || fclose(pFile) != 0){
+    sprintf(usrMsg, "in file %s function %s() line %d, cannot write file %s", __FILE__, __FUNCTION__, __LINE__, fileName);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  return Success;
+}
+
+// maps the whole file read-only, falls back to reading it into memory where mmap() is not available
+char* StructureBinaryMapFile(char* fileName, size_t* pLength){
+#ifdef _WIN32
+  FILE* pFile = fopen(fileName, "rb");
+  if(pFile == NULL) return NULL;
+  fseek(pFile, 0, SEEK_END);
+  long length = ftell(pFile);
+  fseek(pFile, 0, SEEK_SET);
+  char* data = length > 0 ? (char*)malloc(length) : NULL;
+  if(data != NULL && fread(data, 1, length, pFile) != (size_t)length){
+    free(data);
+    data = NULL;
+  }
+  fclose(pFile);
+  *pLength = (size_t)length;
+  return data;
+#else
+  int fd = open(fileName, O_RDONLY);
+  if(fd < 0) return NULL;
+  struct stat fileStat;
+  char* data = NULL;
+  if(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0){
+    void* address = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(address != MAP_FAILED){
+      data = (char*)address;
+      *pLength = (size_t)fileStat.st_size;
+    }
+  }
+  close(fd);
+  return data;
+#endif
+}
+
+int StructureBinaryUnmapFile(char* data, size_t length){
+#ifdef _WIN32
+  free(data);
+#else
+  munmap(data, length);
+#endif
+  return Success;
+}
+
+// the structure must be empty. a missing file returns DataNotExistError, a file of another version or layout FormatError
+int StructureBinaryRead(Structure* pStructure, char* fileName){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  size_t length = 0;
+  char* data = StructureBinaryMapFile(fileName, &length);
+  if(data == NULL) return DataNotExistError;
+
+  StructureBinaryHeader header;
+  BOOL valid = length >= sizeof(StructureBinaryHeader);
+  if(valid){
+    memcpy(&header, data, sizeof(StructureBinaryHeader));
+    valid = strcmp(header.magic, STRUCTURE_BINARY_MAGIC) == 0 && header.version == STRUCTURE_BINARY_VERSION &&
+      header.atomSize == (int)sizeof(Atom) && header.bondSize == (int)sizeof(Bond) &&
+      header.chainNum >= 0 && header.residueNum >= 0 && header.atomNum >= 0 && header.bondNum >= 0 && header.patchLength >= 0 &&
+      length == sizeof(StructureBinaryHeader) + sizeof(StructureBinaryChain)*header.chainNum +
+      sizeof(StructureBinaryResidue)*header.residueNum + sizeof(Atom)*header.atomNum + sizeof(Bond)*header.bondNum + header.patchLength;
+  }
+  if(!valid){
+    StructureBinaryUnmapFile(data, length);
+    sprintf(usrMsg, "in file %s function %s() line %d, %s is not a structure file of this EvoEF build", __FILE__, __FUNCTION__, __LINE__, fileName);
+    TraceError(usrMsg, FormatError);
+    return FormatError;
+  }
+
+  StructureBinaryChain* chains = (StructureBinaryChain*)(data + sizeof(StructureBinaryHeader));
+  StructureBinaryResidue* residues = (StructureBinaryResidue*)(chains + header.chainNum);
+  char* atoms = (char*)(residues + header.residueNum);
+  char* bonds = atoms + sizeof(Atom)*header.atomNum;
+  char* patches = bonds + sizeof(Bond)*header.bondNum;
+  char* patchEnd = patches + header.patchLength;
+
+  // the counts are checked against the header before anything is allocated
+  int residueNum = 0, atomNum = 0, bondNum = 0;
+  for(int i = 0; i < header.chainNum; i++) residueNum += chains[i].residueNum;
+  for(int i = 0; i < header.residueNum && residueNum == header.residueNum; i++){
+    atomNum += residues[i].atomNum;
+    bondNum += residues[i].bondNum;
+  }
+  if(residueNum != header.residueNum || atomNum != header.atomNum || bondNum != header.bondNum){
+    StructureBinaryUnmapFile(data, length);
+    sprintf(usrMsg, "in file %s function %s() line %d, %s is corrupted", __FILE__, __FUNCTION__, __LINE__, fileName);
+    TraceError(usrMsg, FormatError);
+    return FormatError;
+  }
+
+  strcpy(pStructure->name, header.name);
+  pStructure->chainNum = header.chainNum;
+  pStructure->chains = (Chain*)malloc(sizeof(Chain)*header.chainNum);
+  int residueIndex = 0;
+  for(int i = 0; i < header.chainNum; i++){
+    Chain* pChain = &pStructure->chains[i];
+    ChainCreate(pChain);
+    ChainSetName(pChain, chains[i].name);
+    ChainSetType(pChain, chains[i].type);
+    pChain->residueNum = chains[i].residueNum;
+    pChain->residues = (Residue*)malloc(sizeof(Residue)*pChain->residueNum);
+    for(int j = 0; j < pChain->residueNum; j++){
+      StructureBinaryResidue* pRecord = &residues[residueIndex++];
+      Residue* pResidue = &pChain->residues[j];
+      ResidueCreate(pResidue);
+      strcpy(pResidue->name, pRecord->name);
+      strcpy(pResidue->chainName, pRecord->chainName);
+      pResidue->posInChain = pRecord->posInChain;
+      pResidue->nCbIn8A = pRecord->nCbIn8A;
+      pResidue->resiTerm = pRecord->resiTerm;
+      pResidue->atoms.atomNum = pRecord->atomNum;
+      pResidue->atoms.atoms = (Atom*)malloc(sizeof(Atom)*pRecord->atomNum);
+      memcpy(pResidue->atoms.atoms, atoms, sizeof(Atom)*pRecord->atomNum);
+      atoms += sizeof(Atom)*pRecord->atomNum;
+      pResidue->bonds.count = pRecord->bondNum;
+      pResidue->bonds.bonds = (Bond*)malloc(sizeof(Bond)*pRecord->bondNum);
+      memcpy(pResidue->bonds.bonds, bonds, sizeof(Bond)*pRecord->bondNum);
+      bonds += sizeof(Bond)*pRecord->bondNum;
+      for(int k = 0; k < pRecord->patchNum && patches < patchEnd; k++){
+        char* patch = patches;
+        while(patches < patchEnd && *patches != '\0') patches++;
+        if(patches == patchEnd) break;
+        StringArrayAppend(&pResidue->patches, patch);
+        patches++;
+      }
+    }
+  }
+  StructureBinaryUnmapFile(data, length);
+  return Success;
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef STRUCTURE_BINARY_H
+#define STRUCTURE_BINARY_H
+
+#include "Structure.h"
+
+// bump the version whenever a field written to the file changes
+#define STRUCTURE_BINARY_VERSION         1
+#define STRUCTURE_BINARY_MAGIC           "EVOEFSB"
+
+// binary image of a configured structure. the atoms and bonds are stored as raw records, so an image is only read back
+// by a build with the same Atom and Bond layout (e.g. not across the single-precision switch) and with the same force
+// field files; the caller is responsible for the latter, e.g. by keying the file with StructureCacheGetKey().
+// layout: header, chain records, residue records, all atoms, all bonds, all patch names ('\0'-terminated)
+typedef struct _StructureBinaryHeader{
+  char magic[8];
+  int version;
+  int atomSize;      // sizeof(Atom)
+  int bondSize;      // sizeof(Bond)
+  int chainNum;
+  int residueNum;
+  int atomNum;
+  int bondNum;
+  int patchLength;   // bytes of all patch names
+  char name[MAX_LENGTH_STRUCTURE_NAME+1];
+} StructureBinaryHeader;
+
+typedef struct _StructureBinaryChain{
+  char name[MAX_LENGTH_CHAIN_NAME+1];
+  Type_Chain type;
+  int residueNum;
+} StructureBinaryChain;
+
+typedef struct _StructureBinaryResidue{
+  char name[MAX_LENGTH_RESIDUE_NAME+1];
+  char chainName[MAX_LENGTH_CHAIN_NAME+1];
+  int posInChain;
+  int nCbIn8A;
+  Type_ResidueIsTerminal resiTerm;
+  int atomNum;
+  int bondNum;
+  int patchNum;
+} StructureBinaryResidue;
+
+int StructureBinaryWrite(Structure* pStructure, char* fileName);
+int StructureBinaryRead(Structure* pStructure, char* fileName);
+
+#endif // STRUCTURE_BINARY_H
@@ -0,0 +1,262 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "StructureCache.h"
+#include "StructureBinary.h"
+#include "EmbeddedData.h"
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <atomic>
+
+StructureCache structureCache = {"", "", "", "", "", FALSE};
+
+int StructureCacheSetDirectory(char* directory){
+  strncpy(structureCache.directory, directory, MAX_LENGTH_ONE_LINE_IN_FILE);
+  structureCache.directory[MAX_LENGTH_ONE_LINE_IN_FILE] = '\0';
+  structureCache.enabled = strlen(structureCache.directory) > 0;
+  return Success;
+}
+
+BOOL StructureCacheIsEnabled(){
+  return structureCache.enabled;
+}
+
+int StructureCacheSetFiles(char* pdbFile, char* atomParamFile, char* topologyFile, char* rotamerLibFile){
+  strncpy(structureCache.pdbFile, pdbFile, MAX_LENGTH_ONE_LINE_IN_FILE);
+  strncpy(structureCache.atomParamFile, atomParamFile, MAX_LENGTH_ONE_LINE_IN_FILE);
+  strncpy(structureCache.topologyFile, topologyFile, MAX_LENGTH_ONE_LINE_IN_FILE);
+  strncpy(structureCache.rotamerLibFile, rotamerLibFile, MAX_LENGTH_ONE_LINE_IN_FILE);
+  return Success;
+}
+
+// 64-bit FNV-1a
+unsigned long long StructureCacheHashBytes(unsigned long long hash, const char* bytes, size_t length){
+  for(size_t i = 0; i < length; i++){
+    hash ^= (unsigned char)bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+int StructureCacheHashFile(unsigned long long* pHash, char* fileName){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  FILE* pFile = fopen(fileName, "rb");
+  EmbeddedFile* pEmbedded = pFile == NULL ? EmbeddedDataFind(fileName) : NULL;
+  if(pEmbedded != NULL){
+    for(int i = 0; i < pEmbedded->lineCount; i++){
+      *pHash = StructureCacheHashBytes(*pHash, pEmbedded->lines[i], strlen(pEmbedded->lines[i]));
+      *pHash = StructureCacheHashBytes(*pHash, "\n", 1);
+    }
+    *pHash = StructureCacheHashBytes(*pHash, "\0", 1);
+    return Success;
+  }
+  if(pFile == NULL){
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, cannot open file %.512s for the cache key", __FILE__, __FUNCTION__, __LINE__, fileName);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  char buffer[65536];
+  size_t length;
+  while((length = fread(buffer, 1, sizeof(buffer), pFile)) > 0){
+    *pHash = StructureCacheHashBytes(*pHash, buffer, length);
+  }
+  // the separator keeps the boundaries between the files in the key
+  *pHash = StructureCacheHashBytes(*pHash, "\0", 1);
+  fclose(pFile);
+  return Success;
+}
+
+// the tag tells the kinds of entries apart, e.g. a repaired structure and a binding energy of the same input
+int StructureCacheGetKey(const char* tag, BOOL useRotamerLib, char* key){
+  unsigned long long hash = 14695981039346656037ULL;
+  char version[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  snprintf(version, MAX_LENGTH_ONE_LINE_IN_FILE+1, "%d %s", STRUCTURE_CACHE_VERSION, tag);
+  hash = StructureCacheHashBytes(hash, version, strlen(version)+1);
+  if(FAILED(StructureCacheHashFile(&hash, structureCache.pdbFile))) return IOError;
+  if(FAILED(StructureCacheHashFile(&hash, structureCache.atomParamFile))) return IOError;
+  if(FAILED(StructureCacheHashFile(&hash, structureCache.topologyFile))) return IOError;
+  if(useRotamerLib && FAILED(StructureCacheHashFile(&hash, structureCache.rotamerLibFile))) return IOError;
+  sprintf(key, "%016llx", hash);
+  return Success;
+}
+
+// path and tempPath hold MAX_LENGTH_ONE_LINE_IN_FILE+1 characters, a longer path is an error instead of a truncated name
+int StructureCacheGetPath(char* key, const char* suffix, char* path){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  int length = snprintf(path, MAX_LENGTH_ONE_LINE_IN_FILE+1, "%s/%s.%s", structureCache.directory, key, suffix);
+  if(length < 0 || length > MAX_LENGTH_ONE_LINE_IN_FILE){
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, the cache directory %.512s is too long", __FILE__, __FUNCTION__, __LINE__, structureCache.directory);
+    TraceError(usrMsg, ValueError);
+    return ValueError;
+  }
+  return Success;
+}
+
+// the process id and a per-process counter keep the names of concurrent jobs and threads apart, the entry itself is
+// only replaced by rename()
+int StructureCacheGetTempPath(char* path, char* tempPath){
+  static std::atomic<unsigned int> tempCount(0);
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  int length = snprintf(tempPath, MAX_LENGTH_ONE_LINE_IN_FILE+1, "%s.%ld.%u.tmp", path, (long)getpid(), tempCount++);
+  if(length < 0 || length > MAX_LENGTH_ONE_LINE_IN_FILE){
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, the cache entry name %.512s is too long", __FILE__, __FUNCTION__, __LINE__, path);
+    TraceError(usrMsg, ValueError);
+    return ValueError;
+  }
+  return Success;
+}
+
+int StructureCacheCopyFile(char* srcFile, char* destFile){
+  FILE* pSrc = fopen(srcFile, "rb");
+  if(pSrc == NULL) return IOError;
+  FILE* pDest = fopen(destFile, "wb");
+  if(pDest == NULL){
+    fclose(pSrc);
+    return IOError;
+  }
+  char buffer[65536];
+  size_t length;
+  int result = Success;
+  while((length = fread(buffer, 1, sizeof(buffer), pSrc)) > 0){
+    if(fwrite(buffer, 1, length, pDest) != length){
+      result = IOError;
+      break;
+    }
+  }
+  fclose(pSrc);
+  if(fclose(pDest) != 0) result = IOError;
+  return result;
+}
+
+int StructureCacheFetchFile(char* key, const char* suffix, char* destFile){
+  char path[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  if(FAILED(StructureCacheGetPath(key, suffix, path))) return DataNotExistError;
+  FILE* pFile = fopen(path, "rb");
+  if(pFile == NULL) return DataNotExistError;
+  fclose(pFile);
+  return StructureCacheCopyFile(path, destFile);
+}
+
+// an entry is written to a temporary file first and renamed, so that concurrent jobs never read a partial entry
+int StructureCacheStoreFile(char* key, const char* suffix, char* srcFile){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  char path[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char tempPath[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  if(FAILED(StructureCacheGetPath(key, suffix, path)) || FAILED(StructureCacheGetTempPath(path, tempPath))) return ValueError;
+  if(FAILED(StructureCacheCopyFile(srcFile, tempPath)) || rename(tempPath, path) != 0){
+    remove(tempPath);
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, cannot write cache entry %.512s", __FILE__, __FUNCTION__, __LINE__, path);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  return Success;
+}
+
+// entry: magic, version, number of terms, the energy terms, number of residues and the burial count (nCbIn8A) of every
+// residue in chain order. the burial counts are restored into the structure, a different residue count is a miss
+int StructureCacheFetchEnergy(char* key, Structure* pStructure, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]){
+  char path[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  if(FAILED(StructureCacheGetPath(key, "energy", path))) return DataNotExistError;
+  FILE* pFile = fopen(path, "rb");
+  if(pFile == NULL) return DataNotExistError;
+
+  char magic[8];
+  int version = 0, termNum = 0, residueNum = 0;
+  int result = DataNotExistError;
+  double terms[MAX_EVOEF_ENERGY_TERM_NUM];
+  if(fread(magic, 1, 8, pFile) == 8 && strcmp(magic, STRUCTURE_CACHE_ENERGY_MAGIC) == 0 &&
+    fread(&version, sizeof(int), 1, pFile) == 1 && version == STRUCTURE_CACHE_VERSION &&
+    fread(&termNum, sizeof(int), 1, pFile) == 1 && termNum == MAX_EVOEF_ENERGY_TERM_NUM &&
+    fread(terms, sizeof(double), termNum, pFile) == (size_t)termNum &&
+    fread(&residueNum, sizeof(int), 1, pFile) == 1){
+    int count = 0;
+    for(int i = 0; i < StructureGetChainCount(pStructure); i++) count += ChainGetResidueCount(StructureGetChain(pStructure, i));
+    int* burials = (int*)malloc(sizeof(int)*(residueNum+1));
+    if(residueNum == count && fread(burials, sizeof(int), residueNum, pFile) == (size_t)residueNum){
+      int index = 0;
+      for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+        Chain* pChain = StructureGetChain(pStructure, i);
+        for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+          ChainGetResidue(pChain, j)->nCbIn8A = burials[index++];
+        }
+      }
+      for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = terms[i];
+      result = Success;
+    }
+    free(burials);
+  }
+  fclose(pFile);
+  return result;
+}
+
+int StructureCacheStoreEnergy(char* key, Structure* pStructure, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  char path[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char tempPath[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  if(FAILED(StructureCacheGetPath(key, "energy", path)) || FAILED(StructureCacheGetTempPath(path, tempPath))) return ValueError;
+  FILE* pFile = fopen(tempPath, "wb");
+  if(pFile == NULL){
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, cannot write cache entry %.512s", __FILE__, __FUNCTION__, __LINE__, path);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  char magic[8] = STRUCTURE_CACHE_ENERGY_MAGIC;
+  int version = STRUCTURE_CACHE_VERSION, termNum = MAX_EVOEF_ENERGY_TERM_NUM, residueNum = 0;
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++) residueNum += ChainGetResidueCount(StructureGetChain(pStructure, i));
+  fwrite(magic, 1, 8, pFile);
+  fwrite(&version, sizeof(int), 1, pFile);
+  fwrite(&termNum, sizeof(int), 1, pFile);
+  fwrite(energyTerms, sizeof(double), termNum, pFile);
+  fwrite(&residueNum, sizeof(int), 1, pFile);
+  for(int i = 0; i < StructureGetChainCount(pStructure); i++){
+    Chain* pChain = StructureGetChain(pStructure, i);
+    for(int j = 0; j < ChainGetResidueCount(pChain); j++){
+      fwrite(&ChainGetResidue(pChain, j)->nCbIn8A, sizeof(int), 1, pFile);
+    }
+  }
+  if(fclose(pFile) != 0 || rename(tempPath, path) != 0){
+    remove(tempPath);
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, cannot write cache entry %.512s", __FILE__, __FUNCTION__, __LINE__, path);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  return Success;
+}
+
+// entry: the configured structure in the format of StructureBinaryWrite(), an entry of another build layout is a miss
+int StructureCacheFetchStructure(char* key, Structure* pStructure){
+  char path[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  if(FAILED(StructureCacheGetPath(key, "structure", path))) return DataNotExistError;
+  if(FAILED(StructureBinaryRead(pStructure, path))) return DataNotExistError;
+  return Success;
+}
+
+int StructureCacheStoreStructure(char* key, Structure* pStructure){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+  char path[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char tempPath[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  if(FAILED(StructureCacheGetPath(key, "structure", path)) || FAILED(StructureCacheGetTempPath(path, tempPath))) return ValueError;
+  if(FAILED(StructureBinaryWrite(pStructure, tempPath)) || rename(tempPath, path) != 0){
+    remove(tempPath);
+    snprintf(usrMsg, MAX_LENGTH_ERR_MSG+1, "in file %s function %s() line %d, cannot write cache entry %.512s", __FILE__, __FUNCTION__, __LINE__, path);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  return Success;
+}
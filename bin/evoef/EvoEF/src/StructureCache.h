@@ -0,0 +1,53 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef STRUCTURE_CACHE_H
+#define STRUCTURE_CACHE_H
+
+#include "Structure.h"
+#include "EnergyFunction.h"
+
+// bump the version whenever the repair or the energy function changes, so that old entries are not used any more
+#define STRUCTURE_CACHE_VERSION          1
+#define STRUCTURE_CACHE_ENERGY_MAGIC     "EVOEFWT"
+#define STRUCTURE_CACHE_KEY_LENGTH       16
+
+// on-disk cache of repaired structures and wild-type energies. an entry is keyed by a hash of the input pdb file,
+// the force field files and the cache version, so a changed input or parameter file never hits an old entry
+typedef struct _StructureCache{
+  char directory[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char pdbFile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char atomParamFile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char topologyFile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char rotamerLibFile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  BOOL enabled;
+} StructureCache;
+
+int StructureCacheSetDirectory(char* directory);
+BOOL StructureCacheIsEnabled();
+int StructureCacheSetFiles(char* pdbFile, char* atomParamFile, char* topologyFile, char* rotamerLibFile);
+int StructureCacheHashFile(unsigned long long* pHash, char* fileName);
+int StructureCacheGetKey(const char* tag, BOOL useRotamerLib, char* key);
+int StructureCacheFetchFile(char* key, const char* suffix, char* destFile);
+int StructureCacheStoreFile(char* key, const char* suffix, char* srcFile);
+int StructureCacheFetchEnergy(char* key, Structure* pStructure, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]);
+int StructureCacheStoreEnergy(char* key, Structure* pStructure, double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM]);
+int StructureCacheFetchStructure(char* key, Structure* pStructure);
+int StructureCacheStoreStructure(char* key, Structure* pStructure);
+
+#endif // STRUCTURE_CACHE_H
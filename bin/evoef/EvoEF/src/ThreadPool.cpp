@@ -0,0 +1,72 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <thread>
+#include <atomic>
+#include <vector>
+
+int threadPoolThreadNum = 1;
+// set inside a worker, a nested ThreadPoolRun() then runs its tasks on the calling thread
+thread_local BOOL threadPoolInsideWorker = FALSE;
+
+// threadNum <= 0 uses all hardware threads
+int ThreadPoolSetThreadCount(int threadNum){
+  if(threadNum <= 0) threadNum = (int)std::thread::hardware_concurrency();
+  if(threadNum <= 0) threadNum = 1;
+  if(threadNum > THREAD_POOL_MAX_THREAD_NUM) threadNum = THREAD_POOL_MAX_THREAD_NUM;
+  threadPoolThreadNum = threadNum;
+  return Success;
+}
+
+int ThreadPoolGetThreadCount(){
+  return threadPoolThreadNum;
+}
+
+// every worker claims the next unprocessed index until none is left, so fast workers take over the work of slow ones.
+// the tasks must not depend on the order in which they run
+int ThreadPoolWorker(std::atomic<int>* pNext, int taskNum, ThreadPoolTask task, void* pArgs, int threadIndex){
+  threadPoolInsideWorker = TRUE;
+  for(int index = (*pNext)++; index < taskNum; index = (*pNext)++){
+    task(pArgs, index, threadIndex);
+  }
+  ProfilerMergeThread();
+  threadPoolInsideWorker = FALSE;
+  return Success;
+}
+
+int ThreadPoolRun(int taskNum, ThreadPoolTask task, void* pArgs){
+  int workerNum = threadPoolThreadNum < taskNum ? threadPoolThreadNum : taskNum;
+  if(workerNum <= 1 || threadPoolInsideWorker){
+    for(int index = 0; index < taskNum; index++){
+      task(pArgs, index, 0);
+    }
+    return Success;
+  }
+  std::atomic<int> next(0);
+  std::vector<std::thread> workers;
+  for(int t = 1; t < workerNum; t++){
+    workers.push_back(std::thread(ThreadPoolWorker, &next, taskNum, task, pArgs, t));
+  }
+  ThreadPoolWorker(&next, taskNum, task, pArgs, 0);
+  for(int t = 0; t < (int)workers.size(); t++){
+    workers[t].join();
+  }
+  return Success;
+}
@@ -17,6 +17,7 @@ IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 ********************************************************************************************************************************/
 
 #include "Utility.h"
+#include "EmbeddedData.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -170,6 +171,15 @@ int FileReaderCreate(FileReader* pThis, char* path){
   char usrMsg[MAX_LENGTH_ERR_MSG+1];
   StringArrayCreate(&pThis->lines);
   FILE* pFile = fopen(path, "r");
+  // the default data files are compiled in, they are used when no file is found on disk
+  EmbeddedFile* pEmbedded = pFile == NULL ? EmbeddedDataFind(path) : NULL;
+  if(pEmbedded != NULL){
+    for(int i = 0; i < pEmbedded->lineCount; i++){
+      StringArrayAppend(&pThis->lines, (char*)pEmbedded->lines[i]);
+    }
+    pThis->position = 0;
+    return Success;
+  }
   if(pFile==NULL){
     int    result = IOError;
     sprintf(usrMsg, "in file %s function %s() line %d, when opening:\n%s", __FILE__, __FUNCTION__, __LINE__, path);
@@ -587,6 +597,34 @@ int ExtractFirstStringFromSourceString(char* dest, char* src){
   return Success;
 }
 
+// the whole string must be a decimal integer within [minValue, maxValue], e.g. "4x" or a number beyond the range of
+// int is a ValueError
+int ParseIntegerString(char* text, int minValue, int maxValue, int* pValue){
+  char* end = NULL;
+  errno = 0;
+  long value = strtol(text, &end, 10);
+  if(end == text || *end != '\0' || errno == ERANGE || value < minValue || value > maxValue){
+    return ValueError;
+  }
+  *pValue = (int)value;
+  return Success;
+}
+
+// the whole string must be a non-negative decimal integer that fits into unsigned long long. strtoull() would accept
+// a leading '-' and negate the value, so it is rejected first
+int ParseUnsignedString(char* text, unsigned long long* pValue){
+  char* end = NULL;
+  while(isspace((unsigned char)*text)) text++;
+  if(*text == '-') return ValueError;
+  errno = 0;
+  unsigned long long value = strtoull(text, &end, 10);
+  if(end == text || *end != '\0' || errno == ERANGE){
+    return ValueError;
+  }
+  *pValue = value;
+  return Success;
+}
+
 int Model(int i, FILE* pFile){
   if(pFile==NULL){
     pFile = stdout;
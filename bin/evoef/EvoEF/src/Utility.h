@@ -123,6 +123,8 @@ int  DoubleArrayMinus(DoubleArray *pThis, DoubleArray *pOther);
 
 int ExtractTargetStringFromSourceString(char* dest, char* src, int start, int length);
 int ExtractFirstStringFromSourceString(char* dest, char* src);
+int ParseIntegerString(char* text, int minValue, int maxValue, int* pValue);
+int ParseUnsignedString(char* text, unsigned long long* pValue);
 
 int Model(int i, FILE* pFile);
 int EndModel(FILE* pFile);
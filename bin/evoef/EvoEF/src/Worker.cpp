@@ -0,0 +1,531 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#include "Worker.h"
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+
+int WorkerRequestCreate(WorkerRequest* pThis){
+  StringArrayCreate(&pThis->keys);
+  StringArrayCreate(&pThis->values);
+  return Success;
+}
+
+int WorkerRequestDestroy(WorkerRequest* pThis){
+  StringArrayDestroy(&pThis->keys);
+  StringArrayDestroy(&pThis->values);
+  return Success;
+}
+
+// reads a json string at p, which points to the opening quote, and returns the position after the closing quote or
+// NULL for a malformed string. \uXXXX escapes are kept as '?', the requests only carry file names and mutations
+char* WorkerParseString(char* p, char* dest, int maxLength){
+  int length = 0;
+  if(*p != '"') return NULL;
+  for(p++; *p != '"'; p++){
+    char c = *p;
+    if(c == '\0') return NULL;
+    if(c == '\\'){
+      p++;
+      if(*p == 'n') c = '\n';
+      else if(*p == 't') c = '\t';
+      else if(*p == 'r') c = '\r';
+      else if(*p == 'b') c = '\b';
+      else if(*p == 'f') c = '\f';
+      else if(*p == 'u'){
+        for(int i = 0; i < 4; i++){
+          if(!isxdigit(p[1])) return NULL;
+          p++;
+        }
+        c = '?';
+      }
+      else if(*p == '"' || *p == '\\' || *p == '/') c = *p;
+      else return NULL;
+    }
+    if(length >= maxLength) return NULL;
+    dest[length++] = c;
+  }
+  dest[length] = '\0';
+  return p+1;
+}
+
+char* WorkerSkipSpaces(char* p){
+  while(*p != '\0' && isspace(*p)) p++;
+  return p;
+}
+
+// a flat json object, nested objects and arrays are rejected with FormatError
+int WorkerRequestParse(WorkerRequest* pThis, char* line){
+  char key[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char value[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  char* p = WorkerSkipSpaces(line);
+  if(*p != '{') return FormatError;
+  p = WorkerSkipSpaces(p+1);
+  if(*p == '}') return *WorkerSkipSpaces(p+1) == '\0' ? Success : FormatError;
+  while(TRUE){
+    p = WorkerParseString(p, key, MAX_LENGTH_ONE_LINE_IN_FILE);
+    if(p == NULL) return FormatError;
+    p = WorkerSkipSpaces(p);
+    if(*p != ':') return FormatError;
+    p = WorkerSkipSpaces(p+1);
+    if(*p == '"'){
+      p = WorkerParseString(p, value, MAX_LENGTH_ONE_LINE_IN_FILE);
+      if(p == NULL) return FormatError;
+    }
+    else{
+      // numbers, true, false and null are kept as written
+      int length = 0;
+      while(*p != '\0' && *p != ',' && *p != '}' && !isspace(*p) && length < MAX_LENGTH_ONE_LINE_IN_FILE){
+        if(*p == '{' || *p == '[' || *p == '"') return FormatError;
+        value[length++] = *p++;
+      }
+      value[length] = '\0';
+      if(length == 0) return FormatError;
+    }
+    StringArrayAppend(&pThis->keys, key);
+    StringArrayAppend(&pThis->values, value);
+    p = WorkerSkipSpaces(p);
+    if(*p == ','){
+      p = WorkerSkipSpaces(p+1);
+      continue;
+    }
+    if(*p != '}') return FormatError;
+    return *WorkerSkipSpaces(p+1) == '\0' ? Success : FormatError;
+  }
+}
+
+char* WorkerRequestGet(WorkerRequest* pThis, const char* key){
+  int index = -1;
+  if(FAILED(StringArrayFind(&pThis->keys, (char*)key, &index))) return NULL;
+  return StringArrayGet(&pThis->values, index);
+}
+
+int WorkerCreate(Worker* pThis, AtomParamsSet* atomParams, ResiTopoSet* resiTopos, char* rotamerLibFile, int capacity){
+  pThis->atomParams = atomParams;
+  pThis->resiTopos = resiTopos;
+  pThis->rotamerLibFile = rotamerLibFile;
+  pThis->hasRotlib = FALSE;
+  pThis->capacity = capacity > 0 ? capacity : WORKER_DEFAULT_CACHE_SIZE;
+  pThis->entries = (WorkerEntry*)malloc(sizeof(WorkerEntry)*pThis->capacity);
+  pThis->entryNum = 0;
+  pThis->clock = 0;
+  return Success;
+}
+
+int WorkerDestroy(Worker* pThis){
+  for(int i = 0; i < pThis->entryNum; i++){
+    StructureDestroy(&pThis->entries[i].structure);
+  }
+  free(pThis->entries);
+  pThis->entries = NULL;
+  pThis->entryNum = 0;
+  if(pThis->hasRotlib) RotamerLibDestroy(&pThis->rotlib);
+  pThis->hasRotlib = FALSE;
+  return Success;
+}
+
+// the configured structure of a pdb file, from the cache or configured and cached, evicting the least recently used
+// entry when the cache is full. returns NULL if the file cannot be read or holds no chain
+WorkerEntry* WorkerGetEntry(Worker* pThis, char* pdbFile){
+  FILE* pFile = fopen(pdbFile, "r");
+  if(pFile == NULL) return NULL;
+  fclose(pFile);
+  unsigned long long hash = 14695981039346656037ULL;
+  if(FAILED(StructureCacheHashFile(&hash, pdbFile))) return NULL;
+  char key[STRUCTURE_CACHE_KEY_LENGTH+1];
+  sprintf(key, "%016llx", hash);
+
+  pThis->clock++;
+  for(int i = 0; i < pThis->entryNum; i++){
+    if(strcmp(pThis->entries[i].key, key) == 0){
+      pThis->entries[i].lastUsed = pThis->clock;
+      return &pThis->entries[i];
+    }
+  }
+  WorkerEntry* pEntry = NULL;
+  if(pThis->entryNum < pThis->capacity){
+    pEntry = &pThis->entries[pThis->entryNum++];
+  }
+  else{
+    pEntry = &pThis->entries[0];
+    for(int i = 1; i < pThis->entryNum; i++){
+      if(pThis->entries[i].lastUsed < pEntry->lastUsed) pEntry = &pThis->entries[i];
+    }
+    StructureDestroy(&pEntry->structure);
+  }
+  strcpy(pEntry->key, key);
+  StructureCreate(&pEntry->structure);
+  // a file without ATOM records, or no pdb file at all, gives no chain and is not cached. the last entry takes the
+  // freed slot
+  if(FAILED(StructureConfig(&pEntry->structure, pdbFile, pThis->atomParams, pThis->resiTopos)) ||
+    StructureGetChainCount(&pEntry->structure) == 0){
+    StructureDestroy(&pEntry->structure);
+    *pEntry = pThis->entries[--pThis->entryNum];
+    return NULL;
+  }
+  pEntry->hasBinding = FALSE;
+  pEntry->lastUsed = pThis->clock;
+  return pEntry;
+}
+
+int WorkerGetRotamerLib(Worker* pThis, RotamerLib** ppRotlib){
+  if(!pThis->hasRotlib){
+    if(FAILED(RotamerLibCreate(&pThis->rotlib, pThis->rotamerLibFile))) return IOError;
+    pThis->hasRotlib = TRUE;
+  }
+  *ppRotlib = &pThis->rotlib;
+  return Success;
+}
+
+// the mutations of a "mutant" field, divided by ',' and optionally ended by ';' as in the mutant file.
+// mutations of an amino acid into itself are dropped when skipSelf is set
+int WorkerReadMutant(char* mutantstr, StringArray* pMutant, BOOL skipSelf){
+  char buffer[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+  strcpy(buffer, mutantstr);
+  int length = (int)strlen(buffer);
+  while(length > 0 && (buffer[length-1] == ';' || isspace(buffer[length-1]))) buffer[--length] = '\0';
+  StringArray mutations;
+  StringArrayCreate(&mutations);
+  StringArraySplitString(&mutations, buffer, ',');
+  int result = StringArrayGetCount(&mutations) > 0 ? Success : ValueError;
+  for(int i = 0; i < StringArrayGetCount(&mutations); i++){
+    char* mutstr = StringArrayGet(&mutations, i);
+    char aa1, chn, aa2;
+    int posInChain;
+    char tail[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+    int count = (int)strlen(mutstr);
+    // a mutation is at most 9 characters long, as in ComputeBindingDDG
+    if(count < 4 || count > 9 || sscanf(mutstr, "%c%c%d%s", &aa1, &chn, &posInChain, tail) != 4 || strlen(tail) != 1){
+      result = ValueError;
+      break;
+    }
+    aa2 = tail[0];
+    if(strchr(SATURATION_AMINO_ACIDS, aa2) == NULL){
+      result = ValueError;
+      break;
+    }
+    if(skipSelf && aa1 == aa2) continue;
+    StringArrayAppend(pMutant, mutstr);
+  }
+  StringArrayDestroy(&mutations);
+  return result;
+}
+
+int WorkerWriteError(FILE* pOut, const char* id, const char* message){
+  fprintf(pOut, "{\"id\":");
+  EnergyOutputWriteJsonString(pOut, id);
+  fprintf(pOut, ",\"status\":\"error\",\"message\":");
+  EnergyOutputWriteJsonString(pOut, message);
+  fprintf(pOut, "}\n");
+  fflush(pOut);
+  return Success;
+}
+
+int WorkerHandleRequest(Worker* pThis, char* line, FILE* pOut){
+  WorkerRequest request;
+  WorkerRequestCreate(&request);
+  if(FAILED(WorkerRequestParse(&request, line))){
+    WorkerRequestDestroy(&request);
+    return WorkerWriteError(pOut, "", "malformed request, expected one flat json object per line");
+  }
+  const char* id = WorkerRequestGet(&request, "id");
+  char* command = WorkerRequestGet(&request, "command");
+  char* pdbFile = WorkerRequestGet(&request, "pdb");
+  char* mutantstr = WorkerRequestGet(&request, "mutant");
+  char message[MAX_LENGTH_ERR_MSG+1];
+  if(id == NULL) id = "";
+  WorkerEntry* pEntry = NULL;
+  RotamerLib* rotlib = NULL;
+  int result = Success;
+  if(command == NULL || pdbFile == NULL){
+    sprintf(message, "the fields command and pdb are required");
+    result = ValueError;
+  }
+  else if(strcmp(command, "ComputeStability") != 0 && strcmp(command, "ComputeBinding") != 0 &&
+    strcmp(command, "BuildMutant") != 0 && strcmp(command, "ComputeBindingDDG") != 0){
+    sprintf(message, "unknown command %.64s, use ComputeStability, ComputeBinding, BuildMutant or ComputeBindingDDG", command);
+    result = ValueError;
+  }
+  else if((strcmp(command, "BuildMutant") == 0 || strcmp(command, "ComputeBindingDDG") == 0) && mutantstr == NULL){
+    sprintf(message, "command %s needs the field mutant", command);
+    result = ValueError;
+  }
+  else if((strcmp(command, "BuildMutant") == 0 || strcmp(command, "ComputeBindingDDG") == 0) && FAILED(WorkerGetRotamerLib(pThis, &rotlib))){
+    sprintf(message, "cannot read the rotamer library %.256s", pThis->rotamerLibFile);
+    result = IOError;
+  }
+  else if((pEntry = WorkerGetEntry(pThis, pdbFile)) == NULL){
+    sprintf(message, "cannot read the pdb file %.256s", pdbFile);
+    result = IOError;
+  }
+  if(FAILED(result)){
+    WorkerWriteError(pOut, id, message);
+    WorkerRequestDestroy(&request);
+    return result;
+  }
+
+  double energyTerms[MAX_EVOEF_ENERGY_TERM_NUM];
+  if(strcmp(command, "ComputeStability") == 0){
+    EvoEF_ComputeStructureStability(&pEntry->structure, energyTerms);
+  }
+  else if(strcmp(command, "ComputeBinding") == 0){
+    if(!pEntry->hasBinding){
+      EvoEF_ComputeBinding(&pEntry->structure, pEntry->bindingTerms);
+      pEntry->hasBinding = TRUE;
+    }
+    for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = pEntry->bindingTerms[i];
+  }
+  else{
+    // mutants are built on a snapshot, the cached wild type is never modified
+    BOOL ddg = strcmp(command, "ComputeBindingDDG") == 0;
+    StringArray mutant;
+    StringArrayCreate(&mutant);
+    result = WorkerReadMutant(mutantstr, &mutant, ddg);
+    if(FAILED(result)) sprintf(message, "malformed mutant %.256s", mutantstr);
+    if(!FAILED(result) && ddg && !pEntry->hasBinding){
+      EvoEF_ComputeBinding(&pEntry->structure, pEntry->bindingTerms);
+      pEntry->hasBinding = TRUE;
+    }
+    Structure model;
+    StructureCreateSnapshot(&model, &pEntry->structure);
+    if(!FAILED(result) && StringArrayGetCount(&mutant) > 0){
+      result = EvoEF_BuildOneMutant(&model, &mutant, rotlib, pThis->atomParams, pThis->resiTopos, 0, FALSE);
+      if(FAILED(result)) sprintf(message, "cannot build mutant %.256s", mutantstr);
+    }
+    if(!FAILED(result) && ddg){
+      if(StringArrayGetCount(&mutant) > 0) EvoEF_ComputeBinding(&model, energyTerms);
+      else for(int i = 0; i < MAX_EVOEF_ENERGY_TERM_NUM; i++) energyTerms[i] = pEntry->bindingTerms[i];
+    }
+    else if(!FAILED(result)){
+      // the model is always written next to the input, "model" only names the file: <pdb without extension>_Model.pdb
+      // by default. a client can therefore never write outside the directory of a pdb file it could read
+      char modelFile[MAX_LENGTH_ONE_LINE_IN_FILE+1];
+      char* modelName = WorkerRequestGet(&request, "model");
+      int length = -1;
+      if(modelName != NULL){
+        if(modelName[0] != '\0' && strchr(modelName, '/') == NULL && strchr(modelName, '\\') == NULL &&
+          strcmp(modelName, ".") != 0 && strcmp(modelName, "..") != 0){
+          int dirLength = (int)strlen(pdbFile);
+          while(dirLength > 0 && pdbFile[dirLength-1] != '/' && pdbFile[dirLength-1] != '\\') dirLength--;
+          length = snprintf(modelFile, MAX_LENGTH_ONE_LINE_IN_FILE+1, "%.*s%s", dirLength, pdbFile, modelName);
+        }
+      }
+      else{
+        int stemLength = (int)strlen(pdbFile);
+        char* dot = strrchr(pdbFile, '.');
+        if(dot != NULL && strchr(dot, '/') == NULL && strchr(dot, '\\') == NULL) stemLength = (int)(dot-pdbFile);
+        length = snprintf(modelFile, MAX_LENGTH_ONE_LINE_IN_FILE+1, "%.*s_Model.pdb", stemLength, pdbFile);
+      }
+      FILE* pf = NULL;
+      if(length < 0 || length > MAX_LENGTH_ONE_LINE_IN_FILE){
+        sprintf(message, "the model %.256s must be a file name without a directory and fit the path length", modelName != NULL ? modelName : "");
+        result = ValueError;
+      }
+      else if((pf = fopen(modelFile, "w")) == NULL){
+        sprintf(message, "cannot write the model file %.256s", modelFile);
+        result = IOError;
+      }
+      else{
+        fprintf(pf, "REMARK EvoEF generated pdb file\n");
+        fprintf(pf, "REMARK Output generated by EvoEF <BuildMutant>\n");
+        StructureShowInPDBFormat(&model, TRUE, pf);
+        fclose(pf);
+        fprintf(pOut, "{\"id\":");
+        EnergyOutputWriteJsonString(pOut, id);
+        fprintf(pOut, ",\"status\":\"ok\",\"model\":");
+        EnergyOutputWriteJsonString(pOut, modelFile);
+        fprintf(pOut, "}\n");
+        fflush(pOut);
+      }
+    }
+    StructureDestroy(&model);
+    StringArrayDestroy(&mutant);
+    if(FAILED(result) || !ddg){
+      if(FAILED(result)) WorkerWriteError(pOut, id, message);
+      WorkerRequestDestroy(&request);
+      return result;
+    }
+  }
+
+  fprintf(pOut, "{\"id\":");
+  EnergyOutputWriteJsonString(pOut, id);
+  fprintf(pOut, ",\"status\":\"ok\"");
+  if(strcmp(command, "ComputeBindingDDG") == 0) fprintf(pOut, ",\"ddG\":%.6f", energyTerms[0]-pEntry->bindingTerms[0]);
+  fprintf(pOut, ",\"terms\":");
+  EnergyOutputWriteJsonTerms(pOut, energyTerms);
+  fprintf(pOut, "}\n");
+  fflush(pOut);
+  WorkerRequestDestroy(&request);
+  return Success;
+}
+
+// serves the requests of one stream until its end, one response line per request line. the rest of a line longer
+// than WORKER_MAX_REQUEST_LENGTH is skipped, so that it gets a single error response
+int WorkerServeStream(Worker* pThis, FILE* pIn, FILE* pOut){
+  char* line = (char*)malloc(sizeof(char)*(WORKER_MAX_REQUEST_LENGTH+1));
+  while(fgets(line, WORKER_MAX_REQUEST_LENGTH+1, pIn) != NULL){
+    if((int)strlen(line) == WORKER_MAX_REQUEST_LENGTH && line[WORKER_MAX_REQUEST_LENGTH-1] != '\n'){
+      int c;
+      while((c = fgetc(pIn)) != EOF && c != '\n');
+      char message[MAX_LENGTH_ERR_MSG+1];
+      sprintf(message, "request longer than %d characters", WORKER_MAX_REQUEST_LENGTH);
+      WorkerWriteError(pOut, "", message);
+      continue;
+    }
+    if(*WorkerSkipSpaces(line) == '\0') continue;
+    WorkerHandleRequest(pThis, line, pOut);
+  }
+  free(line);
+  return Success;
+}
+
+// the responses are written to the original standard output, which is redirected to the standard error, so that
+// the messages printed while computing never mix with the responses. the first line tells that the worker is ready
+int WorkerServeStdin(Worker* pThis){
+  fflush(stdout);
+  int responseFd = dup(fileno(stdout));
+  FILE* pOut = responseFd >= 0 ? fdopen(responseFd, "w") : NULL;
+  if(pOut == NULL){
+    char usrMsg[MAX_LENGTH_ERR_MSG+1];
+    sprintf(usrMsg, "in file %s function %s() line %d, cannot open the response stream", __FILE__, __FUNCTION__, __LINE__);
+    TraceError(usrMsg, IOError);
+    return IOError;
+  }
+  dup2(fileno(stderr), fileno(stdout));
+  fprintf(pOut, "{\"status\":\"ready\"}\n");
+  fflush(pOut);
+  WorkerServeStream(pThis, stdin, pOut);
+  fclose(pOut);
+  return Success;
+}
+
+#ifndef _WIN32
+volatile sig_atomic_t workerStopRequested = 0;
+
+void WorkerStopHandler(int /*signalNumber*/){
+  workerStopRequested = 1;
+}
+
+// without SA_RESTART, so that a blocking accept() or wait() returns when the worker is asked to stop
+void WorkerSetStopHandler(void (*handler)(int)){
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = handler;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGTERM, &action, NULL);
+  sigaction(SIGINT, &action, NULL);
+}
+
+int WorkerAcceptLoop(Worker* pThis, int listenFd){
+  while(!workerStopRequested){
+    int fd = accept(listenFd, NULL, NULL);
+    if(fd < 0){
+      if(errno == EINTR) continue;
+      return IOError;
+    }
+    int outFd = dup(fd);
+    FILE* pIn = fdopen(fd, "r");
+    FILE* pOut = outFd >= 0 ? fdopen(outFd, "w") : NULL;
+    if(pIn != NULL && pOut != NULL) WorkerServeStream(pThis, pIn, pOut);
+    if(pIn != NULL) fclose(pIn); else close(fd);
+    if(pOut != NULL) fclose(pOut); else if(outFd >= 0) close(outFd);
+  }
+  return Success;
+}
+
+int WorkerStartProcess(Worker* pThis, int listenFd){
+  pid_t pid = fork();
+  if(pid == 0){
+    WorkerSetStopHandler(SIG_DFL);
+    WorkerAcceptLoop(pThis, listenFd);
+    exit(Success);
+  }
+  return (int)pid;
+}
+#endif
+
+// serves the clients of a unix domain socket, one connection at a time per worker process. with processNum > 1 the
+// worker processes are forked after the parameters are loaded and share the listening socket, so at most processNum
+// requests run at the same time; a worker process that dies is replaced
+int WorkerServeSocket(Worker* pThis, char* socketPath, int processNum){
+  char usrMsg[MAX_LENGTH_ERR_MSG+1];
+#ifdef _WIN32
+  sprintf(usrMsg, "in file %s function %s() line %d, unix domain sockets are not supported on this platform, use the standard input", __FILE__, __FUNCTION__, __LINE__);
+  TraceError(usrMsg, IOError);
+  return IOError;
+#else
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if(strlen(socketPath) >= sizeof(address.sun_path)){
+    sprintf(usrMsg, "in file %s function %s() line %d, socket path %s is too long", __FILE__, __FUNCTION__, __LINE__, socketPath);
+    TraceError(usrMsg, ValueError);
+    return ValueError;
+  }
+  strcpy(address.sun_path, socketPath);
+  int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(socketPath);
+  if(listenFd < 0 || bind(listenFd, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listenFd, 64) != 0){
+    sprintf(usrMsg, "in file %s function %s() line %d, cannot listen on socket %s", __FILE__, __FUNCTION__, __LINE__, socketPath);
+    TraceError(usrMsg, IOError);
+    if(listenFd >= 0) close(listenFd);
+    return IOError;
+  }
+  // a client that disconnects before reading its response must not end the worker
+  signal(SIGPIPE, SIG_IGN);
+  printf("EvoEF worker listening on %s with %d process(es)\n", socketPath, processNum > 1 ? processNum : 1);
+  fflush(stdout);
+
+  WorkerSetStopHandler(WorkerStopHandler);
+  if(processNum <= 1){
+    WorkerAcceptLoop(pThis, listenFd);
+  }
+  else{
+    pid_t* pids = (pid_t*)malloc(sizeof(pid_t)*processNum);
+    for(int i = 0; i < processNum; i++) pids[i] = WorkerStartProcess(pThis, listenFd);
+    while(!workerStopRequested){
+      int status;
+      pid_t pid = wait(&status);
+      if(pid < 0){
+        if(errno == EINTR) continue;
+        break;
+      }
+      for(int i = 0; i < processNum; i++){
+        if(pids[i] == pid && !workerStopRequested) pids[i] = WorkerStartProcess(pThis, listenFd);
+      }
+    }
+    for(int i = 0; i < processNum; i++) if(pids[i] > 0) kill(pids[i], SIGTERM);
+    while(wait(NULL) > 0);
+    free(pids);
+  }
+  close(listenFd);
+  unlink(socketPath);
+  return Success;
+#endif
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************************************************************
+This file is a part of the EvoDesign physical Energy Function (EvoEF)
+
+Copyright (c) 2019 Xiaoqiang Huang (tommyhuangthu@foxmail.com, xiaoqiah@umich.edu)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation 
+files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the 
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE 
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR 
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+********************************************************************************************************************************/
+
+#ifndef WORKER_H
+#define WORKER_H
+
+#include "ProgramFunction.h"
+
+#define WORKER_DEFAULT_CACHE_SIZE      8
+#define WORKER_MAX_REQUEST_LENGTH      65536
+
+// a request is one flat json object per line, all values are kept as strings, e.g.
+// {"id":"7","command":"ComputeBindingDDG","pdb":"/data/1A22_Repair.pdb","mutant":"QA22D,HA18F"}
+typedef struct _WorkerRequest{
+  StringArray keys;    // 12-16 bytes
+  StringArray values;  // 12-16 bytes
+} WorkerRequest;
+
+int WorkerRequestCreate(WorkerRequest* pThis);
+int WorkerRequestDestroy(WorkerRequest* pThis);
+int WorkerRequestParse(WorkerRequest* pThis, char* line);
+char* WorkerRequestGet(WorkerRequest* pThis, const char* key);
+
+// a configured structure kept by the worker, keyed by a hash of the contents of its pdb file
+typedef struct _WorkerEntry{
+  char key[STRUCTURE_CACHE_KEY_LENGTH+1];              // 17 bytes
+  Structure structure;                                  // wild type, never modified by a request
+  double bindingTerms[MAX_EVOEF_ENERGY_TERM_NUM];       // binding energy of the wild type, once computed
+  BOOL hasBinding;                                      // 1 byte
+  long lastUsed;                                        // 4/8 bytes
+} WorkerEntry;
+
+// resident EvoEF: the parameters are loaded once and the recently used structures are kept in a least recently used
+// cache, requests are served one at a time
+typedef struct _Worker{
+  AtomParamsSet* atomParams;  // 4/8 bytes
+  ResiTopoSet* resiTopos;     // 4/8 bytes
+  char* rotamerLibFile;       // 4/8 bytes, the rotamer library is read on the first request that needs it
+  RotamerLib rotlib;
+  BOOL hasRotlib;             // 1 byte
+  WorkerEntry* entries;       // 4/8 bytes
+  int entryNum;               // 4 bytes
+  int capacity;               // 4 bytes
+  long clock;                 // 4/8 bytes, request counter used for the lru order
+} Worker;
+
+int WorkerCreate(Worker* pThis, AtomParamsSet* atomParams, ResiTopoSet* resiTopos, char* rotamerLibFile, int capacity);
+int WorkerDestroy(Worker* pThis);
+int WorkerServeStream(Worker* pThis, FILE* pIn, FILE* pOut);
+int WorkerServeStdin(Worker* pThis);
+int WorkerServeSocket(Worker* pThis, char* socketPath, int processNum);
+
+#endif // WORKER_H
@@ -0,0 +1,62 @@
+#!/usr/bin/perl -w
+######################################################
+#this script compiles the default force field, topology
+#and rotamer library files into EvoEF
+# Input:  data files (default: the files read by EvoEF
+#         in ./data when no option is given)
+# Output: EmbeddedDataFiles.cpp next to this script,
+#         rebuild EvoEF afterwards
+######################################################
+
+use strict;
+use warnings;
+
+use File::Basename;
+use Cwd 'abs_path';
+my $src_path=dirname(abs_path(__FILE__));
+
+my @files = @ARGV;
+if(@files==0){
+  @files = ("$src_path/data/param_charmm19_lk_ref2015.prm",
+            "$src_path/data/top_polh19_prot.inp",
+            "$src_path/data/rotlib984.txt");
+}
+
+my $out_file = "$src_path/EmbeddedDataFiles.cpp";
+open(OUT, ">$out_file") or die "cannot write $out_file\n";
+print OUT "// generated by embed_data.pl from the files in ./data, do not edit\n";
+print OUT "#include \"EmbeddedData.h\"\n\n";
+
+my @tables = ();
+my $index = 0;
+foreach my $file (@files){
+  open(IN, "<$file") or die "cannot open $file\n";
+  my @lines = ();
+  while(my $line = <IN>){
+    # keep the lines as FileReaderCreate() does: no comments after '!', no trailing spaces, no empty lines
+    $line =~ s/!.*//s;
+    $line =~ s/\s+$//;
+    next if($line eq "");
+    die "only ASCII characters are allowed in $file:\n$line\n" if($line =~ /[^\x00-\x7f]/);
+    $line =~ s/\\/\\\\/g;
+    $line =~ s/"/\\"/g;
+    push(@lines, $line);
+  }
+  close(IN);
+  my $name = basename($file);
+  print OUT "// $name\n";
+  print OUT "static const char* embeddedLines$index\[\] = {\n";
+  foreach my $line (@lines){
+    print OUT "  \"$line\",\n";
+  }
+  print OUT "};\n\n";
+  push(@tables, "  {\"$name\", embeddedLines$index, ".scalar(@lines)."},\n");
+  $index++;
+}
+
+print OUT "EmbeddedFile embeddedFiles[] = {\n";
+print OUT @tables;
+print OUT "};\n\n";
+print OUT "int embeddedFileCount = $index;\n";
+close(OUT);
+printf "%d files written to %s\n", $index, $out_file;
@@ -0,0 +1,96 @@
+#!/usr/bin/perl -w
+######################################################
+#this script compares the energy terms of a double
+#precision and a single precision build of EvoEF
+# Input:  EvoEF binary built in double precision
+#         EvoEF binary built with -DEVOEF_SINGLE_PRECISION
+#         pdb files (default: the example and test complexes)
+# Output: maximum deviation of every energy term
+######################################################
+
+use strict;
+use warnings;
+
+use File::Basename;
+use File::Temp qw(tempfile);
+use Cwd 'abs_path';
+my $bin_path=dirname(abs_path(__FILE__));
+my $par_dir = "$bin_path/EvoEF/src/data";
+
+if(@ARGV < 2){
+  printf "Usage: check_precision.pl  EvoEF_double  EvoEF_float  [pdb ...]\n";
+  exit;
+}
+
+my $evoef_double = abs_path(shift @ARGV);
+my $evoef_float  = abs_path(shift @ARGV);
+my @pdbs = @ARGV;
+if(@pdbs==0){
+  @pdbs = (glob("$bin_path/EvoEF/example/*.pdb"), glob("$bin_path/test/*.pdb"));
+}
+
+#copy evoef parameter folder to the current folder
+my $copied_data = 0;
+if(not -d "data"){
+  `cp -r $par_dir .`;
+  $copied_data = 1;
+}
+
+my %maxdev = ();
+my %maxpdb = ();
+my @terms = ();
+foreach my $pdb (@pdbs){
+  foreach my $command ("ComputeStability", "ComputeBinding"){
+    my %energy_double = readEnergy($evoef_double, $command, $pdb);
+    my %energy_float  = readEnergy($evoef_float, $command, $pdb);
+    foreach my $term (keys %energy_double){
+      next if(not exists $energy_float{$term});
+      my $dev = abs($energy_double{$term} - $energy_float{$term});
+      if(not exists $maxdev{$term}){
+        push @terms, $term;
+        $maxdev{$term} = -1;
+      }
+      if($dev > $maxdev{$term}){
+        $maxdev{$term} = $dev;
+        $maxpdb{$term} = basename($pdb);
+      }
+    }
+  }
+}
+
+printf "%-60s %12s  %s\n", "energy term", "max |dev|", "structure";
+foreach my $term (sort @terms){
+  printf "%-60s %12.6f  %s\n", $term, $maxdev{$term}, $maxpdb{$term};
+}
+
+#clean the directory
+if($copied_data){
+  `rm -rf data`;
+}
+exit;
+
+#energy terms of one run, keyed by the command, the evaluation and the term name. the terms are read from the
+#tsv energy records, which keep six decimals, instead of the %8.2f console tables
+sub readEnergy{
+  my ($evoef, $command, $pdb) = @_;
+  my %energy = ();
+  my ($fh, $energy_file) = tempfile("evoef_energy_XXXXXX", TMPDIR => 1, UNLINK => 1);
+  close $fh;
+  `$evoef --command=$command --pdb=$pdb --output-format=tsv --energy-file=$energy_file`;
+  open(ENERGY, "<$energy_file") or die "cannot read the energy records of $evoef on $pdb\n";
+  my @names = ();
+  while(my $line = <ENERGY>){
+    chomp $line;
+    my @fields = split(/\t/, $line);
+    if($fields[0] eq "structure" and $fields[1] eq "evaluation"){
+      @names = @fields;
+      next;
+    }
+    for(my $i = 2; $i < @fields; $i++){
+      $energy{"$command: $fields[1]: $names[$i]"} = $fields[$i];
+    }
+  }
+  close ENERGY;
+  unlink $energy_file;
+  return %energy;
+}